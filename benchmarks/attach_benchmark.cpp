@@ -0,0 +1,50 @@
+#include "attach_debugger.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+
+
+namespace {
+
+/**
+ * @brief Attach to a debuggee with idle threads and stop at its system breakpoint.
+ *
+ * @details
+ * The time is measured from attaching to the system breakpoint,
+ * where the first command can be issued.
+ * The first argument is the number of idle threads.
+ * The second argument selects the fast-attach mode.
+ */
+void AttachToFirstCommand(benchmark::State& state) {
+    const auto threads{ static_cast<std::size_t>(state.range(0)) };
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        AttachDebugger debugger{ threads, state.range(1) != 0 };
+        debugger.Run();
+        if (!debugger.Errors().empty()) {
+            state.SkipWithError(debugger.Errors().front().c_str());
+            return;
+        }
+
+        const std::chrono::duration<double> elapsed{
+            debugger.TimeToFirstCommand()
+        };
+        state.SetIterationTime(elapsed.count());
+        bytes += debugger.BytesToFirstCommand();
+    }
+
+    // The main thread is counted with the idle threads.
+    state.counters["bytes_per_thread"] = static_cast<double>(bytes)
+                                         / state.iterations() / (threads + 1);
+}
+
+}  // namespace
+
+
+BENCHMARK(AttachToFirstCommand)
+    ->ArgNames({ "threads", "fast" })
+    ->ArgsProduct({ { 0, 64, 1024 }, { 0, 1 } })
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
\ No newline at end of file
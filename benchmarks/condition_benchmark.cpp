@@ -0,0 +1,75 @@
+#include "condition.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace {
+
+//! A thread state with 256 bytes of memory at address zero.
+class FakeContext : public ConditionContext {
+public:
+    FakeContext() noexcept {
+        registers[static_cast<std::size_t>(RegisterIndex::EAX)] = 5;
+        registers[static_cast<std::size_t>(RegisterIndex::ESP)] = 0x10;
+        const std::uint32_t value{ 0x2000 };
+        std::memcpy(memory.data() + 0x18, &value, sizeof(value));
+    }
+
+    std::uint32_t ReadRegister(const RegisterIndex index) const noexcept override {
+        return registers[static_cast<std::size_t>(index)];
+    }
+
+    bool ReadMemory(const std::uintptr_t address,
+                    const std::span<std::byte> buffer) noexcept override {
+        if (address > memory.size() || buffer.size() > memory.size() - address) {
+            return false;
+        }
+
+        std::memcpy(buffer.data(), memory.data() + address, buffer.size());
+        return true;
+    }
+
+    std::array<std::uint32_t, static_cast<std::size_t>(RegisterIndex::EFLAGS) + 1>
+        registers{};
+
+    std::array<std::byte, 0x100> memory{};
+};
+
+//! Conditions from simple register comparisons to memory reads.
+constexpr std::array<const char*, 4> expressions{
+    "eax == 5", "eax == 5 && dword[esp + 8] > 0x1000",
+    "(eax & 0xFF) * 4 + ecx != [esp + 8] - 0x10 || byte[esp + 9] == 0x20",
+    "[[esp + 8] & 0xFF] == 0 && edx == 0"
+};
+
+void EvaluateCondition(benchmark::State& state) {
+    const auto expression{ expressions[state.range(0)] };
+    const Condition condition{ expression };
+    FakeContext context{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(condition.Evaluate(context));
+    }
+
+    state.SetLabel(expression);
+}
+
+void CompileCondition(benchmark::State& state) {
+    const auto expression{ expressions[state.range(0)] };
+    for (auto _ : state) {
+        Condition condition{ expression };
+        benchmark::DoNotOptimize(condition.Bytecode().data());
+    }
+
+    state.SetLabel(expression);
+}
+
+}  // namespace
+
+
+BENCHMARK(EvaluateCondition)->DenseRange(0, expressions.size() - 1);
+BENCHMARK(CompileCondition)->DenseRange(0, expressions.size() - 1);
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "hit_debugger.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+
+
+namespace {
+
+//! The number of calls made by the debuggee in each iteration.
+constexpr std::size_t call_count{ 10000 };
+
+/**
+ * @brief Hit a software breakpoint in a debuggee.
+ *
+ * @details
+ * The time is measured from the first sampled hit to the last one,
+ * excluding process creation and exit.
+ * The first argument selects whether hits are filtered out and stepped over.
+ */
+void HitBreakpoint(benchmark::State& state) {
+    std::size_t hits{ 0 };
+    std::size_t allocations{ 0 };
+    for (auto _ : state) {
+        HitDebugger debugger{ call_count, state.range(0) != 0 };
+        debugger.Run();
+
+        const auto& samples{ debugger.Samples() };
+        if (samples.size() < 2) {
+            state.SkipWithError("The breakpoint was not hit.");
+            return;
+        }
+
+        const std::chrono::duration<double> elapsed{ samples.back().time
+                                                     - samples.front().time };
+        state.SetIterationTime(elapsed.count());
+        hits += samples.size() - 1;
+        allocations += samples.back().allocations - samples.front().allocations;
+    }
+
+    state.SetItemsProcessed(hits);
+    state.counters["allocations_per_hit"] =
+        static_cast<double>(allocations) / hits;
+    state.counters["time_per_hit"] = benchmark::Counter(
+        static_cast<double>(hits),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * @brief Hit a software breakpoint in a debuggee with idle threads.
+ *
+ * @details
+ * Each hit steps over the breakpoint internally.
+ * The first argument is the number of idle threads.
+ * The second argument selects whether other threads are frozen during the step.
+ */
+void HitBreakpointWithThreads(benchmark::State& state) {
+    std::size_t hits{ 0 };
+    for (auto _ : state) {
+        HitDebugger debugger{ call_count, false,
+                              static_cast<std::size_t>(state.range(0)),
+                              state.range(1) != 0 };
+        debugger.Run();
+
+        const auto& samples{ debugger.Samples() };
+        if (samples.size() < 2) {
+            state.SkipWithError("The breakpoint was not hit.");
+            return;
+        }
+
+        const std::chrono::duration<double> elapsed{ samples.back().time
+                                                     - samples.front().time };
+        state.SetIterationTime(elapsed.count());
+        hits += samples.size() - 1;
+    }
+
+    state.SetItemsProcessed(hits);
+    state.counters["time_per_hit"] = benchmark::Counter(
+        static_cast<double>(hits),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+}  // namespace
+
+
+BENCHMARK(HitBreakpoint)
+    ->ArgName("filtered")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(HitBreakpointWithThreads)
+    ->ArgNames({ "threads", "freeze" })
+    ->ArgsProduct({ { 0, 64, 1024 }, { 0, 1 } })
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "instruction.h"
+#include "instruction_corpus.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+
+namespace {
+
+//! Decode every instruction of a compiled code stream.
+void DecodeStream(benchmark::State& state) {
+    const auto& [options, code]{ reference_code[state.range(0)] };
+    const auto parsed{ ParseReferenceCode(code) };
+    const std::span<const std::byte> bytes{ parsed.bytes };
+    for (auto _ : state) {
+        std::size_t offset{ 0 };
+        while (offset < bytes.size()) {
+            const auto instruction{ DecodeInstruction(bytes.subspan(offset), offset) };
+            benchmark::DoNotOptimize(instruction);
+            offset += instruction ? instruction->length : 1;
+        }
+    }
+
+    state.SetLabel(std::string{ options });
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+    state.SetItemsProcessed(state.iterations() * parsed.lengths.size());
+}
+
+//! Find instruction boundaries of a compiled code stream.
+void MeasureStream(benchmark::State& state) {
+    const auto& [options, code]{ reference_code[state.range(0)] };
+    const auto parsed{ ParseReferenceCode(code) };
+    const std::span<const std::byte> bytes{ parsed.bytes };
+    for (auto _ : state) {
+        std::size_t offset{ 0 };
+        while (offset < bytes.size()) {
+            const auto length{ InstructionLength(bytes.subspan(offset)) };
+            benchmark::DoNotOptimize(length);
+            offset += length != 0 ? length : 1;
+        }
+    }
+
+    state.SetLabel(std::string{ options });
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+    state.SetItemsProcessed(state.iterations() * parsed.lengths.size());
+}
+
+}  // namespace
+
+
+BENCHMARK(DecodeStream)->DenseRange(0, reference_code.size() - 1);
+BENCHMARK(MeasureStream)->DenseRange(0, reference_code.size() - 1);
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include "debuggee.h"
+#include "debugger.h"
+#include "stack_walker.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+//! The maximum number of frames in a walk.
+constexpr std::size_t max_walk_depth{ 128 };
+
+/**
+ * @brief
+ * A debugger running a measurement while the debuggee is stopped in its exported function `Work`,
+ * which is called once after creating idle threads.
+ */
+class StoppedDebugger : public Debugger {
+public:
+    //! A measurement of the debuggee and the thread calling `Work`.
+    using Measurement = std::function<void(const Process&, const Thread&)>;
+
+    /**
+     * @param threads The number of idle threads in the debuggee.
+     * @param measure The measurement.
+     */
+    StoppedDebugger(const std::size_t threads, Measurement measure) :
+        threads_{ threads }, measure_{ std::move(measure) } {
+        SetModuleBreakpoint(
+            { .module =
+                  std::filesystem::path{ debuggee_path }.filename().wstring(),
+              .function = "Work",
+              .callback = [this](const Breakpoint&) {
+                  measure_(DebuggedProcess(), DebuggedThread());
+                  measured_ = true;
+              } });
+    }
+
+    //! Run the debuggee to its exit, and return whether the measurement has run.
+    bool Run() {
+        const auto cmd_line{ std::format(L"\"{}\" 1 {}", debuggee_path,
+                                         threads_) };
+        Create(debuggee_path, cmd_line,
+               std::filesystem::current_path().wstring(), false);
+        Start();
+        return measured_;
+    }
+
+private:
+    std::size_t threads_;
+
+    Measurement measure_;
+
+    bool measured_{ false };
+};
+
+/**
+ * @brief Capture the registers of all threads in a stopped debuggee.
+ *
+ * @details
+ * The time per snapshot is the time the debuggee stays frozen.
+ * The argument is the number of threads, including the main thread.
+ * The loader may add a few worker threads.
+ */
+void SnapshotAllThreads(benchmark::State& state) {
+    StoppedDebugger debugger{
+        static_cast<std::size_t>(state.range(0)) - 1,
+        [&state](const Process& process, const Thread&) {
+            std::size_t count{ 0 };
+            for (auto _ : state) {
+                count = process.SnapshotAllThreads().size();
+                benchmark::DoNotOptimize(count);
+            }
+
+            state.counters["threads"] = static_cast<double>(count);
+            state.counters["time_per_thread"] = benchmark::Counter(
+                static_cast<double>(state.iterations() * count),
+                benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+        }
+    };
+
+    if (!debugger.Run()) {
+        state.SkipWithError("The breakpoint was not hit.");
+    }
+}
+
+/**
+ * @brief Walk the stack of the thread stopped in `Work`, below nested calls.
+ *
+ * @details
+ * Stack memory is read again in each walk, as in profiling samples.
+ * The argument selects whether code ranges are set,
+ * which checks return addresses and enables scanning.
+ */
+void WalkStack(benchmark::State& state) {
+    StoppedDebugger debugger{
+        0, [&state](const Process& process, const Thread& thread) {
+            const auto snapshots{ process.SnapshotAllThreads(CONTEXT_CONTROL) };
+            const auto snapshot{ std::ranges::find(
+                snapshots, thread.Id(), &ThreadSnapshot::thread_id) };
+            if (snapshot == snapshots.cend() || snapshot->context_flags == 0) {
+                state.SkipWithError("The thread cannot be captured.");
+                return;
+            }
+
+            StackWalker walker{};
+            if (state.range(0) != 0) {
+                walker.SetCodeRanges(process.Modules().CodeRanges());
+            }
+
+            std::vector<std::uintptr_t> frames(max_walk_depth);
+            std::size_t depth{ 0 };
+            for (auto _ : state) {
+                depth = walker.Walk(process, *snapshot, frames);
+                benchmark::DoNotOptimize(frames.data());
+            }
+
+            state.counters["depth"] = static_cast<double>(depth);
+            state.counters["frames_per_second"] = benchmark::Counter(
+                static_cast<double>(state.iterations() * depth),
+                benchmark::Counter::kIsRate);
+        }
+    };
+
+    if (!debugger.Run()) {
+        state.SkipWithError("The breakpoint was not hit.");
+    }
+}
+
+}  // namespace
+
+
+BENCHMARK(SnapshotAllThreads)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(WalkStack)
+    ->ArgName("scan")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
\ No newline at end of file
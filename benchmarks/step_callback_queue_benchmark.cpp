@@ -0,0 +1,63 @@
+#include "step_callback_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+
+
+namespace {
+
+//! The number of single steps in each run.
+constexpr std::int64_t step_count{ 10'000'000 };
+
+/**
+ * @brief Push and execute callbacks at each single step.
+ *
+ * The first argument is the number of callbacks per step.
+ * The captures are as large as the callbacks of the debugger: a pointer and an address.
+ */
+void QueueStepCallbacks(benchmark::State& state) {
+    const auto count{ static_cast<std::size_t>(state.range(0)) };
+    StepCallbackQueue queue{};
+    std::uintptr_t sum{ 0 };
+    for (auto _ : state) {
+        for (std::size_t i{ 0 }; i != count; ++i) {
+            queue.Push([&sum, i]() { sum += i; });
+        }
+
+        queue.Execute();
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//! The previous storage of step callbacks, as a baseline.
+void ListStepCallbacks(benchmark::State& state) {
+    const auto count{ static_cast<std::size_t>(state.range(0)) };
+    std::list<std::function<void()>> callbacks{};
+    std::uintptr_t sum{ 0 };
+    for (auto _ : state) {
+        for (std::size_t i{ 0 }; i != count; ++i) {
+            callbacks.push_back([&sum, i]() { sum += i; });
+        }
+
+        auto executed{ std::move(callbacks) };
+        callbacks.clear();
+        for (const auto& callback : executed) {
+            callback();
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+}  // namespace
+
+
+BENCHMARK(QueueStepCallbacks)->Arg(1)->Arg(8)->Iterations(step_count);
+BENCHMARK(ListStepCallbacks)->Arg(1)->Arg(8)->Iterations(step_count);
\ No newline at end of file
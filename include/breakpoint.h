@@ -14,15 +14,31 @@
 
 #pragma once
 
+#include <chrono>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 
 enum class BreakpointType { Software, Hardware, Memory };
 
+//! Rules to report the hits of a breakpoint.
+struct BreakpointHitPolicy {
+    //! The number of hits ignored before any hit is reported.
+    std::uint64_t ignore_count{ 0 };
+
+    //! Report one of every @p sample_rate hits after the ignored ones.
+    std::uint64_t sample_rate{ 1 };
+
+    //! The breakpoint is disabled after reporting this number of hits. Zero means no limit.
+    std::uint64_t max_hits{ 0 };
+};
+
 //! Basic breakpoint data.
 struct Breakpoint {
     Breakpoint(std::uintptr_t address, BreakpointType type,
@@ -30,14 +46,39 @@ struct Breakpoint {
 
     virtual ~Breakpoint() noexcept = default;
 
+    /**
+     * @brief Count a hit whose condition is true.
+     *
+     * @return @p true if the hit should be reported, otherwise @p false.
+     */
+    bool Hit() noexcept;
+
+    //! Whether the breakpoint has reported the maximum number of hits.
+    bool Exhausted() const noexcept;
+
     std::uintptr_t address;
 
     BreakpointType type;
 
     //! Whether this is a one-time breakpoint.
     bool single_shoot{ false };
+
+    //! Whether the breakpoint is enabled. A disabled breakpoint is kept but never hit.
+    bool enabled{ true };
+
+    BreakpointHitPolicy hit_policy{};
+
+    //! The number of hits whose conditions are true.
+    std::uint64_t hits{ 0 };
+
+    //! The number of reported hits.
+    std::uint64_t reported_hits{ 0 };
 };
 
+//! An optional reference to a breakpoint.
+using OptionalBreakpoint =
+    std::optional<std::reference_wrapper<const Breakpoint>>;
+
 
 //! The number of hardware breakpoint slots, from @p DR0 to @p DR3.
 inline constexpr std::size_t hardware_breakpoint_slot_count{ 4 };
@@ -80,6 +121,23 @@ struct SoftwareBreakpoint : public Breakpoint {
 };
 
 
+/**
+ * @brief
+ * A temporary breakpoint where threads stop after stepping over a call or out of a function.
+ * It is shared by all threads waiting to return to the same address.
+ */
+struct ReturnBreakpoint {
+    ReturnBreakpoint(std::uintptr_t address, std::byte original_byte) noexcept;
+
+    std::uintptr_t address;
+
+    std::byte original_byte;
+
+    //! The number of threads waiting to return to the address.
+    std::size_t references{ 1 };
+};
+
+
 template <typename T>
 concept ValidBreakpoint = std::derived_from<T, Breakpoint>;
 
@@ -87,4 +145,69 @@ concept ValidBreakpoint = std::derived_from<T, Breakpoint>;
 using BreakpointCallback = std::function<void(const Breakpoint&)>;
 
 //! A key to uniquely identify a breakpoint.
-using BreakpointKey = std::pair<BreakpointType, std::uintptr_t>;
\ No newline at end of file
+using BreakpointKey = std::pair<BreakpointType, std::uintptr_t>;
+
+
+/**
+ * @brief
+ * A software breakpoint specified relative to a module, such as `kernel32.dll!CreateFileW` or `app.exe+0x1234`.
+ * It is set whenever the module is loaded, at whatever base address.
+ */
+struct ModuleBreakpoint {
+    //! The file name of the module, ignoring case.
+    std::wstring module;
+
+    //! The name of an exported function, an ordinal following a hash sign, or an empty string to use the module base.
+    std::string function;
+
+    //! The offset from the function or the module base.
+    std::uintptr_t offset{ 0 };
+
+    //! Whether to set a one-time breakpoint.
+    bool single_shoot{ false };
+
+    BreakpointCallback callback{};
+};
+
+
+//! A set of threads that a breakpoint applies to.
+struct ThreadFilter {
+    //! Whether a thread is in the set.
+    bool Contains(std::uint32_t thread_id) const noexcept;
+
+    //! Sorted thread IDs.
+    std::vector<std::uint32_t> threads;
+
+    //! The number of hits by other threads, which have been ignored.
+    std::uint64_t filtered_hits{ 0 };
+};
+
+
+//! A policy to promote frequently hit software breakpoints to free hardware breakpoint slots.
+struct BreakpointPromotionPolicy {
+    //! Whether to promote software breakpoints.
+    bool enabled{ false };
+
+    //! The period in which hits are counted.
+    std::chrono::milliseconds window{ 100 };
+
+    //! The number of hits in a period to promote a software breakpoint.
+    std::size_t promotion_hits{ 64 };
+
+    //! A promoted breakpoint is demoted when it is hit fewer times in a period.
+    std::size_t demotion_hits{ 4 };
+};
+
+//! A software breakpoint moved between `INT3` instruction and a hardware breakpoint slot.
+struct BreakpointMigration {
+    std::uintptr_t address;
+
+    HardwareBreakpointSlot slot;
+
+    //! @p true if it has been promoted to the slot, @p false if it has been demoted to `INT3` instruction.
+    bool promoted;
+};
+
+//! The breakpoint migration callback.
+using BreakpointMigrationCallback =
+    std::function<void(const BreakpointMigration&)>;
\ No newline at end of file
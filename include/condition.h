@@ -0,0 +1,159 @@
+/**
+ * @file condition.h
+ * @brief Breakpoint conditions.
+ *
+ * @details
+ * A condition is an expression compiled into compact stack bytecode, for example:
+ *
+ * ```
+ * eax == 5 && dword[esp+8] > 0x1000
+ * ```
+ *
+ * It supports 32-bit registers, decimal and hexadecimal numbers,
+ * memory reads `byte[...]`, `word[...]`, `dword[...]` and `[...]` (a double word),
+ * and operators of C with the same precedence.
+ * All arithmetic is unsigned and 32-bit.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "register/register.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//! The maximum depth of the evaluation stack of a condition.
+inline constexpr std::size_t max_condition_stack_depth{ 32 };
+
+//! The maximum nesting depth of unary operators, parentheses and memory reads in a condition.
+inline constexpr std::size_t max_condition_nesting_depth{ 64 };
+
+//! The thread state where conditions are evaluated.
+class ConditionContext {
+public:
+    virtual ~ConditionContext() noexcept = default;
+
+    //! Read a register value.
+    virtual std::uint32_t ReadRegister(RegisterIndex index) const noexcept = 0;
+
+    /**
+     * @brief Read memory.
+     *
+     * @param address The memory address.
+     * @param[out] buffer The buffer, whose size is the size to read.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    virtual bool ReadMemory(std::uintptr_t address,
+                            std::span<std::byte> buffer) noexcept = 0;
+};
+
+//! A compiled condition.
+class Condition {
+public:
+    /**
+     * @brief Compile an expression.
+     *
+     * @param expression The expression.
+     * @exception std::runtime_error The expression is invalid.
+     */
+    explicit Condition(std::string_view expression);
+
+    //! Get the source expression.
+    std::string_view Expression() const noexcept;
+
+    //! Get the bytecode.
+    std::span<const std::uint8_t> Bytecode() const noexcept;
+
+    /**
+     * @brief Evaluate the expression.
+     *
+     * @param context The thread state.
+     * @return The value, or @p std::nullopt if memory cannot be read or a division by zero occurs.
+     */
+    std::optional<std::uint32_t> Evaluate(
+        ConditionContext& context) const noexcept;
+
+    /**
+     * @brief
+     * Whether the condition is true.
+     * A condition that cannot be evaluated is regarded as true,
+     * so breakpoints are not missed silently.
+     *
+     * @param context The thread state.
+     */
+    bool Matches(ConditionContext& context) const noexcept;
+
+private:
+    //! Bytecode instructions.
+    enum class Opcode : std::uint8_t {
+        //! Push a 32-bit immediate.
+        Constant,
+        //! Push a register, whose index is a one-byte immediate.
+        Register,
+        //! Replace the address at the top with the byte it points to.
+        LoadByte,
+        LoadWord,
+        LoadDword,
+        Negate,
+        Complement,
+        LogicalNot,
+        //! Convert the top to zero or one.
+        Boolean,
+        Multiply,
+        Divide,
+        Modulo,
+        Add,
+        Subtract,
+        ShiftLeft,
+        ShiftRight,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual,
+        BitAnd,
+        BitXor,
+        BitOr,
+        //! Jump to a two-byte target and keep the top if it is zero, otherwise pop it.
+        JumpIfFalse,
+        //! Jump to a two-byte target and keep the top if it is not zero, otherwise pop it.
+        JumpIfTrue
+    };
+
+    class Compiler;
+
+    /**
+     * @brief Execute bytecode.
+     *
+     * @param code The bytecode, whose stack depth has been checked.
+     * @param context The thread state.
+     * @return The value at the top of the stack, or @p std::nullopt if an error occurs.
+     */
+    static std::optional<std::uint32_t> Execute(
+        std::span<const std::uint8_t> code,
+        ConditionContext& context) noexcept;
+
+    std::string expression_;
+
+    std::vector<std::uint8_t> code_{};
+};
+
+//! An optional reference to a condition.
+using OptionalCondition = std::optional<std::reference_wrapper<const Condition>>;
\ No newline at end of file
@@ -15,14 +15,26 @@
 #pragma once
 
 #include "process.h"
+#include "profiler.h"
+#include "slot_table.h"
 #include "thread.h"
+#include "trace.h"
+#include "tracepoint.h"
 
 #include <Windows.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory_resource>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
+
+//! The size of the buffer reserved for the transient allocations of a debug event.
+inline constexpr std::size_t event_arena_size{ 0x4000 };
 
 //! A basic debugger.
 class Debugger {
@@ -50,8 +62,11 @@ public:
      * @brief Attach to a process to debug.
      *
      * @param process_id The process ID.
+     * @param fast
+     * Whether to defer create-thread callbacks of existing threads until the system breakpoint,
+     * so heavily threaded processes stop at the first command sooner.
      */
-    void Attach(std::uint32_t process_id);
+    void Attach(std::uint32_t process_id, bool fast = false);
 
     //! Start the debug loop.
     void Start();
@@ -69,8 +84,27 @@ public:
     //! Terminate the process.
     void Stop();
 
+    /**
+     * @brief
+     * Set whether to freeze other threads of a process while a thread performs an internal step,
+     * so they cannot run past a temporarily removed breakpoint.
+     */
+    void SetFreezeOthers(bool enabled) noexcept;
+
+    /**
+     * @brief
+     * Set a breakpoint relative to a module in all current and future processes.
+     * It is installed when the module is loaded.
+     *
+     * @param breakpoint The module breakpoint.
+     */
+    void SetModuleBreakpoint(const ModuleBreakpoint& breakpoint);
+
 protected:
-    using ProcessMap = std::unordered_map<std::uint32_t, Process>;
+    using ProcessMap = SlotTable<Process, 8>;
+
+    //! Trace sessions indexed by thread IDs.
+    using TraceMap = std::unordered_map<std::uint32_t, Tracer>;
 
     /*************** Debug event callbacks ***************/
 
@@ -121,11 +155,35 @@ protected:
     //! The callback for hardware breakpoint encounters.
     virtual void OnHardwareBreakpoint(std::uintptr_t address);
 
+    //! The callback for return breakpoint encounters of step-overs and step-outs.
+    virtual void OnReturnBreakpoint(std::uintptr_t address);
+
+    /**
+     * @brief
+     * The callback for tracepoint encounters.
+     * It captures a record and continues without calling any user callbacks.
+     */
+    virtual void OnTracepoint(std::uintptr_t address);
+
     /*****************************************************/
 
     //! Clear debug cache.
     virtual void ClearCache() noexcept;
 
+    /**
+     * @brief
+     * Arm the pending step-over or step-out of the debugged thread,
+     * setting a return breakpoint or downgrading it to a step-into.
+     */
+    void ArmReturnStep();
+
+    /**
+     * @brief
+     * Complete the armed step-over or step-out of the debugged thread
+     * if it has left the frame without returning, such as by an exception handler.
+     */
+    void ExpireReturnStep();
+
     /**
      * @brief Set the debugged process and thread.
      *
@@ -138,6 +196,19 @@ protected:
     //! Reset the debugged process and thread to null.
     void ResetDebuggedProcessThread() noexcept;
 
+    /**
+     * @brief
+     * Freeze other threads if the debugged thread is going to perform an internal step,
+     * otherwise resume threads frozen for a previous one.
+     */
+    void UpdateFrozenThreads();
+
+    //! Resume threads frozen for an internal step.
+    void ThawFrozenThreads();
+
+    //! Call create-thread callbacks deferred by a fast attach for threads that are still alive.
+    void NotifyDeferredThreads();
+
     //! Get the debugged process.
     Process& DebuggedProcess() const noexcept;
 
@@ -167,6 +238,143 @@ protected:
      */
     OptionalProcess FindProcess(std::uint32_t id) const noexcept;
 
+    /**
+     * @brief
+     * Get the arena for transient allocations of the current debug event,
+     * such as memory data from the memory-resource overloads of @p Process.
+     *
+     * @warning Memory allocated from it is released before the next debug event is waited for.
+     */
+    std::pmr::memory_resource& EventArena() noexcept;
+
+    /**
+     * @brief
+     * Rewind the debugged thread to a shared `INT3` instruction and step over the original instruction,
+     * setting `INT3` instruction back afterwards.
+     *
+     * @param registers The registers of the thread, containing at least control registers.
+     * @param address The memory address of `INT3` instruction.
+     */
+    void StepOverInt3(Registers& registers, std::uintptr_t address);
+
+    /**
+     * @brief
+     * Handle a software breakpoint promoted to a hardware breakpoint slot and hit by the debugged thread.
+     * The thread resumes with the resume flag instead of stepping over the breakpoint.
+     *
+     * @param breakpoint The software breakpoint.
+     * @param registers The registers of the thread, containing at least control and integer registers.
+     */
+    void OnPromotedBreakpoint(const SoftwareBreakpoint& breakpoint,
+                              const Registers& registers);
+
+    /**
+     * @brief Capture a tracepoint record of the debugged thread.
+     *
+     * @param tracepoint The tracepoint.
+     * @param registers The registers of the thread, containing at least control and integer registers.
+     */
+    void CaptureTracepoint(const Tracepoint& tracepoint,
+                           const Registers& registers) noexcept;
+
+    /**
+     * @brief Whether the condition of a breakpoint hit by the debugged thread is true.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param registers The registers of the thread, containing at least control and integer registers.
+     * @return @p true if the condition is true or the breakpoint has no condition, otherwise @p false.
+     */
+    bool MatchBreakpointCondition(BreakpointKey breakpoint,
+                                  const Registers& registers) const noexcept;
+
+    /***************** Instruction trace *****************/
+
+    /**
+     * @brief
+     * Start recording the instructions executed by a thread of the debugged process.
+     * The thread is single-stepped until the trace is stopped or the thread exits.
+     * Calls leaving the traced range run at full speed until they return.
+     *
+     * @param thread The thread.
+     * @param file_path The trace file path.
+     * @param options Trace options.
+     */
+    void StartTrace(Thread& thread, std::wstring_view file_path,
+                    const TraceOptions& options = {});
+
+    /**
+     * @brief Stop tracing a thread and close its trace file.
+     *
+     * @param thread_id The thread ID.
+     */
+    bool StopTrace(std::uint32_t thread_id);
+
+    //! Whether a thread is being traced.
+    bool Tracing(std::uint32_t thread_id) const noexcept;
+
+    /**
+     * @brief Record the current instruction of the debugged thread if it is being traced.
+     *
+     * @return Whether the single step belongs to a trace.
+     */
+    bool TraceStep();
+
+    /**
+     * @brief
+     * Resume tracing the debugged thread
+     * if it has returned from a call skipped by the trace.
+     *
+     * @param address The current instruction address.
+     * @param stack The current stack pointer.
+     * @return Whether the trace should be resumed by @p ResumeTrace.
+     */
+    bool ReachedTraceSkip(std::uintptr_t address, std::uintptr_t stack);
+
+    //! Record the current instruction of the debugged thread and keep stepping.
+    void ResumeTrace();
+
+    /**
+     * @brief
+     * Record the current instruction of a thread of the debugged process and keep stepping,
+     * or start skipping a call if it has left the traced range.
+     *
+     * @param thread The thread.
+     * @param tracer The trace session of the thread.
+     */
+    void RecordTrace(Thread& thread, Tracer& tracer);
+
+    /**
+     * @brief Close a trace session and release its return breakpoint.
+     *
+     * @param thread_id The thread ID.
+     */
+    bool RemoveTrace(std::uint32_t thread_id);
+
+    /***************** Sampling profile ******************/
+
+    /**
+     * @brief
+     * Start profiling the debugged process.
+     * While it is running, the debug loop suspends it periodically to sample the stacks of its threads.
+     *
+     * @param options Profile options.
+     */
+    void StartProfile(const ProfileOptions& options = {});
+
+    //! Stop profiling, keeping the collected stacks.
+    void StopProfile() noexcept;
+
+    //! Get the profiler, or @p nullptr if no profile has been started.
+    const Profiler* Profile() const noexcept;
+
+    //! Get the timeout of waiting for a debug event, so the next sample is not delayed.
+    std::uint32_t ProfileTimeout() const noexcept;
+
+    //! Take a sample if it is due, or stop profiling if the process has exited.
+    void SampleProfile();
+
+    /*****************************************************/
+
 
     //! Whether the debug loop is running.
     volatile bool debugging_{ false };
@@ -180,6 +388,18 @@ protected:
     //! Whether the main process has exited.
     volatile bool main_process_exited_{ false };
 
+    //! Whether the debugger is attaching to a process in fast-attach mode.
+    bool fast_attach_{ false };
+
+    //! Whether to freeze other threads while a thread performs an internal step.
+    bool freeze_others_{ false };
+
+    //! The ID of the process whose threads are frozen, or zero if there is none.
+    std::uint32_t frozen_process_id_{ 0 };
+
+    //! The threads whose create-thread callbacks are deferred until the system breakpoint.
+    std::vector<std::uint32_t> deferred_threads_{};
+
     STARTUPINFOW main_startup_{};
 
     PROCESS_INFORMATION main_process_{};
@@ -194,9 +414,32 @@ protected:
     //! The debugged process.
     OptionalProcess debugged_process_{};
 
+    //! The handle to the last debugged process, checked before looking up the process ID.
+    SlotHandle last_process_{};
+
     //! The debugged thread.
     OptionalThread debugged_thread_{};
 
+    //! Instruction trace sessions.
+    TraceMap traces_{};
+
+    //! The sampling profiler.
+    std::optional<Profiler> profiler_{};
+
+    //! Module breakpoints copied into each new process.
+    std::vector<ModuleBreakpoint> module_breakpoints_{};
+
+    //! Records captured by tracepoints.
+    TracepointBuffer tracepoint_records_{};
+
+    //! The buffer reserved for the event arena.
+    std::array<std::byte, event_arena_size> event_arena_buffer_;
+
+    //! A monotonic arena for transient allocations, released at the start of each debug loop iteration.
+    std::pmr::monotonic_buffer_resource event_arena_{
+        event_arena_buffer_.data(), event_arena_buffer_.size()
+    };
+
 private:
     /****************** Other callbacks ******************/
 
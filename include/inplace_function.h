@@ -0,0 +1,143 @@
+/**
+ * @file inplace_function.h
+ * @brief Function wrappers storing callables without heap allocation.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+//! The default size of the buffer storing a callable in @p InplaceFunction.
+inline constexpr std::size_t inplace_function_capacity{ 4 * sizeof(void*) };
+
+template <typename Signature,
+          std::size_t capacity = inplace_function_capacity>
+class InplaceFunction;
+
+/**
+ * @brief
+ * A move-only function wrapper storing its callable in an internal buffer.
+ * Callables larger than the buffer are rejected at compile time instead of being allocated on the heap.
+ */
+template <typename R, typename... Args, std::size_t capacity>
+class InplaceFunction<R(Args...), capacity> {
+public:
+    InplaceFunction() noexcept = default;
+
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F>
+        requires(!std::same_as<std::remove_cvref_t<F>, InplaceFunction>
+                 && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& callable) noexcept(
+        std::is_nothrow_constructible_v<std::decay_t<F>, F>) {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= capacity,
+                      "The callable is too large to be stored in place.");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                      "The callable is over-aligned.");
+        static_assert(std::is_nothrow_move_constructible_v<Callable>,
+                      "The callable must be nothrow move constructible.");
+
+        ::new (static_cast<void*>(storage_))
+            Callable(std::forward<F>(callable));
+        invoke_ = [](void* const storage, Args&&... args) -> R {
+            return std::invoke(*static_cast<Callable*>(storage),
+                               std::forward<Args>(args)...);
+        };
+        // Trivial callables are moved by copying the buffer and need no management.
+        if constexpr (!std::is_trivially_copyable_v<Callable>
+                      || !std::is_trivially_destructible_v<Callable>) {
+            manage_ = [](void* const target, void* const source) noexcept {
+                auto& callable{ *static_cast<Callable*>(source) };
+                if (target) {
+                    ::new (target) Callable(std::move(callable));
+                }
+
+                callable.~Callable();
+            };
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        Reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() noexcept {
+        Reset();
+    }
+
+    R operator()(Args... args) const {
+        return invoke_(storage_, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept {
+        return invoke_ != nullptr;
+    }
+
+private:
+    using Invoker = R (*)(void*, Args&&...);
+
+    //! Move a callable from @p source to @p target, or destroy it if @p target is null.
+    using Manager = void (*)(void* target, void* source) noexcept;
+
+    void MoveFrom(InplaceFunction& other) noexcept {
+        if (other.manage_) {
+            other.manage_(storage_, other.storage_);
+        } else if (other.invoke_) {
+            std::memcpy(storage_, other.storage_, capacity);
+        }
+
+        invoke_ = std::exchange(other.invoke_, nullptr);
+        manage_ = std::exchange(other.manage_, nullptr);
+    }
+
+    void Reset() noexcept {
+        if (manage_) {
+            manage_(nullptr, storage_);
+        }
+
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    alignas(std::max_align_t) mutable std::byte storage_[capacity];
+
+    Invoker invoke_{ nullptr };
+
+    Manager manage_{ nullptr };
+};
\ No newline at end of file
@@ -0,0 +1,232 @@
+/**
+ * @file instruction.h
+ * @brief The x86 32-bit instruction decoder.
+ *
+ * @details
+ * A table-driven length and operand decoder for IA-32 instructions.
+ * It does not disassemble instructions into text,
+ * but finds instruction boundaries and classifies the control flow.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "register/register.h"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+
+//! The maximum length of an x86 instruction.
+inline constexpr std::size_t max_instruction_length{ 15 };
+
+//! The control flow of an instruction.
+enum class InstructionFlow {
+    //! The execution continues with the next instruction.
+    Sequential,
+    //! An unconditional jump, such as `JMP rel32`.
+    Jump,
+    //! A conditional jump, such as `JZ rel8`, `JECXZ` or `LOOP`.
+    ConditionalJump,
+    //! A call, such as `CALL rel32` or `CALL ptr16:32`.
+    Call,
+    //! An indirect jump, such as `JMP r/m32`.
+    IndirectJump,
+    //! An indirect call, such as `CALL r/m32`.
+    IndirectCall,
+    //! A return, such as `RET`, `RETF` or `IRET`.
+    Return,
+    //! An interrupt or a system call, such as `INT3` or `SYSENTER`.
+    Interrupt
+};
+
+//! The opcode map of an instruction.
+enum class OpcodeMap {
+    //! One-byte opcodes.
+    Primary,
+    //! Two-byte opcodes, escaped by `0F`.
+    Secondary,
+    //! Three-byte opcodes, escaped by `0F 38`.
+    Tertiary38,
+    //! Three-byte opcodes, escaped by `0F 3A`.
+    Tertiary3A
+};
+
+//! Instruction prefixes.
+enum class InstructionPrefix : std::uint16_t {
+    None = 0,
+    Lock = 1 << 0,
+    Repne = 1 << 1,
+    Rep = 1 << 2,
+    OperandSize = 1 << 3,
+    AddressSize = 1 << 4,
+    Segment = 1 << 5,
+    Vex = 1 << 6
+};
+
+//! A memory operand encoded by `ModRM` and `SIB` bytes.
+struct MemoryOperand {
+    std::optional<RegisterIndex> base;
+
+    std::optional<RegisterIndex> index;
+
+    //! The scale factor of the index register: 1, 2, 4 or 8.
+    std::uint8_t scale{ 1 };
+
+    std::int32_t displacement{ 0 };
+};
+
+//! A decoded instruction.
+struct Instruction {
+    //! Whether the instruction has a prefix.
+    constexpr bool HasPrefix(const InstructionPrefix prefix) const noexcept {
+        return (prefixes & static_cast<std::uint16_t>(prefix)) != 0;
+    }
+
+    //! Whether the instruction is a relative jump or call.
+    constexpr bool IsRelativeBranch() const noexcept {
+        return relative;
+    }
+
+    //! Whether the instruction is a call.
+    constexpr bool IsCall() const noexcept {
+        return flow == InstructionFlow::Call
+               || flow == InstructionFlow::IndirectCall;
+    }
+
+    //! Whether the instruction is a return.
+    constexpr bool IsReturn() const noexcept {
+        return flow == InstructionFlow::Return;
+    }
+
+    //! The memory address of the instruction.
+    std::uintptr_t address{ 0 };
+
+    //! The total length.
+    std::uint8_t length{ 0 };
+
+    //! The number of legacy prefix bytes.
+    std::uint8_t prefix_count{ 0 };
+
+    //! A combination of @p InstructionPrefix values.
+    std::uint16_t prefixes{ 0 };
+
+    //! The segment override prefix, if there is one.
+    std::uint8_t segment{ 0 };
+
+    OpcodeMap map{ OpcodeMap::Primary };
+
+    //! The last opcode byte.
+    std::uint8_t opcode{ 0 };
+
+    bool has_modrm{ false };
+
+    std::uint8_t modrm{ 0 };
+
+    bool has_sib{ false };
+
+    std::uint8_t sib{ 0 };
+
+    //! The size of the displacement in bytes: 0, 1, 2 or 4.
+    std::uint8_t displacement_size{ 0 };
+
+    //! The sign-extended displacement.
+    std::int32_t displacement{ 0 };
+
+    //! The size of the immediate in bytes: 0, 1, 2, 3, 4 or 6.
+    std::uint8_t immediate_size{ 0 };
+
+    //! The first immediate, or the relative offset of a branch.
+    std::uint32_t immediate{ 0 };
+
+    //! The second immediate of `ENTER` and the selector of far pointers.
+    std::uint16_t immediate2{ 0 };
+
+    InstructionFlow flow{ InstructionFlow::Sequential };
+
+    //! Whether the branch target is encoded as a relative offset.
+    bool relative{ false };
+
+    //! The target of a relative branch.
+    std::uintptr_t target{ 0 };
+
+    //! Whether the instruction reads or writes memory, explicitly or implicitly (stack and string operations).
+    bool memory_access{ false };
+
+    //! The explicit memory operand, if there is one.
+    std::optional<MemoryOperand> memory;
+};
+
+/**
+ * @brief Decode an instruction.
+ *
+ * @param code The machine code, at most @p max_instruction_length bytes are used.
+ * @param address The memory address of the instruction, used to calculate branch targets.
+ * @return The instruction, or @p std::nullopt if the code is invalid or truncated.
+ */
+std::optional<Instruction> DecodeInstruction(std::span<const std::byte> code,
+                                             std::uintptr_t address = 0) noexcept;
+
+/**
+ * @brief Get the length of an instruction.
+ *
+ * @param code The machine code.
+ * @return The length, or zero if the code is invalid or truncated.
+ */
+std::size_t InstructionLength(std::span<const std::byte> code) noexcept;
+
+/**
+ * @brief Calculate the effective address of a memory operand, without the segment base.
+ *
+ * @param memory The memory operand.
+ * @param read A function reading the value of a register.
+ */
+template <std::invocable<RegisterIndex> Reader>
+constexpr std::uintptr_t EffectiveAddress(const MemoryOperand& memory,
+                                          Reader&& read) noexcept {
+    std::uint32_t address{ static_cast<std::uint32_t>(memory.displacement) };
+    if (memory.base) {
+        address += static_cast<std::uint32_t>(read(*memory.base));
+    }
+
+    if (memory.index) {
+        address += static_cast<std::uint32_t>(read(*memory.index)) * memory.scale;
+    }
+
+    return address;
+}
+
+/**
+ * @brief Calculate the effective address of the explicit memory operand, without the segment base.
+ *
+ * @param instruction The instruction.
+ * @param read A function reading the value of a register.
+ * @return The address, or @p std::nullopt if the instruction has no memory operand.
+ */
+template <std::invocable<RegisterIndex> Reader>
+constexpr std::optional<std::uintptr_t> EffectiveAddress(
+    const Instruction& instruction, Reader&& read) noexcept {
+    if (!instruction.memory) {
+        return std::nullopt;
+    }
+
+    auto address{ EffectiveAddress(*instruction.memory,
+                                   std::forward<Reader>(read)) };
+    if (instruction.HasPrefix(InstructionPrefix::AddressSize)) {
+        address &= 0xFFFF;
+    }
+
+    return address;
+}
\ No newline at end of file
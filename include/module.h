@@ -0,0 +1,136 @@
+/**
+ * @file module.h
+ * @brief Loaded modules of processes.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "memory.h"
+#include "pe.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//! The size of module headers read at once, enough for the headers of most modules.
+inline constexpr std::size_t module_header_read_size{ memory_page_size };
+
+//! A loaded module.
+struct Module {
+    //! The base address.
+    std::uintptr_t base{ 0 };
+
+    //! The size in memory.
+    std::size_t size{ 0 };
+
+    //! The address of the entry point, or zero if there is no entry point.
+    std::uintptr_t entry{ 0 };
+
+    //! The file path, which may be empty if it is unknown.
+    std::wstring path;
+
+    std::vector<ModuleSection> sections;
+
+    //! The offset of the export directory from the base address.
+    std::uint32_t export_offset{ 0 };
+
+    //! The size of the export directory, or zero if there are no exports.
+    std::uint32_t export_size{ 0 };
+
+    //! The exports, which are parsed when they are first used.
+    mutable std::unique_ptr<const ExportTable> exports{};
+
+    //! Get the file name from the path.
+    std::wstring_view Name() const noexcept;
+
+    //! Whether an address is inside the module.
+    bool Contains(std::uintptr_t address) const noexcept;
+};
+
+//! An optional reference to a module.
+using OptionalModule = std::optional<std::reference_wrapper<const Module>>;
+
+//! An address inside a module.
+struct ModuleAddress {
+    const Module* module;
+
+    //! The offset from the module base.
+    std::uintptr_t offset;
+};
+
+//! Convert a module name to lowercase, so it can be compared without case.
+std::wstring LowerModuleName(std::wstring_view name);
+
+/**
+ * @brief
+ * The modules of a process sorted by base address.
+ * Modules never overlap, so finding the module of an address is a binary search.
+ *
+ * @warning References to modules are invalidated when modules are added or removed.
+ */
+class ModuleTable {
+public:
+    /**
+     * @brief Add a module, replacing an existing one at the same base address.
+     *
+     * @param module The module.
+     * @return The added module.
+     */
+    const Module& Insert(Module module);
+
+    /**
+     * @brief Remove a module.
+     *
+     * @param base The base address.
+     */
+    bool Erase(std::uintptr_t base) noexcept;
+
+    /**
+     * @brief Find the module containing an address.
+     *
+     * @param address The address.
+     */
+    OptionalModule Find(std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief Find a module by its file name, ignoring case.
+     *
+     * @param name The file name, such as `kernel32.dll`.
+     */
+    OptionalModule FindByName(std::wstring_view name) const noexcept;
+
+    /**
+     * @brief Convert an address to a module and an offset from its base.
+     *
+     * @param address The address.
+     */
+    std::optional<ModuleAddress> Locate(std::uintptr_t address) const noexcept;
+
+    //! Get the address ranges of executable sections.
+    std::vector<MemoryRange> CodeRanges() const;
+
+    std::span<const Module> Modules() const noexcept;
+
+    std::size_t Size() const noexcept;
+
+    void Clear() noexcept;
+
+private:
+    std::vector<Module> modules_{};
+};
\ No newline at end of file
@@ -0,0 +1,292 @@
+/**
+ * @file pe.h
+ * @brief Portable executable layouts and parsers of their headers and exports.
+ *
+ * @details
+ * Layouts are defined here instead of taken from `Windows.h`,
+ * so parsers work on module data on any little-endian system.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+static_assert(std::endian::native == std::endian::little,
+              "Portable executable layouts are read in place.");
+
+//! Layouts of 32-bit portable executables.
+namespace pe {
+
+inline constexpr std::uint16_t dos_signature{ 0x5A4D };
+inline constexpr std::uint32_t nt_signature{ 0x0000'4550 };
+inline constexpr std::uint16_t optional_header32_magic{ 0x010B };
+
+inline constexpr std::size_t data_directory_count{ 16 };
+inline constexpr std::size_t export_directory_index{ 0 };
+
+inline constexpr std::size_t section_name_size{ 8 };
+
+//! The section flag of executable code.
+inline constexpr std::uint32_t section_executable{ 0x2000'0000 };
+
+struct DosHeader {
+    std::uint16_t magic;
+    std::array<std::uint16_t, 29> reserved;
+
+    //! The file offset of the NT headers.
+    std::int32_t nt_offset;
+};
+
+struct FileHeader {
+    std::uint16_t machine;
+    std::uint16_t section_count;
+    std::uint32_t time_stamp;
+    std::uint32_t symbol_table_offset;
+    std::uint32_t symbol_count;
+    std::uint16_t optional_header_size;
+    std::uint16_t characteristics;
+};
+
+struct DataDirectory {
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+struct OptionalHeader32 {
+    std::uint16_t magic;
+    std::uint8_t major_linker_version;
+    std::uint8_t minor_linker_version;
+    std::uint32_t code_size;
+    std::uint32_t initialized_data_size;
+    std::uint32_t uninitialized_data_size;
+    std::uint32_t entry;
+    std::uint32_t code_base;
+    std::uint32_t data_base;
+    std::uint32_t image_base;
+    std::uint32_t section_alignment;
+    std::uint32_t file_alignment;
+    std::uint16_t major_os_version;
+    std::uint16_t minor_os_version;
+    std::uint16_t major_image_version;
+    std::uint16_t minor_image_version;
+    std::uint16_t major_subsystem_version;
+    std::uint16_t minor_subsystem_version;
+    std::uint32_t win32_version;
+    std::uint32_t image_size;
+    std::uint32_t headers_size;
+    std::uint32_t checksum;
+    std::uint16_t subsystem;
+    std::uint16_t dll_characteristics;
+    std::uint32_t stack_reserve_size;
+    std::uint32_t stack_commit_size;
+    std::uint32_t heap_reserve_size;
+    std::uint32_t heap_commit_size;
+    std::uint32_t loader_flags;
+    std::uint32_t directory_count;
+    std::array<DataDirectory, data_directory_count> directories;
+};
+
+struct NtHeaders32 {
+    std::uint32_t signature;
+    FileHeader file_header;
+    OptionalHeader32 optional_header;
+};
+
+struct SectionHeader {
+    std::array<char, section_name_size> name;
+    std::uint32_t virtual_size;
+    std::uint32_t offset;
+    std::uint32_t raw_size;
+    std::uint32_t raw_offset;
+    std::uint32_t relocations_offset;
+    std::uint32_t line_numbers_offset;
+    std::uint16_t relocation_count;
+    std::uint16_t line_number_count;
+    std::uint32_t characteristics;
+};
+
+struct ExportDirectory {
+    std::uint32_t characteristics;
+    std::uint32_t time_stamp;
+    std::uint16_t major_version;
+    std::uint16_t minor_version;
+
+    //! The offset of the module name.
+    std::uint32_t name;
+
+    //! The ordinal of the first function.
+    std::uint32_t ordinal_base;
+
+    std::uint32_t function_count;
+    std::uint32_t name_count;
+    std::uint32_t functions;
+    std::uint32_t names;
+    std::uint32_t name_ordinals;
+};
+
+static_assert(sizeof(DosHeader) == 0x40);
+static_assert(offsetof(DosHeader, nt_offset) == 0x3C);
+static_assert(sizeof(FileHeader) == 20);
+static_assert(sizeof(OptionalHeader32) == 224);
+static_assert(offsetof(NtHeaders32, optional_header) == 24);
+static_assert(sizeof(SectionHeader) == 40);
+static_assert(sizeof(ExportDirectory) == 40);
+
+}  // namespace pe
+
+//! A section of a module.
+struct ModuleSection {
+    std::string name;
+
+    //! The offset from the module base.
+    std::uint32_t offset{ 0 };
+
+    //! The size in memory.
+    std::uint32_t size{ 0 };
+
+    //! Section flags, such as @p pe::section_executable.
+    std::uint32_t characteristics{ 0 };
+
+    //! Whether the section contains executable code.
+    bool Executable() const noexcept;
+};
+
+//! Information parsed from portable executable headers.
+struct PeHeaders {
+    //! The size of the image in memory.
+    std::uint32_t image_size{ 0 };
+
+    //! The size of data from the start of the module to the end of the section table.
+    std::size_t required_size{ 0 };
+
+    //! The offset of the entry point from the module base, or zero if there is no entry point.
+    std::uint32_t entry{ 0 };
+
+    //! The offset of the export directory from the module base.
+    std::uint32_t export_offset{ 0 };
+
+    //! The size of the export directory, or zero if there are no exports.
+    std::uint32_t export_size{ 0 };
+
+    std::vector<ModuleSection> sections;
+};
+
+/**
+ * @brief Parse portable executable headers.
+ *
+ * @param data Memory from the start of a module.
+ * @return
+ * The headers, or @p std::nullopt if they are invalid.
+ * If the section table extends past the data, the headers contain no sections
+ * and @p required_size tells how much data is needed.
+ */
+std::optional<PeHeaders> ParsePeHeaders(std::span<const std::byte> data);
+
+//! An exported function.
+struct Export {
+    //! The name, or an empty string if the function is exported by ordinal only.
+    std::string name;
+
+    std::uint32_t ordinal{ 0 };
+
+    //! The offset from the module base, or the offset of the forwarder string.
+    std::uint32_t offset{ 0 };
+
+    //! The function a forwarder refers to, such as `NTDLL.RtlAllocateHeap`, or an empty string.
+    std::string forwarder;
+};
+
+//! An optional reference to an export.
+using OptionalExport = std::optional<std::reference_wrapper<const Export>>;
+
+/**
+ * @brief
+ * The exports of a module.
+ * Names are hashed for lookups, and offsets are sorted for finding the export containing an address.
+ */
+class ExportTable {
+public:
+    ExportTable() noexcept = default;
+
+    explicit ExportTable(std::vector<Export> exports);
+
+    /**
+     * @brief Find an export by name.
+     *
+     * @param name The case-sensitive name.
+     */
+    OptionalExport Find(std::string_view name) const noexcept;
+
+    //! Find an export by ordinal.
+    OptionalExport FindOrdinal(std::uint32_t ordinal) const noexcept;
+
+    /**
+     * @brief Find the export with the highest offset not above an offset, ignoring forwarders.
+     *
+     * @param offset The offset from the module base.
+     */
+    OptionalExport FindNearest(std::uint32_t offset) const noexcept;
+
+    //! Get exports sorted by ordinal.
+    std::span<const Export> Exports() const noexcept;
+
+    std::size_t Size() const noexcept;
+
+private:
+    struct NameHash {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const noexcept;
+    };
+
+    std::vector<Export> exports_{};
+
+    //! Indexes of named exports.
+    std::unordered_map<std::string, std::size_t, NameHash, std::equal_to<>>
+        names_{};
+
+    //! Indexes of exports other than forwarders, sorted by offset.
+    std::vector<std::size_t> offsets_{};
+};
+
+/**
+ * @brief Parse an export directory.
+ *
+ * @param data
+ * Memory of the export directory, which contains the directory,
+ * its address, name and ordinal arrays, and name strings.
+ * @param offset The offset of the directory from the module base.
+ * @return The exports, or @p std::nullopt if the directory is invalid.
+ */
+std::optional<ExportTable> ParseExportDirectory(std::span<const std::byte> data,
+                                                std::uint32_t offset);
+
+/**
+ * @brief Get the module name recorded in an export directory, such as `KERNEL32.dll`.
+ *
+ * @param data Memory of the export directory.
+ * @param offset The offset of the directory from the module base.
+ * @return The name, or @p std::nullopt if it is not within the data.
+ */
+std::optional<std::string> ParseExportName(std::span<const std::byte> data,
+                                           std::uint32_t offset);
\ No newline at end of file
@@ -15,19 +15,43 @@
 #pragma once
 
 #include "breakpoint.h"
+#include "condition.h"
+#include "instruction.h"
+#include "module.h"
+#include "slot_table.h"
 #include "thread.h"
+#include "tracepoint.h"
 
 #include <Windows.h>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <span>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+//! The registers of a thread captured by a snapshot.
+struct ThreadSnapshot {
+    std::uint32_t thread_id{ 0 };
+
+    //! The @p CONTEXT flags of captured register groups, or zero if the capture failed.
+    std::uint32_t context_flags{ 0 };
+
+    //! General-purpose registers, @p EIP and @p EFLAGS, indexed by @p HistoryRegister.
+    std::array<std::uint32_t, history_register_count> registers{};
+
+    //! @p DR0, @p DR1, @p DR2, @p DR3, @p DR6 and @p DR7.
+    std::array<std::uint32_t, 6> debug_registers{};
+};
+
 //! A process.
 class Process {
 public:
@@ -62,6 +86,36 @@ public:
     //! Resume the process.
     void Resume() const;
 
+    /**
+     * @brief Suspend all threads, stopping at the first failure.
+     *
+     * @param[out] suspended
+     * The IDs of suspended threads are appended, even if an exception is thrown.
+     */
+    void Suspend(std::vector<std::uint32_t>& suspended) const;
+
+    /**
+     * @brief Resume threads suspended by @p Suspend.
+     *
+     * @details
+     * Every thread is resumed even if some fail, then the first failure is rethrown.
+     * Threads that have been removed are skipped.
+     *
+     * @param suspended The IDs of suspended threads.
+     */
+    void Resume(std::span<const std::uint32_t> suspended) const;
+
+    /**
+     * @brief
+     * Capture the registers of all threads, which must be stopped, such as during a debug event.
+     *
+     * @param context_flags
+     * A combination of @p CONTEXT_CONTROL, @p CONTEXT_INTEGER and @p CONTEXT_DEBUG_REGISTERS.
+     * @return Snapshots in the order of threads.
+     */
+    std::vector<ThreadSnapshot> SnapshotAllThreads(
+        std::uint32_t context_flags = CONTEXT_CONTROL | CONTEXT_INTEGER) const;
+
     /**
      * @brief Find a thread.
      *
@@ -69,8 +123,8 @@ public:
      */
     OptionalThread FindThread(std::uint32_t id) const noexcept;
 
-    //! Create a thread.
-    void NewThread(Thread&& thread) noexcept;
+    //! Create a thread, setting promoted breakpoints in its debug registers.
+    void NewThread(Thread&& thread);
 
     /**
      * @brief Remove a thread.
@@ -79,6 +133,19 @@ public:
      */
     bool RemoveThread(std::uint32_t id) noexcept;
 
+    /**
+     * @brief
+     * Freeze all threads except one while it steps.
+     * Threads that are frozen or suspended are skipped,
+     * so consecutive steps of the same thread make no system calls.
+     *
+     * @param id The ID of the thread that keeps running.
+     */
+    void FreezeThreads(std::uint32_t id);
+
+    //! Resume all threads frozen by @p FreezeThreads.
+    void ThawThreads();
+
     //! Get the debugged thread.
     OptionalThread DebuggedThread() const noexcept;
 
@@ -101,6 +168,74 @@ public:
     //! Hit the system breakpoint.
     void HitSystemBreakpoint() noexcept;
 
+    /**
+     * @brief Get the path of a module reported by a debug event.
+     *
+     * @param file The file handle of the module, which may be null.
+     * @param image_name
+     * The address of a pointer to the module name in the process, which may be null,
+     * used if the path cannot be got from the file handle.
+     * @param unicode Whether the module name is a Unicode string.
+     * @return The path, or an empty string if it is unknown.
+     */
+    std::wstring ModulePath(HANDLE file, std::uintptr_t image_name,
+                            bool unicode) const;
+
+    /**
+     * @brief Add a loaded module, reading its headers from memory.
+     *
+     * @param base The base address.
+     * @param path
+     * The file path.
+     * If it is empty, the module is named after its export directory if possible.
+     * @param resource The memory resource for temporary buffers.
+     * @return The module, or @p std::nullopt if its headers cannot be read or are invalid.
+     */
+    OptionalModule LoadModule(
+        std::uintptr_t base, std::wstring path,
+        std::pmr::memory_resource& resource = *std::pmr::get_default_resource());
+
+    /**
+     * @brief
+     * Remove an unloaded module.
+     * Breakpoints set for module breakpoints in it are dropped without restoring memory,
+     * and are set again if it is reloaded.
+     *
+     * @param base The base address.
+     */
+    bool UnloadModule(std::uintptr_t base);
+
+    //! Get the loaded modules.
+    const ModuleTable& Modules() const noexcept;
+
+    /**
+     * @brief Get the exports of a loaded module, reading its export directory when they are first used.
+     *
+     * @param module The module.
+     * @return The exports, which are empty if the directory cannot be read or is invalid.
+     */
+    const ExportTable& Exports(const Module& module) const;
+
+    /**
+     * @brief Get the address of an exported function, following forwarders to other loaded modules.
+     *
+     * @param module The file name of the module, such as `kernel32.dll`.
+     * @param name The name of the function, or an ordinal following a hash sign, such as `#12`.
+     * @return The address, or @p std::nullopt if the module or the function cannot be found.
+     */
+    std::optional<std::uintptr_t> ResolveExport(std::wstring_view module,
+                                                std::string_view name) const;
+
+    /**
+     * @brief
+     * Describe an address by the nearest export before it, such as `kernel32.dll!CreateFileW+0x12`,
+     * or by its module, such as `app.exe+0x1234`.
+     *
+     * @param address The address.
+     * @return The description, or the hexadecimal address if it is outside any module.
+     */
+    std::string AddressName(std::uintptr_t address) const;
+
     //! Whether a memory address is valid.
     bool ValidMemory(std::uintptr_t address) const noexcept;
 
@@ -126,6 +261,18 @@ public:
     std::vector<std::byte> WriteMemorySafe(
         std::uintptr_t address, std::span<const std::byte> data) const;
 
+    /**
+     * @brief Safely write data to a memory area, allocating original data from a memory resource.
+     *
+     * @param address The memory address.
+     * @param data The data.
+     * @param resource The memory resource, such as the debugger's event arena.
+     * @return Original memory data.
+     */
+    std::pmr::vector<std::byte> WriteMemorySafe(
+        std::uintptr_t address, std::span<const std::byte> data,
+        std::pmr::memory_resource& resource) const;
+
     /**
      * @brief Unsafely write data to a memory area.
      *
@@ -136,6 +283,18 @@ public:
     std::vector<std::byte> WriteMemoryUnsafe(
         std::uintptr_t address, std::span<const std::byte> data) const;
 
+    /**
+     * @brief Unsafely write data to a memory area, allocating original data from a memory resource.
+     *
+     * @param address The memory address.
+     * @param data The data.
+     * @param resource The memory resource, such as the debugger's event arena.
+     * @return Original memory data.
+     */
+    std::pmr::vector<std::byte> WriteMemoryUnsafe(
+        std::uintptr_t address, std::span<const std::byte> data,
+        std::pmr::memory_resource& resource) const;
+
     /**
      * @brief Read data from a memory area.
      *
@@ -157,6 +316,28 @@ public:
     std::vector<std::byte> ReadMemorySafe(std::uintptr_t address,
                                           std::size_t size) const;
 
+    /**
+     * @brief Safely read data from a memory area, allocating it from a memory resource.
+     *
+     * @param address The memory address.
+     * @param size The size to read.
+     * @param resource The memory resource, such as the debugger's event arena.
+     * @return Memory data.
+     */
+    std::pmr::vector<std::byte> ReadMemorySafe(
+        std::uintptr_t address, std::size_t size,
+        std::pmr::memory_resource& resource) const;
+
+    /**
+     * @brief Safely read data from a memory area into a buffer, filtering out breakpoint bytes.
+     *
+     * @param address The memory address.
+     * @param[out] buffer The buffer, whose size is the size to read.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool ReadMemorySafe(std::uintptr_t address,
+                        std::span<std::byte> buffer) const noexcept;
+
     /**
      * @brief Unsafely read data from a memory area.
      *
@@ -168,7 +349,29 @@ public:
                                             std::size_t size) const;
 
     /**
-     * @brief Find a free hardware breakpoint slot.
+     * @brief Unsafely read data from a memory area, allocating it from a memory resource.
+     *
+     * @param address The memory address.
+     * @param size The size to read.
+     * @param resource The memory resource, such as the debugger's event arena.
+     * @return Memory data.
+     */
+    std::pmr::vector<std::byte> ReadMemoryUnsafe(
+        std::uintptr_t address, std::size_t size,
+        std::pmr::memory_resource& resource) const;
+
+    /**
+     * @brief Read and decode an instruction, filtering out breakpoint bytes.
+     *
+     * @param address The memory address.
+     * @return The instruction, or @p std::nullopt if it is invalid.
+     */
+    std::optional<Instruction> ReadInstruction(std::uintptr_t address) const;
+
+    /**
+     * @brief
+     * Find a free hardware breakpoint slot.
+     * A slot used by a promoted software breakpoint is free for hardware breakpoints.
      *
      * @param[out] slot A free hardware breakpoint slot.
      * @return @p true if there is a free hardware breakpoint slot, otherwise @p false.
@@ -209,6 +412,23 @@ public:
     std::optional<HardwareBreakpoint> FindHardwareBreakpoint(
         std::uintptr_t address) const noexcept;
 
+    /**
+     * @brief
+     * Set a software breakpoint relative to a module.
+     * It is set at once if the module has been loaded, and whenever the module is loaded later.
+     *
+     * @param breakpoint The module breakpoint.
+     */
+    void SetModuleBreakpoint(ModuleBreakpoint breakpoint);
+
+    /**
+     * @brief Delete all module breakpoints of a module, including software breakpoints set for them.
+     *
+     * @param module The file name of the module.
+     * @return @p true if there were module breakpoints, otherwise @p false.
+     */
+    bool DeleteModuleBreakpoints(std::wstring_view module);
+
     /**
      * @brief Set a software breakpoint.
      *
@@ -236,6 +456,228 @@ public:
     std::optional<SoftwareBreakpoint> FindSoftwareBreakpoint(
         std::uintptr_t address) const noexcept;
 
+    /**
+     * @brief
+     * Set a return breakpoint for a thread stepping over or out.
+     * If there is already one at the address, its reference count increases.
+     *
+     * @param address The return address.
+     */
+    void SetReturnBreakpoint(std::uintptr_t address);
+
+    /**
+     * @brief
+     * Release a return breakpoint.
+     * It is deleted when no more threads are waiting to return to the address.
+     *
+     * @param address The return address.
+     * @return @p true if it has been deleted, otherwise @p false.
+     */
+    bool DeleteReturnBreakpoint(std::uintptr_t address);
+
+    /**
+     * @brief Find a return breakpoint.
+     *
+     * @param address The return address.
+     */
+    std::optional<ReturnBreakpoint> FindReturnBreakpoint(
+        std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief
+     * Set a condition for a breakpoint, replacing the existing one.
+     * The breakpoint is ignored when the condition is false.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param expression The condition expression, such as `eax == 5 && dword[esp+8] > 0x1000`.
+     */
+    void SetBreakpointCondition(BreakpointKey breakpoint,
+                                std::string_view expression);
+
+    /**
+     * @brief Delete the condition of a breakpoint.
+     *
+     * @param breakpoint The breakpoint key.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool DeleteBreakpointCondition(BreakpointKey breakpoint) noexcept;
+
+    /**
+     * @brief Find the condition of a breakpoint.
+     *
+     * @param breakpoint The breakpoint key.
+     */
+    OptionalCondition FindBreakpointCondition(
+        BreakpointKey breakpoint) const noexcept;
+
+    /**
+     * @brief
+     * Restrict a breakpoint to some threads.
+     * Other threads resume from it without evaluating its condition or calling its callbacks.
+     * Hardware breakpoints are only set in the debug registers of the threads.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param thread_ids The thread IDs. An empty set removes the restriction.
+     */
+    void SetBreakpointThreads(BreakpointKey breakpoint,
+                              std::span<const std::uint32_t> thread_ids);
+
+    /**
+     * @brief Check whether a thread is excluded from a breakpoint, counting the filtered hit.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param thread_id The thread ID.
+     * @return @p true if the hit should be ignored, otherwise @p false.
+     */
+    bool FilterBreakpointHit(BreakpointKey breakpoint,
+                             std::uint32_t thread_id) noexcept;
+
+    /**
+     * @brief Get the number of hits ignored by the thread filter of a breakpoint.
+     *
+     * @param breakpoint The breakpoint key.
+     */
+    std::uint64_t FilteredBreakpointHits(
+        BreakpointKey breakpoint) const noexcept;
+
+    /**
+     * @brief
+     * Set the rules to report the hits of a breakpoint, such as ignore counts and sample rates.
+     * Hit counts are reset and the breakpoint is enabled again.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param policy The hit policy.
+     */
+    void SetBreakpointHitPolicy(BreakpointKey breakpoint,
+                                const BreakpointHitPolicy& policy);
+
+    /**
+     * @brief
+     * Count a hit of a breakpoint whose condition is true.
+     * The breakpoint is disabled after reporting the maximum number of hits.
+     *
+     * @param breakpoint The breakpoint key.
+     * @return The breakpoint if the hit should be reported, otherwise @p std::nullopt.
+     */
+    OptionalBreakpoint HitBreakpoint(BreakpointKey breakpoint);
+
+    /**
+     * @brief Enable a disabled breakpoint.
+     *
+     * @param breakpoint The breakpoint key.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool EnableBreakpoint(BreakpointKey breakpoint);
+
+    /**
+     * @brief Disable a breakpoint, keeping its data, condition and callback.
+     *
+     * @param breakpoint The breakpoint key.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool DisableBreakpoint(BreakpointKey breakpoint);
+
+    /**
+     * @brief
+     * Set the policy to promote frequently hit software breakpoints to free hardware breakpoint slots.
+     * A promoted breakpoint stops threads with one debug exception and without patching memory,
+     * and is demoted to `INT3` instruction when it cools down or its slot is needed.
+     * Disabling the policy demotes all promoted breakpoints.
+     *
+     * @param policy The promotion policy.
+     * @param callback A callback function reporting migrations.
+     */
+    void SetBreakpointPromotionPolicy(const BreakpointPromotionPolicy& policy,
+                                      BreakpointMigrationCallback callback = {});
+
+    /**
+     * @brief Count a hit of a software breakpoint, promoting it if it becomes hot.
+     *
+     * @param address The memory address.
+     */
+    void CountBreakpointHit(std::uintptr_t address);
+
+    //! Demote promoted breakpoints which have been hit rarely in the last period.
+    void AdaptBreakpoints();
+
+    /**
+     * @brief Find the hardware breakpoint slot of a promoted software breakpoint.
+     *
+     * @param address The memory address.
+     */
+    std::optional<HardwareBreakpointSlot> FindPromotedBreakpoint(
+        std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief Set a tracepoint, replacing the existing one at the same address.
+     *
+     * @param tracepoint The tracepoint.
+     */
+    void SetTracepoint(Tracepoint tracepoint);
+
+    /**
+     * @brief Delete a tracepoint.
+     *
+     * @param address The memory address.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool DeleteTracepoint(std::uintptr_t address);
+
+    /**
+     * @brief Find a tracepoint.
+     *
+     * @param address The memory address.
+     */
+    OptionalTracepoint FindTracepoint(std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief
+     * Set `INT3` instruction for a breakpoint.
+     * Breakpoints at the same address share the instruction.
+     * A promoted software breakpoint at the address is demoted first.
+     *
+     * @param address The memory address.
+     * @return The original byte.
+     */
+    std::byte AcquireInt3(std::uintptr_t address);
+
+    /**
+     * @brief
+     * Set `INT3` instructions for breakpoints at many addresses.
+     * Addresses on the same page are read and written together.
+     *
+     * @param addresses Sorted and unique memory addresses, none of which has a promoted breakpoint.
+     * @return The original bytes, or @p std::nullopt for addresses whose page cannot be patched.
+     */
+    std::vector<std::optional<std::byte>> AcquireInt3s(
+        std::span<const std::uintptr_t> addresses);
+
+    /**
+     * @brief
+     * Release `INT3` instruction of a breakpoint.
+     * It is deleted when no more breakpoints use it.
+     *
+     * @param address The memory address.
+     * @param restore Whether to restore the original byte when the instruction is deleted, which is @p false for unmapped memory.
+     */
+    void ReleaseInt3(std::uintptr_t address, bool restore = true);
+
+    /**
+     * @brief Find the original byte of `INT3` instruction set for breakpoints.
+     *
+     * @param address The memory address.
+     */
+    std::optional<std::byte> FindInt3(std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief
+     * Set `INT3` instruction again after a breakpoint has been stepped over,
+     * if it is still used by breakpoints.
+     *
+     * @param address The memory address.
+     */
+    void RestoreInt3(std::uintptr_t address) const;
+
     /**
      * @brief Set `INT3` instruction.
      *
@@ -254,14 +696,119 @@ public:
     void DeleteInt3(std::uintptr_t address, std::byte original_byte) const;
 
     /**
-     * @brief Execute and clear a breakpoint's callback.
+     * @brief Execute a breakpoint's callback, which is kept for later hits.
      *
      * @param breakpoint The breakpoint key.
      */
     void ExecuteBreakpointCallback(BreakpointKey breakpoint);
 
 private:
-    using ThreadMap = std::unordered_map<std::uint32_t, Thread>;
+    //! `INT3` instruction shared by breakpoints at the same address.
+    struct Int3Site {
+        std::byte original_byte;
+
+        //! The number of breakpoints using the instruction.
+        std::size_t references;
+    };
+
+    //! The hits of a software breakpoint in the current period.
+    struct BreakpointHeat {
+        std::chrono::steady_clock::time_point window_start{};
+
+        std::size_t hits{ 0 };
+    };
+
+    /**
+     * @brief Find the data of a breakpoint.
+     *
+     * @param breakpoint The breakpoint key.
+     * @return The breakpoint, or @p nullptr if it does not exist.
+     */
+    Breakpoint* FindBreakpoint(BreakpointKey breakpoint) noexcept;
+
+    /**
+     * @brief Find a hardware breakpoint slot used by neither hardware breakpoints nor promoted breakpoints.
+     *
+     * @param[out] slot An idle hardware breakpoint slot.
+     * @return @p true if there is an idle hardware breakpoint slot, otherwise @p false.
+     */
+    bool FindIdleHardwareBreakpointSlot(
+        HardwareBreakpointSlot& slot) const noexcept;
+
+    /**
+     * @brief Demote the coldest promoted breakpoint if it has been hit fewer times than a hotter one.
+     *
+     * @param hits The number of hits of the hotter breakpoint.
+     * @param[out] slot The released hardware breakpoint slot.
+     * @return @p true if a breakpoint has been demoted, otherwise @p false.
+     */
+    bool DemoteColdestBreakpoint(std::size_t hits, HardwareBreakpointSlot& slot);
+
+    /**
+     * @brief Move a software breakpoint from `INT3` instruction to a hardware breakpoint slot.
+     *
+     * @param address The memory address.
+     * @param slot The hardware breakpoint slot.
+     */
+    void PromoteBreakpoint(std::uintptr_t address, HardwareBreakpointSlot slot);
+
+    /**
+     * @brief Move a promoted breakpoint back to `INT3` instruction.
+     *
+     * @param address The memory address.
+     */
+    void DemoteBreakpoint(std::uintptr_t address);
+
+    /**
+     * @brief Set a breakpoint in the debug registers of the threads it applies to, clearing the slot in others.
+     *
+     * @param breakpoint The breakpoint key.
+     * @param slot The hardware breakpoint slot.
+     * @param access The hardware breakpoint type.
+     * @param size The hardware breakpoint size.
+     */
+    void SetBreakpointDebugRegisters(BreakpointKey breakpoint,
+                                     HardwareBreakpointSlot slot,
+                                     HardwareBreakpointType access,
+                                     HardwareBreakpointSize size) const;
+
+    /**
+     * @brief Throw an exception if `INT3` instructions of breakpoints are located in a memory area.
+     *
+     * @param address The memory address.
+     * @param size The memory size.
+     */
+    void CheckBreakpointOverlap(std::uintptr_t address, std::size_t size) const;
+
+    /**
+     * @brief Write a byte to memory without allocating buffers for original data.
+     *
+     * @param address The memory address.
+     * @param value The byte.
+     * @param[out] original_byte The original byte.
+     */
+    void PatchByte(std::uintptr_t address, std::byte value,
+                   std::byte* original_byte = nullptr) const;
+
+    /**
+     * @brief Replace `INT3` instructions in memory data with their original bytes.
+     *
+     * @param address The memory address of the data.
+     * @param data The data.
+     */
+    void RestoreOriginalBytes(std::uintptr_t address,
+                              std::span<std::byte> data) const noexcept;
+
+    /**
+     * @brief Set software breakpoints for module breakpoints in a loaded module.
+     *
+     * @param module The module.
+     * @param breakpoints Module breakpoints of the module.
+     */
+    void ResolveModuleBreakpoints(const Module& module,
+                                  std::span<const ModuleBreakpoint> breakpoints);
+
+    using ThreadMap = SlotTable<Thread>;
 
     template <ValidBreakpoint BP>
     using BreakpointMap = std::map<std::uintptr_t, BP>;
@@ -269,6 +816,25 @@ private:
     using HardwareBreakpointSlots =
         std::map<HardwareBreakpointSlot, HardwareBreakpoint*>;
 
+    using ReturnBreakpointMap = std::map<std::uintptr_t, ReturnBreakpoint>;
+
+    using TracepointMap = std::map<std::uintptr_t, Tracepoint>;
+
+    using Int3SiteMap = std::map<std::uintptr_t, Int3Site>;
+
+    using PromotedBreakpointMap =
+        std::map<std::uintptr_t, HardwareBreakpointSlot>;
+
+    using BreakpointHeatMap = std::map<std::uintptr_t, BreakpointHeat>;
+
+    //! Module breakpoints indexed by lowercase module names.
+    using ModuleBreakpointMap =
+        std::unordered_map<std::wstring, std::vector<ModuleBreakpoint>>;
+
+    //! Addresses of software breakpoints set for module breakpoints, indexed by module base addresses.
+    using ResolvedBreakpointMap =
+        std::unordered_map<std::uintptr_t, std::vector<std::uintptr_t>>;
+
     HANDLE handle_;
 
     std::uint32_t id_;
@@ -286,13 +852,45 @@ private:
     //! The debugged thread.
     OptionalThread debugged_thread_{};
 
+    //! The threads frozen by @p FreezeThreads.
+    std::vector<std::uint32_t> frozen_threads_{};
+
+    //! The handle to the last debugged thread, checked before looking up the thread ID.
+    SlotHandle last_thread_{};
+
     BreakpointMap<SoftwareBreakpoint> software_breakpoints_{};
 
     BreakpointMap<HardwareBreakpoint> hardware_breakpoints_{};
 
     HardwareBreakpointSlots hardware_breakpoint_slots_{};
 
+    ReturnBreakpointMap return_breakpoints_{};
+
+    TracepointMap tracepoints_{};
+
+    Int3SiteMap int3_sites_{};
+
     std::map<BreakpointKey, BreakpointCallback> breakpoint_callbacks_{};
+
+    std::map<BreakpointKey, Condition> breakpoint_conditions_{};
+
+    std::map<BreakpointKey, ThreadFilter> breakpoint_threads_{};
+
+    BreakpointPromotionPolicy promotion_policy_{};
+
+    BreakpointMigrationCallback migration_callback_{};
+
+    //! Software breakpoints promoted to hardware breakpoint slots.
+    PromotedBreakpointMap promoted_breakpoints_{};
+
+    //! The heats of enabled software breakpoints, created when they are set or enabled so hits do not allocate.
+    BreakpointHeatMap breakpoint_heats_{};
+
+    ModuleTable modules_{};
+
+    ModuleBreakpointMap module_breakpoints_{};
+
+    ResolvedBreakpointMap resolved_breakpoints_{};
 };
 
 //! An optional reference to a process.
@@ -0,0 +1,227 @@
+/**
+ * @file profiler.h
+ * @brief The sampling profiler.
+ *
+ * @details
+ * A profiler periodically suspends a process, captures the stack of each thread with @p StackWalker,
+ * and counts identical stacks in a trie.
+ * Stacks can be exported in the folded format of flame graph scripts or as a @p pprof profile.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "memory.h"
+#include "process.h"
+#include "stack_walker.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+//! Profile options.
+struct ProfileOptions {
+    //! The interval between samples.
+    std::chrono::milliseconds interval{ 10 };
+
+    /**
+     * The maximum fraction of time the process may be suspended by sampling.
+     * The interval is stretched when a sample takes longer than the budget allows.
+     */
+    double overhead_budget{ 0.05 };
+
+    //! The maximum number of frames captured from a stack.
+    std::size_t max_depth{ 128 };
+
+    //! Code ranges of loaded modules, which enable finding callers of functions without frame pointers.
+    std::vector<MemoryRange> code_ranges{};
+};
+
+/**
+ * @brief
+ * A trie of sampled stacks.
+ * Each node is a frame, its children are the frames it has called.
+ * Children are found by hashing the parent and the return address,
+ * so counting a stack costs one lookup per frame.
+ */
+class StackTrie {
+public:
+    //! The index of the root node, which stands for an empty stack.
+    static constexpr std::uint32_t root{ 0 };
+
+    //! A frame.
+    struct Node {
+        //! The instruction address, or a return address for callers.
+        std::uintptr_t address;
+
+        //! The index of the calling frame.
+        std::uint32_t parent;
+
+        //! The number of samples whose innermost frame is this node.
+        std::uint64_t count;
+    };
+
+    StackTrie();
+
+    /**
+     * @brief Count a stack.
+     *
+     * @param frames Addresses from the innermost frame to the outermost caller.
+     * @param count The number of samples.
+     * @return The index of the innermost frame.
+     */
+    std::uint32_t Insert(std::span<const std::uintptr_t> frames,
+                         std::uint64_t count = 1);
+
+    //! Get all nodes, a parent always precedes its children.
+    std::span<const Node> Nodes() const noexcept;
+
+    /**
+     * @brief Get the addresses of the stack ending at a node.
+     *
+     * @param node The index of the innermost frame.
+     * @return Addresses from the innermost frame to the outermost caller.
+     */
+    std::vector<std::uintptr_t> Stack(std::uint32_t node) const;
+
+    //! Get the total number of samples.
+    std::uint64_t Total() const noexcept;
+
+    void Clear() noexcept;
+
+private:
+    //! The key of a child node.
+    struct ChildKey {
+        std::uint32_t parent;
+
+        std::uintptr_t address;
+
+        bool operator==(const ChildKey&) const noexcept = default;
+    };
+
+    struct ChildKeyHash {
+        std::size_t operator()(const ChildKey& key) const noexcept;
+    };
+
+    std::vector<Node> nodes_{};
+
+    std::unordered_map<ChildKey, std::uint32_t, ChildKeyHash> children_{};
+
+    std::uint64_t total_{ 0 };
+};
+
+/**
+ * @brief
+ * A sampling profiler of a process.
+ * It does not keep a timer, a debugger calls @p Sample whenever @p Due returns @p true.
+ */
+class Profiler {
+public:
+    //! A function converting an address to a frame name.
+    using Symbolizer = std::function<std::string(std::uintptr_t)>;
+
+    /**
+     * @brief Create a profiler, the first sample is due immediately.
+     *
+     * @param process_id The ID of the profiled process.
+     * @param options Profile options.
+     */
+    Profiler(std::uint32_t process_id, const ProfileOptions& options = {});
+
+    std::uint32_t ProcessId() const noexcept;
+
+    //! Whether the profiler is taking samples.
+    bool Active() const noexcept;
+
+    //! Stop taking samples, keeping the collected stacks.
+    void Stop() noexcept;
+
+    //! Whether the next sample is due.
+    bool Due() const noexcept;
+
+    //! Get the time until the next sample is due.
+    std::chrono::milliseconds Delay() const noexcept;
+
+    /**
+     * @brief
+     * Suspend a process, capture the stacks of all threads and resume it.
+     * Stacks are counted after the process is resumed.
+     *
+     * @param process The profiled process.
+     */
+    void Sample(const Process& process);
+
+    //! Get the number of samples.
+    std::uint64_t SampleCount() const noexcept;
+
+    //! Get the total time the process has been suspended by sampling.
+    std::chrono::nanoseconds SuspendedTime() const noexcept;
+
+    //! Get the time since the profiler was created until it stops.
+    std::chrono::nanoseconds Elapsed() const noexcept;
+
+    //! Get the fraction of time the process has been suspended by sampling.
+    double Overhead() const noexcept;
+
+    const StackTrie& Stacks() const noexcept;
+
+    /**
+     * @brief
+     * Export stacks in the folded format.
+     * Each line contains frames from the outermost caller separated by semicolons, and a sample count.
+     *
+     * @param symbolize
+     * A function naming frames, or an empty function to name them with hexadecimal addresses.
+     */
+    std::string FoldedStacks(const Symbolizer& symbolize = {}) const;
+
+    //! Export stacks as an uncompressed @p pprof profile protocol buffer.
+    std::vector<std::byte> Pprof() const;
+
+private:
+    std::uint32_t process_id_;
+
+    ProfileOptions options_;
+
+    bool active_{ true };
+
+    //! The wall-clock time when the profiler was created.
+    std::chrono::system_clock::time_point start_time_;
+
+    std::chrono::steady_clock::time_point start_;
+
+    std::chrono::steady_clock::time_point stop_{};
+
+    std::chrono::steady_clock::time_point next_sample_;
+
+    std::chrono::steady_clock::duration suspended_{};
+
+    std::uint64_t sample_count_{ 0 };
+
+    StackTrie stacks_{};
+
+    StackWalker walker_{};
+
+    //! Frames captured by the current sample.
+    std::vector<std::uintptr_t> frames_{};
+
+    //! The end of each captured stack in @p frames_.
+    std::vector<std::size_t> stack_ends_{};
+
+    //! The IDs of threads suspended by the current sample.
+    std::vector<std::uint32_t> suspended_threads_{};
+};
\ No newline at end of file
@@ -14,7 +14,13 @@
 
 #pragma once
 
+#include "register_field.h"
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
+#include <string_view>
 
 
 enum class RegisterIndex {
@@ -36,6 +42,28 @@ enum class RegisterIndex {
     EFLAGS
 };
 
+/**
+ * @brief Get the index of a debug address register.
+ *
+ * @param slot The slot number, from 0 to 3.
+ */
+constexpr RegisterIndex DebugAddressIndex(const std::size_t slot) noexcept {
+    return static_cast<RegisterIndex>(
+        static_cast<std::size_t>(RegisterIndex::DR0) + slot);
+}
+
+/**
+ * @brief Get a register index by its name, such as `eax` or `EFLAGS`.
+ *
+ * @param name The case-insensitive register name.
+ */
+std::optional<RegisterIndex> ParseRegisterIndex(std::string_view name) noexcept;
+
+//! Whether a register is a general register, including `EIP` and `EFLAGS`, rather than a debug register.
+constexpr bool IsGeneralRegister(const RegisterIndex index) noexcept {
+    return index <= RegisterIndex::EIP || index == RegisterIndex::EFLAGS;
+}
+
 class Registers;
 
 /**
@@ -49,110 +77,101 @@ public:
 
     virtual ~Register() noexcept = default;
 
-    Register& operator=(std::uintptr_t value) noexcept;
+    Register& operator=(std::uintptr_t value);
 
-    Register& operator++() noexcept;
+    Register& operator++();
 
-    Register operator++(int) noexcept;
+    Register operator++(int);
 
-    Register& operator--() noexcept;
+    Register& operator--();
 
-    Register operator--(int) noexcept;
+    Register operator--(int);
 
-    Register& operator+=(std::uintptr_t value) noexcept;
+    Register& operator+=(std::uintptr_t value);
 
-    Register& operator-=(std::uintptr_t value) noexcept;
+    Register& operator-=(std::uintptr_t value);
 
     //! Set the register value.
-    void Set(std::uintptr_t value) noexcept;
+    void Set(std::uintptr_t value);
 
     //! Reset the register value to zero.
-    void Reset() noexcept;
+    void Reset();
 
     //! Get the register value.
-    std::uintptr_t Get() const noexcept;
+    std::uintptr_t Get() const;
 
 protected:
+    //! Get a field of the register value.
+    std::uintptr_t GetField(RegisterField field) const;
+
+    //! Set a field of the register value.
+    void SetField(RegisterField field, std::uintptr_t value);
+
     RegisterIndex index_;
 
     Registers& registers_;
 };
 
-bool operator==(const Register& register1, const Register& register2) noexcept;
+bool operator==(const Register& register1, const Register& register2);
+
+bool operator!=(const Register& register1, const Register& register2);
 
-bool operator!=(const Register& register1, const Register& register2) noexcept;
+enum class Flag { CF, PF, AF, ZF, SF, TF, IF, DF, OF, RF };
 
-enum class Flag { CF, PF, AF, ZF, SF, TF, IF, DF, OF };
+//! Get the field of a flag in the @p EFLAGS register.
+constexpr RegisterField FlagField(const Flag flag) noexcept {
+    constexpr std::array<RegisterField, 10> fields{
+        flag_fields::cf, flag_fields::pf, flag_fields::af, flag_fields::zf,
+        flag_fields::sf, flag_fields::tf, flag_fields::if_, flag_fields::df,
+        flag_fields::of, flag_fields::rf
+    };
+
+    return fields[static_cast<std::size_t>(flag)];
+}
 
 //! A @p FLAGS register controller, providing interfaces to set flags.
 class FlagRegister : public Register {
 public:
     FlagRegister(Registers& registers) noexcept;
 
-    void SetCF() noexcept;
-    void SetPF() noexcept;
-    void SetAF() noexcept;
-    void SetZF() noexcept;
-    void SetSF() noexcept;
-    void SetTF() noexcept;
-    void SetIF() noexcept;
-    void SetDF() noexcept;
-    void SetOF() noexcept;
-
-    void ResetCF() noexcept;
-    void ResetPF() noexcept;
-    void ResetAF() noexcept;
-    void ResetZF() noexcept;
-    void ResetSF() noexcept;
-    void ResetTF() noexcept;
-    void ResetIF() noexcept;
-    void ResetDF() noexcept;
-    void ResetOF() noexcept;
-
-    bool CF() const noexcept;
-    bool PF() const noexcept;
-    bool AF() const noexcept;
-    bool ZF() const noexcept;
-    bool SF() const noexcept;
-    bool TF() const noexcept;
-    bool IF() const noexcept;
-    bool DF() const noexcept;
-    bool OF() const noexcept;
-
-    void Set(Flag flag) noexcept;
-
-    void Reset(Flag flag) noexcept;
-
-    bool Get(Flag flag) const noexcept;
-
-private:
-    struct Flags {
-        std::uintptr_t CF : 1;
-        std::uintptr_t reserve0 : 1;
-        std::uintptr_t PF : 1;
-        std::uintptr_t reserve1 : 1;
-        std::uintptr_t AF : 1;
-        std::uintptr_t reserve2 : 1;
-        std::uintptr_t ZF : 1;
-        std::uintptr_t SF : 1;
-        std::uintptr_t TF : 1;
-        std::uintptr_t IF : 1;
-        std::uintptr_t DF : 1;
-        std::uintptr_t OF : 1;
-        std::uintptr_t reserve3 : 20;
-    };
-
-    void SetCF(bool set) noexcept;
-    void SetPF(bool set) noexcept;
-    void SetAF(bool set) noexcept;
-    void SetZF(bool set) noexcept;
-    void SetSF(bool set) noexcept;
-    void SetTF(bool set) noexcept;
-    void SetIF(bool set) noexcept;
-    void SetDF(bool set) noexcept;
-    void SetOF(bool set) noexcept;
-
-    void Set(Flag flag, bool set) noexcept;
+    void SetCF();
+    void SetPF();
+    void SetAF();
+    void SetZF();
+    void SetSF();
+    void SetTF();
+    void SetIF();
+    void SetDF();
+    void SetOF();
+    void SetRF();
+
+    void ResetCF();
+    void ResetPF();
+    void ResetAF();
+    void ResetZF();
+    void ResetSF();
+    void ResetTF();
+    void ResetIF();
+    void ResetDF();
+    void ResetOF();
+    void ResetRF();
+
+    bool CF() const;
+    bool PF() const;
+    bool AF() const;
+    bool ZF() const;
+    bool SF() const;
+    bool TF() const;
+    bool IF() const;
+    bool DF() const;
+    bool OF() const;
+    bool RF() const;
+
+    void Set(Flag flag);
+
+    void Reset(Flag flag);
+
+    bool Get(Flag flag) const;
 };
 
 //! A debug status register @p DR6 controller, providing interfaces to set debug status.
@@ -160,38 +179,27 @@ class DebugStatusRegister : public Register {
 public:
     DebugStatusRegister(Registers& registers) noexcept;
 
-    void SetB0() noexcept;
-    void SetB1() noexcept;
-    void SetB2() noexcept;
-    void SetB3() noexcept;
-
-    void ResetB0() noexcept;
-    void ResetB1() noexcept;
-    void ResetB2() noexcept;
-    void ResetB3() noexcept;
-
-    bool B0() const noexcept;
-    bool B1() const noexcept;
-    bool B2() const noexcept;
-    bool B3() const noexcept;
-
-private:
-    struct DR6 {
-        std::uintptr_t B0 : 1;
-        std::uintptr_t B1 : 1;
-        std::uintptr_t B2 : 1;
-        std::uintptr_t B3 : 1;
-        std::uintptr_t reserve0 : 9;
-        std::uintptr_t BD : 1;
-        std::uintptr_t BS : 1;
-        std::uintptr_t BT : 1;
-        std::uintptr_t reserve1 : 16;
-    };
-
-    void SetB0(bool set) noexcept;
-    void SetB1(bool set) noexcept;
-    void SetB2(bool set) noexcept;
-    void SetB3(bool set) noexcept;
+    void SetB0();
+    void SetB1();
+    void SetB2();
+    void SetB3();
+
+    void ResetB0();
+    void ResetB1();
+    void ResetB2();
+    void ResetB3();
+
+    bool B0() const;
+    bool B1() const;
+    bool B2() const;
+    bool B3() const;
+
+    /**
+     * @brief Whether the breakpoint in a debug address register has been triggered.
+     *
+     * @param slot The slot number, from 0 to 3.
+     */
+    bool B(std::size_t slot) const;
 };
 
 //! A debug control register @p DR7 controller, providing interfaces to control debugging.
@@ -199,68 +207,67 @@ class DebugControlRegister : public Register {
 public:
     DebugControlRegister(Registers& registers) noexcept;
 
-    void SetL0() noexcept;
-    void SetL1() noexcept;
-    void SetL2() noexcept;
-    void SetL3() noexcept;
-
-    void ResetL0() noexcept;
-    void ResetL1() noexcept;
-    void ResetL2() noexcept;
-    void ResetL3() noexcept;
-
-    bool L0() const noexcept;
-    bool L1() const noexcept;
-    bool L2() const noexcept;
-    bool L3() const noexcept;
-
-    void SetRW0(std::uintptr_t value) noexcept;
-    void SetRW1(std::uintptr_t value) noexcept;
-    void SetRW2(std::uintptr_t value) noexcept;
-    void SetRW3(std::uintptr_t value) noexcept;
-
-    std::uintptr_t RW0() const noexcept;
-    std::uintptr_t RW1() const noexcept;
-    std::uintptr_t RW2() const noexcept;
-    std::uintptr_t RW3() const noexcept;
-
-    void SetLEN0(std::uintptr_t value) noexcept;
-    void SetLEN1(std::uintptr_t value) noexcept;
-    void SetLEN2(std::uintptr_t value) noexcept;
-    void SetLEN3(std::uintptr_t value) noexcept;
-
-    std::uintptr_t LEN0() const noexcept;
-    std::uintptr_t LEN1() const noexcept;
-    std::uintptr_t LEN2() const noexcept;
-    std::uintptr_t LEN3() const noexcept;
-
-private:
-    struct DR7 {
-        std::uintptr_t L0 : 1;
-        std::uintptr_t G0 : 1;
-        std::uintptr_t L1 : 1;
-        std::uintptr_t G1 : 1;
-        std::uintptr_t L2 : 1;
-        std::uintptr_t G2 : 1;
-        std::uintptr_t L3 : 1;
-        std::uintptr_t G3 : 1;
-        std::uintptr_t LE : 1;
-        std::uintptr_t GE : 1;
-        std::uintptr_t reserve0 : 3;
-        std::uintptr_t GD : 1;
-        std::uintptr_t reserve1 : 2;
-        std::uintptr_t RW0 : 2;
-        std::uintptr_t LEN0 : 2;
-        std::uintptr_t RW1 : 2;
-        std::uintptr_t LEN1 : 2;
-        std::uintptr_t RW2 : 2;
-        std::uintptr_t LEN2 : 2;
-        std::uintptr_t RW3 : 2;
-        std::uintptr_t LEN3 : 2;
-    };
-
-    void SetL0(bool set) noexcept;
-    void SetL1(bool set) noexcept;
-    void SetL2(bool set) noexcept;
-    void SetL3(bool set) noexcept;
+    void SetL0();
+    void SetL1();
+    void SetL2();
+    void SetL3();
+
+    void ResetL0();
+    void ResetL1();
+    void ResetL2();
+    void ResetL3();
+
+    bool L0() const;
+    bool L1() const;
+    bool L2() const;
+    bool L3() const;
+
+    void SetRW0(std::uintptr_t value);
+    void SetRW1(std::uintptr_t value);
+    void SetRW2(std::uintptr_t value);
+    void SetRW3(std::uintptr_t value);
+
+    std::uintptr_t RW0() const;
+    std::uintptr_t RW1() const;
+    std::uintptr_t RW2() const;
+    std::uintptr_t RW3() const;
+
+    void SetLEN0(std::uintptr_t value);
+    void SetLEN1(std::uintptr_t value);
+    void SetLEN2(std::uintptr_t value);
+    void SetLEN3(std::uintptr_t value);
+
+    std::uintptr_t LEN0() const;
+    std::uintptr_t LEN1() const;
+    std::uintptr_t LEN2() const;
+    std::uintptr_t LEN3() const;
+
+    /**
+     * @brief Enable the breakpoint in a debug address register.
+     *
+     * @param slot The slot number, from 0 to 3.
+     * @param type The access type.
+     * @param size The size.
+     */
+    void SetSlot(std::size_t slot, std::uintptr_t type,
+                 std::uintptr_t size);
+
+    /**
+     * @brief Disable the breakpoint in a debug address register.
+     *
+     * @param slot The slot number, from 0 to 3.
+     */
+    void ResetSlot(std::size_t slot);
+
+    template <std::size_t slot>
+    void SetSlot(const std::uintptr_t type, const std::uintptr_t size) {
+        static_assert(slot < debug_address_register_count);
+        SetSlot(slot, type, size);
+    }
+
+    template <std::size_t slot>
+    void ResetSlot() {
+        static_assert(slot < debug_address_register_count);
+        ResetSlot(slot);
+    }
 };
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ * @file register_field.h
+ * @brief Compile-time descriptors of register bit fields.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+//! The number of debug address registers, from @p DR0 to @p DR3.
+inline constexpr std::size_t debug_address_register_count{ 4 };
+
+//! A bit field of a register.
+struct RegisterField {
+    //! The offset of the lowest bit.
+    std::size_t offset;
+
+    //! The number of bits.
+    std::size_t width;
+
+    //! Get the mask of the field, unshifted.
+    constexpr std::uintptr_t Mask() const noexcept {
+        return (std::uintptr_t{ 1 } << width) - 1;
+    }
+
+    /**
+     * @brief Extract the field from a register value.
+     *
+     * @param value The register value.
+     */
+    constexpr std::uintptr_t Decode(const std::uintptr_t value) const noexcept {
+        return (value >> offset) & Mask();
+    }
+
+    /**
+     * @brief Replace the field in a register value.
+     *
+     * @param value The register value.
+     * @param field The new field value, truncated to the width.
+     * @return The new register value.
+     */
+    constexpr std::uintptr_t Encode(const std::uintptr_t value,
+                                    const std::uintptr_t field) const noexcept {
+        return (value & ~(Mask() << offset)) | ((field & Mask()) << offset);
+    }
+};
+
+//! Fields of the @p EFLAGS register.
+namespace flag_fields {
+
+inline constexpr RegisterField cf{ 0, 1 };
+inline constexpr RegisterField pf{ 2, 1 };
+inline constexpr RegisterField af{ 4, 1 };
+inline constexpr RegisterField zf{ 6, 1 };
+inline constexpr RegisterField sf{ 7, 1 };
+inline constexpr RegisterField tf{ 8, 1 };
+inline constexpr RegisterField if_{ 9, 1 };
+inline constexpr RegisterField df{ 10, 1 };
+inline constexpr RegisterField of{ 11, 1 };
+inline constexpr RegisterField rf{ 16, 1 };
+
+}  // namespace flag_fields
+
+//! Fields of the debug status register @p DR6.
+namespace debug_status_fields {
+
+//! Whether the breakpoint in a debug address register has been triggered.
+constexpr RegisterField B(const std::size_t slot) noexcept {
+    return { slot, 1 };
+}
+
+inline constexpr RegisterField bd{ 13, 1 };
+inline constexpr RegisterField bs{ 14, 1 };
+inline constexpr RegisterField bt{ 15, 1 };
+
+}  // namespace debug_status_fields
+
+//! Fields of the debug control register @p DR7.
+namespace debug_control_fields {
+
+//! Whether the breakpoint in a debug address register is enabled for the current task.
+constexpr RegisterField L(const std::size_t slot) noexcept {
+    return { slot * 2, 1 };
+}
+
+//! Whether the breakpoint in a debug address register is enabled for all tasks.
+constexpr RegisterField G(const std::size_t slot) noexcept {
+    return { slot * 2 + 1, 1 };
+}
+
+//! The access type of the breakpoint in a debug address register.
+constexpr RegisterField RW(const std::size_t slot) noexcept {
+    return { 16 + slot * 4, 2 };
+}
+
+//! The size of the breakpoint in a debug address register.
+constexpr RegisterField LEN(const std::size_t slot) noexcept {
+    return { 18 + slot * 4, 2 };
+}
+
+inline constexpr RegisterField le{ 8, 1 };
+inline constexpr RegisterField ge{ 9, 1 };
+inline constexpr RegisterField gd{ 13, 1 };
+
+}  // namespace debug_control_fields
+
+static_assert(flag_fields::tf.Encode(0, 1) == 0x100);
+static_assert(flag_fields::rf.Decode(0x10202) == 1);
+static_assert(debug_status_fields::B(2).Decode(0B0100) == 1);
+static_assert(debug_control_fields::L(3).Encode(0, 1) == 0B0100'0000);
+static_assert(debug_control_fields::RW(1).Encode(0xFFFF'FFFF, 0B01)
+              == 0xFFDF'FFFF);
+static_assert(debug_control_fields::LEN(3).Decode(0xC000'0000) == 0B11);
+static_assert(debug_control_fields::LEN(0).Encode(0, 0B111) == 0xC'0000);
\ No newline at end of file
@@ -18,7 +18,22 @@
 
 #include <Windows.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+
+//! The number of x87 floating-point registers, which are also MMX registers.
+inline constexpr std::size_t x87_register_count{ 8 };
+
+//! The number of XMM registers.
+inline constexpr std::size_t xmm_register_count{ 8 };
+
+//! An 80-bit x87 floating-point register value.
+using X87Register = std::array<std::byte, 10>;
+
+//! A 128-bit XMM register value.
+using XmmRegister = std::array<std::byte, 16>;
 
 //! x86 32-bit registers.
 class Registers final {
@@ -46,10 +61,17 @@ public:
     DebugStatusRegister DR6;
     DebugControlRegister DR7;
 
-    //! Get register values from a thread.
-    Registers(HANDLE thread, std::uint32_t context_flags = CONTEXT_ALL);
-
-    //! Set register values to the thread.
+    /**
+     * @brief Get register values from a thread.
+     *
+     * @param thread The thread handle.
+     * @param context_flags
+     * Register groups fetched now, such as @p CONTEXT_CONTROL.
+     * Other groups are fetched when they are accessed for the first time.
+     */
+    Registers(HANDLE thread, std::uint32_t context_flags = 0);
+
+    //! Set modified register groups to the thread.
     ~Registers();
 
     Registers(const Registers&) = delete;
@@ -58,18 +80,160 @@ public:
 
     HANDLE Thread() const noexcept;
 
-    void Set(RegisterIndex index, std::uintptr_t value) noexcept;
-
-    void Reset(RegisterIndex index) noexcept;
-
-    std::uintptr_t Get(RegisterIndex index) const noexcept;
+    void Set(RegisterIndex index, std::uintptr_t value);
+
+    void Reset(RegisterIndex index);
+
+    std::uintptr_t Get(RegisterIndex index) const;
+
+    /**
+     * @brief Get an x87 floating-point register, fetching @p CONTEXT_FLOATING_POINT on demand.
+     *
+     * @param index The stack index, from 0 to 7.
+     */
+    X87Register ST(std::size_t index) const;
+
+    /**
+     * @brief Set an x87 floating-point register.
+     *
+     * @param index The stack index, from 0 to 7.
+     * @param value The value.
+     */
+    void SetST(std::size_t index, const X87Register& value);
+
+    /**
+     * @brief Get an MMX register, which is the low 64 bits of a physical x87 register.
+     *
+     * @param index The register index, from 0 to 7.
+     */
+    std::uint64_t MM(std::size_t index) const;
+
+    /**
+     * @brief Set an MMX register, setting the exponent of the x87 register to all ones as processors do.
+     *
+     * @param index The register index, from 0 to 7.
+     * @param value The value.
+     */
+    void SetMM(std::size_t index, std::uint64_t value);
+
+    /**
+     * @brief Get an XMM register, fetching @p CONTEXT_EXTENDED_REGISTERS on demand.
+     *
+     * @param index The register index, from 0 to 7.
+     */
+    XmmRegister XMM(std::size_t index) const;
+
+    /**
+     * @brief Set an XMM register.
+     *
+     * @param index The register index, from 0 to 7.
+     * @param value The value.
+     */
+    void SetXMM(std::size_t index, const XmmRegister& value);
+
+    //! Get the SSE control and status register, fetching @p CONTEXT_EXTENDED_REGISTERS on demand.
+    std::uint32_t MXCSR() const;
+
+    //! Set the SSE control and status register.
+    void SetMXCSR(std::uint32_t value);
+
+    //! Set a register known at compile time.
+    template <RegisterIndex index>
+    void Set(const std::uintptr_t value) {
+        constexpr auto group{ Group(index) };
+        Load(group);
+        if (auto& member{ context_.*ContextMember(index) }; member != value) {
+            member = value;
+            dirty_ |= group;
+        }
+    }
+
+    //! Get a register known at compile time, which is a single load once its group has been fetched.
+    template <RegisterIndex index>
+    std::uintptr_t Get() const {
+        Load(Group(index));
+        return context_.*ContextMember(index);
+    }
 
 private:
+    //! Get the member of @p CONTEXT storing a register.
+    static constexpr DWORD CONTEXT::*ContextMember(
+        const RegisterIndex index) noexcept {
+        // Members are ordered as `RegisterIndex`.
+        constexpr std::array<DWORD CONTEXT::*, 16> members{
+            &CONTEXT::Eax, &CONTEXT::Ebx, &CONTEXT::Ecx, &CONTEXT::Edx,
+            &CONTEXT::Esp, &CONTEXT::Ebp, &CONTEXT::Esi, &CONTEXT::Edi,
+            &CONTEXT::Eip, &CONTEXT::Dr0, &CONTEXT::Dr1, &CONTEXT::Dr2,
+            &CONTEXT::Dr3, &CONTEXT::Dr6, &CONTEXT::Dr7, &CONTEXT::EFlags
+        };
+
+        return members[static_cast<std::size_t>(index)];
+    }
+
+    //! Get the @p CONTEXT flag of the group containing a register.
+    static constexpr std::uint32_t Group(const RegisterIndex index) noexcept {
+        switch (index) {
+            case RegisterIndex::ESP:
+            case RegisterIndex::EBP:
+            case RegisterIndex::EIP:
+            case RegisterIndex::EFLAGS: {
+                return CONTEXT_CONTROL;
+            }
+            case RegisterIndex::DR0:
+            case RegisterIndex::DR1:
+            case RegisterIndex::DR2:
+            case RegisterIndex::DR3:
+            case RegisterIndex::DR6:
+            case RegisterIndex::DR7: {
+                return CONTEXT_DEBUG_REGISTERS;
+            }
+            default: {
+                return CONTEXT_INTEGER;
+            }
+        }
+    }
+
+    //! Fetch register groups that have not been fetched.
+    void Load(std::uint32_t groups) const {
+        if ((loaded_ & groups) != groups) {
+            Fetch((groups & ~loaded_) | CONTEXT_i386);
+        }
+    }
+
+    //! Fetch register groups from the thread.
+    void Fetch(std::uint32_t groups) const;
+
+    /**
+     * @brief Read bytes of a register group.
+     *
+     * @param group The @p CONTEXT flag of the group.
+     * @param source The bytes in the context.
+     * @param target The buffer receiving the bytes.
+     */
+    void ReadBytes(std::uint32_t group, const void* source,
+                   std::span<std::byte> target) const;
+
+    /**
+     * @brief Write bytes of a register group, marking it as modified if they change.
+     *
+     * @param group The @p CONTEXT flag of the group.
+     * @param target The bytes in the context.
+     * @param source The new bytes.
+     */
+    void WriteBytes(std::uint32_t group, void* target,
+                    std::span<const std::byte> source);
+
+    //! Get the offset of a physical x87 register in the stack, according to the top of the stack.
+    std::size_t X87StackIndex(std::size_t index) const;
+
     HANDLE thread_;
 
-    //! Original values.
-    CONTEXT original_context_{};
+    //! Register values, of which only fetched groups are valid.
+    mutable CONTEXT context_{};
+
+    //! Register groups that have been fetched.
+    mutable std::uint32_t loaded_{ 0 };
 
-    //! Modified values.
-    CONTEXT context_{};
+    //! Register groups that have been modified.
+    std::uint32_t dirty_{ 0 };
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+/**
+ * @file register_history.h
+ * @brief The register history of a thread.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+class Registers;
+
+//! Registers recorded in a register history.
+enum class HistoryRegister {
+    EAX,
+    EBX,
+    ECX,
+    EDX,
+    ESP,
+    EBP,
+    ESI,
+    EDI,
+    EIP,
+    EFLAGS
+};
+
+//! The number of registers recorded in a register history.
+inline constexpr std::size_t history_register_count{ 10 };
+
+/**
+ * @brief
+ * A ring of the latest register states of a thread.
+ * Each register is stored in its own array, so queries scan contiguous values.
+ * Records are numbered from zero in the order they are pushed.
+ */
+class RegisterHistory {
+public:
+    /**
+     * @brief Create a register history.
+     *
+     * @param capacity The minimum number of records to keep, rounded up to a power of two.
+     */
+    explicit RegisterHistory(std::size_t capacity);
+
+    //! Record the current register values.
+    void Push(const Registers& registers);
+
+    //! Record register values indexed by @p HistoryRegister.
+    void Push(const std::array<std::uint32_t, history_register_count>& values);
+
+    //! Get the number of kept records.
+    std::size_t Size() const noexcept;
+
+    std::size_t Capacity() const noexcept;
+
+    //! Get the number of the oldest kept record.
+    std::uint64_t First() const noexcept;
+
+    //! Get the number of records that have been pushed.
+    std::uint64_t Count() const noexcept;
+
+    /**
+     * @brief Get a register value in a record.
+     *
+     * @param reg The register.
+     * @param record The record number, which must be kept.
+     */
+    std::uint32_t Get(HistoryRegister reg, std::uint64_t record) const noexcept;
+
+    /**
+     * @brief Find the latest record in which a register is below a value, such as @p ESP below a stack limit.
+     *
+     * @param reg The register.
+     * @param value The value.
+     * @return The record number.
+     */
+    std::optional<std::uint64_t> FindLastBelow(
+        HistoryRegister reg, std::uint32_t value) const noexcept;
+
+    /**
+     * @brief Find records in which a register differs from the previous record.
+     *
+     * @param reg The register.
+     * @return Record numbers in ascending order.
+     */
+    std::vector<std::uint64_t> FindChanges(HistoryRegister reg) const;
+
+    void Clear() noexcept;
+
+private:
+    //! Get the values of a register as the older and newer contiguous parts of the ring.
+    std::array<std::span<const std::uint32_t>, 2> Segments(
+        HistoryRegister reg) const noexcept;
+
+    std::size_t capacity_;
+
+    std::uint64_t count_{ 0 };
+
+    //! Ring buffers indexed by @p HistoryRegister.
+    std::array<std::vector<std::uint32_t>, history_register_count> columns_{};
+};
\ No newline at end of file
@@ -0,0 +1,307 @@
+/**
+ * @file slot_table.h
+ * @brief Dense tables of objects indexed by IDs.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief
+ * A handle to an object in a slot table.
+ * It becomes invalid after the object is erased, even if the slot is reused.
+ */
+struct SlotHandle {
+    std::uint32_t index{ std::numeric_limits<std::uint32_t>::max() };
+
+    std::uint32_t generation{ 0 };
+};
+
+/**
+ * @brief
+ * A table storing objects indexed by 32-bit IDs in chunks of slots.
+ * Objects never move after insertion, iteration visits slots in order,
+ * and erased slots are reused by later insertions.
+ */
+template <typename T, std::size_t chunk_size = 64>
+class SlotTable {
+public:
+    using Key = std::uint32_t;
+
+    using Value = std::pair<const Key, T>;
+
+    //! A forward iterator over the stored (ID, object) pairs.
+    template <bool constant>
+    class Iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+
+        using iterator_category = std::forward_iterator_tag;
+
+        using value_type = Value;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = std::conditional_t<constant, const Value&, Value&>;
+
+        using pointer = std::conditional_t<constant, const Value*, Value*>;
+
+        using Table = std::conditional_t<constant, const SlotTable, SlotTable>;
+
+        Iterator() noexcept = default;
+
+        Iterator(Table* const table, const std::uint32_t index) noexcept :
+            table_{ table }, index_{ index } {
+            SkipEmpty();
+        }
+
+        reference operator*() const noexcept {
+            return *table_->At(index_).value;
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        Iterator& operator++() noexcept {
+            ++index_;
+            SkipEmpty();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            auto old{ *this };
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+    private:
+        void SkipEmpty() noexcept {
+            while (index_ < table_->used_ && !table_->At(index_).value) {
+                ++index_;
+            }
+        }
+
+        Table* table_{ nullptr };
+
+        std::uint32_t index_{ 0 };
+    };
+
+    using iterator = Iterator<false>;
+
+    using const_iterator = Iterator<true>;
+
+    SlotTable() noexcept = default;
+
+    SlotTable(SlotTable&& table) noexcept :
+        chunks_{ std::move(table.chunks_) },
+        used_{ std::exchange(table.used_, 0) },
+        free_{ std::move(table.free_) },
+        index_{ std::move(table.index_) } {}
+
+    SlotTable& operator=(SlotTable&& table) noexcept {
+        if (this != &table) {
+            chunks_ = std::move(table.chunks_);
+            used_ = std::exchange(table.used_, 0);
+            free_ = std::move(table.free_);
+            index_ = std::move(table.index_);
+        }
+
+        return *this;
+    }
+
+    SlotTable(const SlotTable&) = delete;
+
+    SlotTable& operator=(const SlotTable&) = delete;
+
+    /**
+     * @brief Insert an object if its ID does not exist.
+     *
+     * @param key The ID.
+     * @param object The object.
+     * @return The handle to the object with the ID and whether the insertion took place.
+     */
+    std::pair<SlotHandle, bool> Insert(const Key key, T&& object) {
+        if (const auto found{ index_.find(key) }; found != index_.cend()) {
+            return { Handle(found->second), false };
+        }
+
+        std::uint32_t index{ 0 };
+        if (!free_.empty()) {
+            index = free_.back();
+            free_.pop_back();
+        } else {
+            if (used_ == chunks_.size() * chunk_size) {
+                chunks_.push_back(std::make_unique<Slot[]>(chunk_size));
+            }
+
+            index = used_++;
+        }
+
+        At(index).value.emplace(key, std::move(object));
+        index_.insert({ key, index });
+        return { Handle(index), true };
+    }
+
+    /**
+     * @brief Erase an object.
+     *
+     * @param key The ID.
+     * @return @p true if it succeeds, otherwise @p false.
+     */
+    bool Erase(const Key key) noexcept {
+        const auto found{ index_.find(key) };
+        if (found == index_.cend()) {
+            return false;
+        }
+
+        auto& slot{ At(found->second) };
+        slot.value.reset();
+        ++slot.generation;
+        free_.push_back(found->second);
+        index_.erase(found);
+        return true;
+    }
+
+    //! Erase all objects and keep the slots for reuse.
+    void Clear() noexcept {
+        // Chunks are kept so that generations survive and old handles stay invalid.
+        for (std::uint32_t i{ 0 }; i != used_; ++i) {
+            auto& slot{ At(i) };
+            if (slot.value) {
+                slot.value.reset();
+                ++slot.generation;
+            }
+        }
+
+        used_ = 0;
+        free_.clear();
+        index_.clear();
+    }
+
+    /**
+     * @brief Find an object.
+     *
+     * @param key The ID.
+     * @return The object, or @p nullptr if it does not exist.
+     */
+    T* Find(const Key key) const noexcept {
+        const auto found{ index_.find(key) };
+        return found != index_.cend() ? &At(found->second).value->second
+                                      : nullptr;
+    }
+
+    /**
+     * @brief Find an object, trying the handle of the last hit before the index.
+     *
+     * @param key The ID.
+     * @param[in,out] hint The handle of the last hit, which is updated after a miss.
+     * @return The object, or @p nullptr if it does not exist.
+     */
+    T* Find(const Key key, SlotHandle& hint) const noexcept {
+        if (const auto object{ Find(hint) };
+            object && At(hint.index).value->first == key) {
+            return object;
+        }
+
+        const auto found{ index_.find(key) };
+        if (found == index_.cend()) {
+            return nullptr;
+        }
+
+        hint = Handle(found->second);
+        return &At(found->second).value->second;
+    }
+
+    /**
+     * @brief Find an object by its handle.
+     *
+     * @param handle The handle.
+     * @return The object, or @p nullptr if it has been erased.
+     */
+    T* Find(const SlotHandle handle) const noexcept {
+        if (handle.index >= used_) {
+            return nullptr;
+        }
+
+        auto& slot{ At(handle.index) };
+        return slot.value && slot.generation == handle.generation
+                   ? &slot.value->second
+                   : nullptr;
+    }
+
+    std::size_t Size() const noexcept {
+        return index_.size();
+    }
+
+    bool Empty() const noexcept {
+        return index_.empty();
+    }
+
+    iterator begin() noexcept {
+        return { this, 0 };
+    }
+
+    iterator end() noexcept {
+        return { this, used_ };
+    }
+
+    const_iterator begin() const noexcept {
+        return { this, 0 };
+    }
+
+    const_iterator end() const noexcept {
+        return { this, used_ };
+    }
+
+private:
+    struct Slot {
+        std::optional<Value> value{};
+
+        //! Increased when the object is erased, invalidating its handles.
+        std::uint32_t generation{ 0 };
+    };
+
+    Slot& At(const std::uint32_t index) const noexcept {
+        return chunks_[index / chunk_size][index % chunk_size];
+    }
+
+    SlotHandle Handle(const std::uint32_t index) const noexcept {
+        return { index, At(index).generation };
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> chunks_{};
+
+    //! The number of slots that have been used.
+    std::uint32_t used_{ 0 };
+
+    //! Erased slots for reuse.
+    std::vector<std::uint32_t> free_{};
+
+    //! Slot indexes by IDs.
+    std::unordered_map<Key, std::uint32_t> index_{};
+};
\ No newline at end of file
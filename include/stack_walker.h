@@ -0,0 +1,114 @@
+/**
+ * @file stack_walker.h
+ * @brief The stack walker.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+class Process;
+struct ThreadSnapshot;
+
+/**
+ * @brief
+ * A stack walker of suspended threads.
+ * Stack memory is read in page-sized chunks from the stack pointer upward,
+ * and frames are decoded locally, so a walk usually costs one read per chunk instead of one per frame.
+ *
+ * @details
+ * Frames are followed through the chain of saved @p EBP values.
+ * If code ranges are known, return addresses outside them end the chain,
+ * and the walker falls back to scanning the stack for values inside them,
+ * which finds callers of functions omitting frame pointers.
+ */
+class StackWalker {
+public:
+    //! Create a walker that only follows @p EBP frames.
+    StackWalker() noexcept = default;
+
+    /**
+     * @brief Set the code ranges of loaded modules, which enable return address scanning.
+     *
+     * @param ranges Executable address ranges, whose end addresses are excluded.
+     */
+    void SetCodeRanges(std::vector<MemoryRange> ranges);
+
+    //! Whether an address is inside a code range.
+    bool InCode(std::uintptr_t address) const noexcept;
+
+    /**
+     * @brief Walk the stack of a suspended thread.
+     *
+     * @param process The process.
+     * @param eip The instruction pointer.
+     * @param esp The stack pointer.
+     * @param ebp The frame pointer.
+     * @param[out] frames
+     * The buffer receiving addresses from the current instruction to the outermost caller.
+     * Its size limits the number of frames.
+     * @return The number of frames.
+     */
+    std::size_t Walk(const Process& process, std::uintptr_t eip,
+                     std::uintptr_t esp, std::uintptr_t ebp,
+                     std::span<std::uintptr_t> frames);
+
+    /**
+     * @brief Walk the stack of a suspended thread.
+     *
+     * @param process The process.
+     * @param snapshot The registers of the thread, containing at least control registers.
+     * @param[out] frames The buffer receiving addresses from the current instruction to the outermost caller.
+     * @return The number of frames.
+     */
+    std::size_t Walk(const Process& process, const ThreadSnapshot& snapshot,
+                     std::span<std::uintptr_t> frames);
+
+private:
+    /**
+     * @brief Read a stack slot, loading the chunk containing it if necessary.
+     *
+     * @param process The process.
+     * @param address The address of the slot, aligned to four bytes.
+     * @return The value, or @p std::nullopt if the memory cannot be read.
+     */
+    std::optional<std::uint32_t> ReadSlot(const Process& process,
+                                          std::uintptr_t address);
+
+    /**
+     * @brief Scan the stack for a return address.
+     *
+     * @param process The process.
+     * @param address The lowest address to scan, aligned to four bytes.
+     * @return The address of the slot containing a return address.
+     */
+    std::optional<std::uintptr_t> ScanReturnAddress(const Process& process,
+                                                    std::uintptr_t address);
+
+    //! Sorted and disjoint code ranges.
+    std::vector<MemoryRange> code_ranges_{};
+
+    //! The loaded stack memory.
+    std::vector<std::byte> chunk_{};
+
+    //! The address of @p chunk_.
+    std::uintptr_t chunk_address_{ 0 };
+
+    //! The valid size of @p chunk_.
+    std::size_t chunk_size_{ 0 };
+};
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+ * @file step_callback_queue.h
+ * @brief The queue of step callbacks.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "inplace_function.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+
+//! The size of the buffer storing a step callback.
+inline constexpr std::size_t step_callback_capacity{ 6 * sizeof(void*) };
+
+//! The step callback, which is stored without heap allocation.
+using StepCallback = InplaceFunction<void(), step_callback_capacity>;
+
+//! The number of step callbacks stored in a queue without heap allocation.
+inline constexpr std::size_t inline_step_callback_count{ 4 };
+
+/**
+ * @brief
+ * A first-in, first-out queue of step callbacks.
+ * The first few callbacks are stored in place and the rest in a buffer reused after clearing.
+ */
+class StepCallbackQueue {
+public:
+    StepCallbackQueue() noexcept = default;
+
+    StepCallbackQueue(StepCallbackQueue&& queue) noexcept;
+
+    StepCallbackQueue& operator=(StepCallbackQueue&& queue) noexcept;
+
+    //! Append a callback.
+    void Push(StepCallback callback);
+
+    //! Whether there are no callbacks.
+    bool Empty() const noexcept;
+
+    //! Get the number of callbacks.
+    std::size_t Size() const noexcept;
+
+    /**
+     * @brief
+     * Execute and clear callbacks in the order they were pushed.
+     * Callbacks pushed during the execution are kept for the next one.
+     */
+    void Execute();
+
+    //! Clear callbacks.
+    void Clear() noexcept;
+
+private:
+    std::array<StepCallback, inline_step_callback_count> callbacks_{};
+
+    //! The number of callbacks stored in place.
+    std::size_t size_{ 0 };
+
+    //! Callbacks exceeding the in-place storage.
+    std::vector<StepCallback> overflow_{};
+};
\ No newline at end of file
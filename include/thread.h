@@ -15,18 +15,40 @@
 #pragma once
 
 #include "breakpoint.h"
+#include "inplace_function.h"
+#include "register_history.h"
+#include "step_callback_queue.h"
 
 #include <Windows.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <list>
+#include <memory>
 #include <optional>
+#include <vector>
 
-//! The step callback.
-using StepCallback = std::function<void()>;
+class Registers;
 
-//! A thread.
+//! The internal step callback, which is stored in the thread without heap allocation.
+using InternalStepCallback = InplaceFunction<void()>;
+
+//! Steps that run a thread until it returns to an address.
+enum class ReturnStep {
+    None,
+    //! Step over a call instruction.
+    Over,
+    //! Step out of the current function.
+    Out
+};
+
+/**
+ * @brief
+ * A thread.
+ * It only holds its identity until it steps,
+ * so idle threads of heavily threaded processes stay small.
+ */
 class Thread {
 public:
     /**
@@ -60,6 +82,19 @@ public:
     //! Resume the thread.
     void Resume() const;
 
+    /**
+     * @brief Suspend the thread while another thread steps, unless it has been suspended.
+     *
+     * @return @p true if the thread is newly suspended, otherwise @p false.
+     */
+    bool Freeze();
+
+    //! Resume the thread if it has been suspended by @p Freeze.
+    void Thaw();
+
+    //! Whether the thread has been suspended by @p Freeze.
+    bool Frozen() const noexcept;
+
     //! Step into.
     void StepInto();
 
@@ -76,7 +111,15 @@ public:
     void ResetSingleStepping() noexcept;
 
     //! Perform an internal step.
-    void InternalStep(StepCallback callback);
+    void InternalStep(InternalStepCallback callback);
+
+    /**
+     * @brief Perform an internal step, setting the trap flag in fetched registers of the thread.
+     *
+     * @param registers The registers of the thread, which are written back when they are destroyed.
+     * @param callback An internal step callback.
+     */
+    void InternalStep(Registers& registers, InternalStepCallback callback);
 
     //! Whether the thread has set an internal step.
     bool InternalStepping() const noexcept;
@@ -87,6 +130,90 @@ public:
     //! Execute and clear the internal step callback.
     void ExecuteInternalStepCallback();
 
+    /**
+     * @brief
+     * Step over and set a step callback.
+     * If the current instruction is a call, the thread runs until the call returns,
+     * otherwise it is the same as stepping into.
+     *
+     * @note
+     * The step is armed by the debugger at the end of the current debug event,
+     * so it can only be used on the debugged thread.
+     */
+    void StepOver(StepCallback callback = {});
+
+    /**
+     * @brief
+     * Step out and set a step callback.
+     * The thread runs until the current function returns.
+     *
+     * @note
+     * The step is armed by the debugger at the end of the current debug event,
+     * so it can only be used on the debugged thread.
+     */
+    void StepOut(StepCallback callback = {});
+
+    //! Get the step-over or step-out that has been requested but not armed yet.
+    ReturnStep PendingReturnStep() const noexcept;
+
+    /**
+     * @brief Arm the pending step-over or step-out.
+     *
+     * @param address The return address.
+     * @param frame The lowest stack pointer at which the return is complete, filtering out recursive calls.
+     */
+    void ArmReturnStep(std::uintptr_t address, std::uintptr_t frame) noexcept;
+
+    //! Turn the pending step-over or step-out into a step-into, keeping its callback and disarming any previous step.
+    void DowngradeReturnStep();
+
+    //! Whether the thread has armed a step-over or step-out.
+    bool ReturnStepping() const noexcept;
+
+    //! Get the return address of the armed step-over or step-out.
+    std::uintptr_t ReturnStepAddress() const noexcept;
+
+    /**
+     * @brief Whether the thread has completed the armed step-over or step-out.
+     *
+     * @param address The current instruction address.
+     * @param stack The current stack pointer.
+     */
+    bool ReachedReturnStep(std::uintptr_t address,
+                           std::uintptr_t stack) const noexcept;
+
+    /**
+     * @brief Whether the thread has left the frame of the armed step-over or step-out without returning.
+     *
+     * @details
+     * An exception handler may unwind the stack past the frame,
+     * so the thread never reaches the return address.
+     *
+     * @param stack The current stack pointer.
+     */
+    bool LeftReturnStep(std::uintptr_t stack) const noexcept;
+
+    //! Clear the step-over or step-out, both pending and armed, without executing its callback.
+    void ResetReturnStepping() noexcept;
+
+    //! Clear the step-over or step-out, then execute its callback.
+    void ExecuteReturnStepCallback();
+
+    /**
+     * @brief Enable the register history, replacing the existing one.
+     *
+     * @param capacity The minimum number of register states to keep.
+     */
+    void EnableRegisterHistory(std::size_t capacity);
+
+    void DisableRegisterHistory() noexcept;
+
+    //! Get the register history, or @p nullptr if it is disabled.
+    const RegisterHistory* History() const noexcept;
+
+    //! Record registers fetched for a debug event if the register history is enabled.
+    void RecordHistory(const Registers& registers);
+
     /**
      * @brief Set a hardware breakpoint.
      *
@@ -108,7 +235,38 @@ public:
     void DeleteHardwareBreakpoint(HardwareBreakpointSlot slot) const;
 
 private:
-    using StepCallbackList = std::list<StepCallback>;
+    //! The step state, which most threads never need.
+    struct StepState {
+        //! Whether the thread has set an internal step.
+        bool internal_stepping{ false };
+
+        //! The internal step callback.
+        InternalStepCallback internal_step_callback{};
+
+        //! Whether the thread has set a single step.
+        bool single_stepping{ false };
+
+        //! Single step callbacks.
+        StepCallbackQueue single_step_callbacks{};
+
+        //! The step-over or step-out that has been requested but not armed yet.
+        ReturnStep pending_return_step{ ReturnStep::None };
+
+        //! Whether the thread has armed a step-over or step-out.
+        bool return_stepping{ false };
+
+        //! The return address of the step-over or step-out.
+        std::uintptr_t return_step_address{ 0 };
+
+        //! The lowest stack pointer at which the step-over or step-out is complete.
+        std::uintptr_t return_step_frame{ 0 };
+
+        //! The step-over or step-out callback.
+        StepCallback return_step_callback{};
+    };
+
+    //! Get the step state, allocating it when the thread steps for the first time.
+    StepState& Step();
 
     HANDLE handle_;
 
@@ -118,17 +276,17 @@ private:
 
     std::uintptr_t local_base_;
 
-    //! Whether the thread has set an internal step.
-    bool internal_stepping_{ false };
+    //! The number of suspensions by @p Suspend that have not been resumed.
+    mutable std::uint32_t suspensions_{ 0 };
 
-    //! The internal step callback.
-    StepCallback internal_step_callback_{};
+    //! Whether the thread has been suspended by @p Freeze.
+    bool frozen_{ false };
 
-    //! Whether the thread has set a single step.
-    bool single_stepping_{ false };
+    //! The step state, or @p nullptr if the thread has never stepped.
+    std::unique_ptr<StepState> step_{};
 
-    //! Single step callbacks.
-    StepCallbackList single_step_callbacks_{};
+    //! The register history, or @p nullptr if it is disabled.
+    std::unique_ptr<RegisterHistory> history_{};
 };
 
 //! An optional reference to a thread.
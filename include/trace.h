@@ -0,0 +1,838 @@
+/**
+ * @file trace.h
+ * @brief The instruction trace file.
+ *
+ * @details
+ * A trace file records the instructions executed by a thread,
+ * optionally with changed registers and memory operand addresses.
+ *
+ * @code
+ * ┌────────────┐
+ * │   Header   │  Magic, version, content and records per chunk.
+ * ├────────────┤
+ * │  Chunk 0   │  Delta-encoded and variable-length records.
+ * ├────────────┤
+ * │    ...     │
+ * ├────────────┤
+ * │  Chunk N   │
+ * ├────────────┤
+ * │   Index    │  The offset, size and record count of each chunk.
+ * ├────────────┤
+ * │   Footer   │  The index offset, record count, chunk count and magic.
+ * └────────────┘
+ * @endcode
+ *
+ * Each chunk starts with a reset delta state, so it can be decoded independently.
+ * A record is encoded as follows, each field is a little-endian base-128 varint:
+ * - The zigzag-encoded delta of @p EIP.
+ * - If registers are recorded, a mask of changed registers,
+ *   followed by the zigzag-encoded delta of each changed register.
+ * - If memory is recorded, zero if there is no memory operand,
+ *   otherwise one plus the zigzag-encoded delta of the operand address.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "instruction.h"
+
+#include <Windows.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+
+//! The contents of a trace file, besides instruction addresses.
+enum class TraceContent : std::uint16_t {
+    None = 0,
+    //! Changed general-purpose registers and @p EFLAGS.
+    Registers = 1 << 0,
+    //! The addresses of memory operands.
+    Memory = 1 << 1
+};
+
+//! The number of registers recorded in a trace.
+inline constexpr std::size_t trace_register_count{ 9 };
+
+//! The index of @p EFLAGS in @p TraceRegisters, other registers are indexed by @p RegisterIndex.
+inline constexpr std::size_t trace_eflags_index{ trace_register_count - 1 };
+
+//! @p EAX, @p EBX, @p ECX, @p EDX, @p ESP, @p EBP, @p ESI, @p EDI and @p EFLAGS.
+using TraceRegisters = std::array<std::uint32_t, trace_register_count>;
+
+//! Trace options.
+struct TraceOptions {
+    //! The start address of the traced range.
+    std::uintptr_t begin{ 0 };
+
+    //! The end address of the traced range, excluded.
+    std::uintptr_t end{ std::numeric_limits<std::uintptr_t>::max() };
+
+    //! A combination of @p TraceContent values.
+    std::uint16_t content{ static_cast<std::uint16_t>(TraceContent::None) };
+
+    //! The number of records in a chunk, or the number of tokens if the trace is compressed.
+    std::uint32_t chunk_size{ 0x1000 };
+
+    /**
+     * Whether to fold repeating basic block sequences with @p CompressedTraceWriter.
+     * Only instruction addresses can be recorded in a compressed trace.
+     */
+    bool compress{ false };
+};
+
+//! A traced instruction.
+struct TraceRecord {
+    //! The index of the record in the trace.
+    std::uint64_t index{ 0 };
+
+    //! The instruction address.
+    std::uintptr_t address{ 0 };
+
+    //! A bit mask of the registers changed since the previous record.
+    std::uint16_t changed{ 0 };
+
+    //! The register values before the instruction is executed.
+    TraceRegisters registers{};
+
+    //! The address of the memory operand.
+    std::optional<std::uintptr_t> memory;
+};
+
+/**************** Encoding ****************/
+
+//! The magic number of a trace file: `XTRC`.
+inline constexpr std::uint32_t trace_magic{ 0x43525458 };
+
+inline constexpr std::uint16_t trace_version{ 1 };
+
+//! The size of the header: magic, version, content, records per chunk and a reserved field.
+inline constexpr std::size_t trace_header_size{ 16 };
+
+//! The size of an index entry: offset, size and record count.
+inline constexpr std::size_t trace_index_entry_size{ 16 };
+
+//! The size of the footer: index offset, record count, chunk count and magic.
+inline constexpr std::size_t trace_footer_size{ 24 };
+
+//! The magic number of a compressed trace file: `XTRZ`.
+inline constexpr std::uint32_t compressed_trace_magic{ 0x5A525458 };
+
+//! The size of an index entry of a compressed trace: offset, size, token count and first record index.
+inline constexpr std::size_t compressed_trace_index_entry_size{ 24 };
+
+//! The size of the footer of a compressed trace: dictionary and index offsets, record count, dictionary sizes, chunk count and magic.
+inline constexpr std::size_t compressed_trace_footer_size{ 48 };
+
+//! The maximum size of a varint.
+inline constexpr std::size_t max_varint_size{ 10 };
+
+//! The maximum size of an encoded record.
+inline constexpr std::size_t max_trace_record_size{
+    max_varint_size * (trace_register_count + 3)
+};
+
+//! The maximum number of records or tokens in a chunk, bounding the chunk buffer of a writer.
+inline constexpr std::uint32_t max_trace_chunk_size{ 0x100000 };
+
+//! Map a signed integer to an unsigned integer, so that small magnitudes stay small.
+constexpr std::uint64_t ZigZagEncode(const std::int64_t value) noexcept {
+    return (static_cast<std::uint64_t>(value) << 1)
+           ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+constexpr std::int64_t ZigZagDecode(const std::uint64_t value) noexcept {
+    return static_cast<std::int64_t>(value >> 1)
+           ^ -static_cast<std::int64_t>(value & 1);
+}
+
+/**
+ * @brief Encode a varint.
+ *
+ * @param value The value.
+ * @param buffer The buffer, at least @p max_varint_size bytes.
+ * @return The size of the varint.
+ */
+constexpr std::size_t EncodeVarint(std::uint64_t value,
+                                   std::byte* const buffer) noexcept {
+    std::size_t size{ 0 };
+    while (value >= 0x80) {
+        buffer[size++] = static_cast<std::byte>(value | 0x80);
+        value >>= 7;
+    }
+
+    buffer[size++] = static_cast<std::byte>(value);
+    return size;
+}
+
+/**
+ * @brief Decode a varint.
+ *
+ * @param data The data, the decoded bytes are removed from it.
+ * @return The value, or @p std::nullopt if the varint is truncated or too long.
+ */
+constexpr std::optional<std::uint64_t> DecodeVarint(
+    std::span<const std::byte>& data) noexcept {
+    std::uint64_t value{ 0 };
+    for (std::size_t i{ 0 }; i != max_varint_size && i != data.size(); ++i) {
+        const auto byte{ static_cast<std::uint64_t>(data[i]) };
+        value |= (byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            data = data.subspan(i + 1);
+            return value;
+        }
+    }
+
+    return std::nullopt;
+}
+
+/******************************************/
+
+/**
+ * @brief
+ * A trace file writer.
+ * Records are buffered into a preallocated chunk,
+ * so writing a record never allocates memory.
+ */
+class TraceWriter {
+public:
+    /**
+     * @brief Create a trace file.
+     *
+     * @param file_path The file path, an existing file is overwritten.
+     * @param content A combination of @p TraceContent values.
+     * @param chunk_size The number of records in a chunk.
+     */
+    TraceWriter(std::wstring_view file_path, std::uint16_t content,
+                std::uint32_t chunk_size);
+
+    //! Close the file.
+    ~TraceWriter() noexcept;
+
+    TraceWriter(TraceWriter&& writer) noexcept;
+
+    TraceWriter(const TraceWriter&) = delete;
+
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    std::uint16_t Content() const noexcept;
+
+    //! Get the number of records.
+    std::uint64_t Size() const noexcept;
+
+    /**
+     * @brief Write a record.
+     *
+     * @param address The instruction address.
+     * @param registers The register values, ignored if registers are not recorded.
+     * @param memory The address of the memory operand, ignored if memory is not recorded.
+     */
+    void Write(std::uintptr_t address, const TraceRegisters& registers,
+               std::optional<std::uintptr_t> memory);
+
+    //! Flush the last chunk, write the index and close the file.
+    void Close();
+
+private:
+    //! An entry in the chunk index.
+    struct Chunk {
+        std::uint64_t offset;
+        std::uint32_t size;
+        std::uint32_t count;
+    };
+
+    //! Write the buffered chunk to the file.
+    void FlushChunk();
+
+    //! Append data to the file.
+    void Append(std::span<const std::byte> data);
+
+    HANDLE file_;
+
+    std::uint16_t content_;
+
+    std::uint32_t chunk_size_;
+
+    //! The buffer of the current chunk.
+    std::vector<std::byte> buffer_;
+
+    //! The used size of the buffer.
+    std::size_t buffer_size_{ 0 };
+
+    //! The number of records in the current chunk.
+    std::uint32_t chunk_count_{ 0 };
+
+    //! The current file offset.
+    std::uint64_t offset_{ 0 };
+
+    //! The number of records.
+    std::uint64_t size_{ 0 };
+
+    std::vector<Chunk> chunks_{};
+
+    //! The previous instruction address.
+    std::uint32_t address_{ 0 };
+
+    //! The previous register values.
+    TraceRegisters registers_{};
+
+    //! The previous memory operand address.
+    std::uint32_t memory_{ 0 };
+};
+
+//! A trace file reader, mapping the file into memory.
+class TraceReader {
+public:
+    //! A sequential decoder of records.
+    class Cursor {
+    public:
+        //! Decode the next record.
+        std::optional<TraceRecord> Next();
+
+    private:
+        friend class TraceReader;
+
+        /**
+         * @brief Create a cursor.
+         *
+         * @param reader The reader.
+         * @param chunk The first chunk.
+         */
+        Cursor(const TraceReader& reader, std::size_t chunk) noexcept;
+
+        //! Move to the start of a chunk and reset the delta state.
+        void LoadChunk(std::size_t chunk) noexcept;
+
+        const TraceReader* reader_;
+
+        std::size_t chunk_;
+
+        //! The remaining records in the current chunk.
+        std::uint32_t remaining_{ 0 };
+
+        //! The remaining data in the current chunk.
+        std::span<const std::byte> data_{};
+
+        //! The index of the next record.
+        std::uint64_t index_{ 0 };
+
+        //! The previous record.
+        TraceRecord record_{};
+
+        //! The previous memory operand address.
+        std::uint32_t memory_{ 0 };
+    };
+
+    /**
+     * @brief Open a trace file.
+     *
+     * @param file_path The file path.
+     */
+    explicit TraceReader(std::wstring_view file_path);
+
+    //! Unmap and close the file.
+    ~TraceReader() noexcept;
+
+    TraceReader(TraceReader&& reader) noexcept;
+
+    TraceReader(const TraceReader&) = delete;
+
+    TraceReader& operator=(const TraceReader&) = delete;
+
+    std::uint16_t Content() const noexcept;
+
+    //! Get the number of records.
+    std::uint64_t Size() const noexcept;
+
+    //! Get the number of chunks.
+    std::size_t ChunkCount() const noexcept;
+
+    /**
+     * @brief Get a cursor at a record.
+     *
+     * @param index The record index.
+     */
+    Cursor Seek(std::uint64_t index) const;
+
+    /**
+     * @brief Get a record.
+     *
+     * @param index The record index.
+     */
+    TraceRecord At(std::uint64_t index) const;
+
+private:
+    //! Get the data of a chunk.
+    std::span<const std::byte> ChunkData(std::size_t chunk) const noexcept;
+
+    //! Get the number of records in a chunk.
+    std::uint32_t ChunkRecordCount(std::size_t chunk) const noexcept;
+
+    //! Close handles.
+    void Close() noexcept;
+
+    HANDLE file_{ INVALID_HANDLE_VALUE };
+
+    HANDLE mapping_{ nullptr };
+
+    //! The mapped file.
+    std::span<const std::byte> view_{};
+
+    //! The chunk index.
+    std::span<const std::byte> index_{};
+
+    std::uint16_t content_{ 0 };
+
+    std::uint32_t chunk_size_{ 0 };
+
+    std::uint64_t size_{ 0 };
+
+    std::size_t chunk_count_{ 0 };
+};
+
+/**
+ * @brief
+ * A compressed trace file writer, recording instruction addresses only.
+ *
+ * @details
+ * Records are split into basic blocks at non-sequential addresses.
+ * Repeating sequences of basic blocks, such as loops, are folded online
+ * into tokens of a sequence ID and a repeat count.
+ *
+ * @code
+ * ┌────────────┐
+ * │   Header   │  Magic, version and tokens per chunk.
+ * ├────────────┤
+ * │  Chunk 0   │  Tokens, each has a sequence ID and a repeat count.
+ * ├────────────┤
+ * │    ...     │
+ * ├────────────┤
+ * │   Blocks   │  The start address and instruction offsets of each basic block.
+ * ├────────────┤
+ * │ Sequences  │  The basic block IDs of each sequence.
+ * ├────────────┤
+ * │   Index    │  The offset, size, token count and first record index of each chunk.
+ * ├────────────┤
+ * │   Footer   │
+ * └────────────┘
+ * @endcode
+ */
+class CompressedTraceWriter {
+public:
+    //! The maximum number of instructions in a basic block.
+    static constexpr std::size_t max_block_length{ 0x100 };
+
+    //! The maximum number of basic blocks in a folded sequence.
+    static constexpr std::size_t max_loop_period{ 32 };
+
+    //! The number of pending blocks required to parse the oldest ones.
+    static constexpr std::size_t fold_window_size{ max_loop_period * 4 };
+
+    /**
+     * @brief Create a compressed trace file.
+     *
+     * @param file_path The file path, an existing file is overwritten.
+     * @param chunk_size The number of tokens in a chunk.
+     */
+    CompressedTraceWriter(std::wstring_view file_path, std::uint32_t chunk_size);
+
+    //! Close the file.
+    ~CompressedTraceWriter() noexcept;
+
+    CompressedTraceWriter(CompressedTraceWriter&& writer) noexcept;
+
+    CompressedTraceWriter(const CompressedTraceWriter&) = delete;
+
+    CompressedTraceWriter& operator=(const CompressedTraceWriter&) = delete;
+
+    //! Get the number of records.
+    std::uint64_t Size() const noexcept;
+
+    /**
+     * @brief Write a record.
+     *
+     * @param address The instruction address.
+     */
+    void Write(std::uintptr_t address);
+
+    //! Flush pending blocks, write dictionaries and the index, then close the file.
+    void Close();
+
+private:
+    //! A basic block in the dictionary.
+    struct Block {
+        std::uintptr_t start;
+
+        //! The position of the first offset in @p block_offsets_.
+        std::uint32_t begin;
+
+        std::uint32_t length;
+    };
+
+    //! A sequence of basic blocks in the dictionary.
+    struct Sequence {
+        //! The position of the first block ID in @p sequence_blocks_.
+        std::uint32_t begin;
+
+        std::uint32_t length;
+
+        //! The number of instructions in the sequence.
+        std::uint64_t instruction_count;
+    };
+
+    //! An entry in the chunk index.
+    struct Chunk {
+        std::uint64_t offset;
+        std::uint32_t size;
+        std::uint32_t count;
+
+        //! The index of the first record.
+        std::uint64_t first;
+    };
+
+    //! Finish the current basic block and fold it.
+    void EndBlock();
+
+    /**
+     * @brief Find or add a basic block.
+     *
+     * @return The block ID.
+     */
+    std::uint32_t InternBlock();
+
+    /**
+     * @brief Find or add a sequence.
+     *
+     * @param blocks The block IDs.
+     * @return The sequence ID.
+     */
+    std::uint32_t InternSequence(std::span<const std::uint32_t> blocks);
+
+    //! Fold a basic block into the current repetition or pending blocks.
+    void Fold(std::uint32_t block);
+
+    /**
+     * @brief
+     * Parse the oldest pending blocks.
+     * The sequence at the front covering the most blocks when repeated is emitted as a token,
+     * or starts a repetition if it covers all pending blocks.
+     * Without a repeating sequence, the oldest block is emitted alone.
+     */
+    void ParsePending();
+
+    /**
+     * @brief Emit pending blocks as single-block tokens.
+     *
+     * @param count The number of the oldest pending blocks to emit.
+     */
+    void EmitPending(std::size_t count);
+
+    //! Emit the current repetition if there is one, and move its incomplete repetition back to pending blocks.
+    void EmitRun();
+
+    /**
+     * @brief Emit a token.
+     *
+     * @param sequence The sequence ID.
+     * @param count The repeat count.
+     */
+    void EmitToken(std::uint32_t sequence, std::uint64_t count);
+
+    //! Write the buffered chunk to the file.
+    void FlushChunk();
+
+    //! Append data to the file.
+    void Append(std::span<const std::byte> data);
+
+    HANDLE file_;
+
+    std::uint32_t chunk_size_;
+
+    //! The buffer of the current chunk.
+    std::vector<std::byte> buffer_;
+
+    //! The used size of the buffer.
+    std::size_t buffer_size_{ 0 };
+
+    //! The number of tokens in the current chunk.
+    std::uint32_t chunk_count_{ 0 };
+
+    //! The index of the first record in the current chunk.
+    std::uint64_t chunk_first_{ 0 };
+
+    //! The number of records covered by emitted tokens.
+    std::uint64_t emitted_{ 0 };
+
+    //! The current file offset.
+    std::uint64_t offset_{ 0 };
+
+    //! The number of records.
+    std::uint64_t size_{ 0 };
+
+    std::vector<Chunk> chunks_{};
+
+    //! The start address of the current basic block.
+    std::uintptr_t block_start_{ 0 };
+
+    //! The previous instruction address.
+    std::uintptr_t address_{ 0 };
+
+    //! The number of instructions in the current basic block.
+    std::uint32_t block_length_{ 0 };
+
+    //! The hash of the current basic block.
+    std::uint64_t block_hash_{ 0 };
+
+    //! The instruction offsets of the current basic block.
+    std::array<std::uint16_t, max_block_length> current_offsets_{};
+
+    std::vector<Block> blocks_{};
+
+    //! Instruction offsets of all basic blocks.
+    std::vector<std::uint16_t> block_offsets_{};
+
+    //! Block IDs indexed by hash values.
+    std::unordered_multimap<std::uint64_t, std::uint32_t> block_ids_{};
+
+    std::vector<Sequence> sequences_{};
+
+    //! Block IDs of all sequences.
+    std::vector<std::uint32_t> sequence_blocks_{};
+
+    //! Sequence IDs indexed by hash values.
+    std::unordered_multimap<std::uint64_t, std::uint32_t> sequence_ids_{};
+
+    //! Recent blocks that have not been folded or emitted.
+    std::vector<std::uint32_t> pending_{};
+
+    //! Whether a sequence is repeating.
+    bool in_run_{ false };
+
+    //! The repeating sequence.
+    std::uint32_t run_sequence_{ 0 };
+
+    //! The number of complete repetitions.
+    std::uint64_t run_count_{ 0 };
+
+    //! The number of blocks matched in the incomplete repetition.
+    std::uint32_t run_position_{ 0 };
+};
+
+//! A compressed trace file reader.
+class CompressedTraceReader {
+public:
+    /**
+     * @brief Open a compressed trace file.
+     *
+     * @param file_path The file path.
+     */
+    explicit CompressedTraceReader(std::wstring_view file_path);
+
+    //! Unmap and close the file.
+    ~CompressedTraceReader() noexcept;
+
+    CompressedTraceReader(CompressedTraceReader&& reader) noexcept;
+
+    CompressedTraceReader(const CompressedTraceReader&) = delete;
+
+    CompressedTraceReader& operator=(const CompressedTraceReader&) = delete;
+
+    //! Get the number of records.
+    std::uint64_t Size() const noexcept;
+
+    //! Get the number of chunks.
+    std::size_t ChunkCount() const noexcept;
+
+    /**
+     * @brief Decode consecutive instruction addresses.
+     *
+     * @param index The index of the first record.
+     * @param addresses The buffer receiving instruction addresses.
+     * @return The number of decoded records.
+     */
+    std::size_t Read(std::uint64_t index,
+                     std::span<std::uintptr_t> addresses) const;
+
+    /**
+     * @brief Get an instruction address.
+     *
+     * @param index The record index.
+     */
+    std::uintptr_t At(std::uint64_t index) const;
+
+private:
+    //! An expanded sequence.
+    struct Sequence {
+        //! The position of the first address in @p addresses_.
+        std::size_t begin;
+
+        std::size_t length;
+    };
+
+    //! Load the block and sequence dictionaries.
+    void LoadDictionaries(std::span<const std::byte> blocks,
+                          std::span<const std::byte> sequences,
+                          std::uint32_t block_count,
+                          std::uint32_t sequence_count);
+
+    //! Get the data of a chunk.
+    std::span<const std::byte> ChunkData(std::size_t chunk) const noexcept;
+
+    //! Get the index of the first record in a chunk.
+    std::uint64_t ChunkFirst(std::size_t chunk) const noexcept;
+
+    //! Close handles.
+    void Close() noexcept;
+
+    HANDLE file_{ INVALID_HANDLE_VALUE };
+
+    HANDLE mapping_{ nullptr };
+
+    //! The mapped file.
+    std::span<const std::byte> view_{};
+
+    //! The chunk index.
+    std::span<const std::byte> index_{};
+
+    std::uint64_t size_{ 0 };
+
+    std::size_t chunk_count_{ 0 };
+
+    std::vector<Sequence> sequences_{};
+
+    //! Instruction addresses of all sequences, each sequence is expanded once.
+    std::vector<std::uintptr_t> addresses_{};
+};
+
+/**
+ * @brief
+ * An instruction trace session of a thread.
+ * It owns the trace file and a cache of decoded instructions.
+ *
+ * @warning
+ * Cached instructions are not invalidated, so self-modifying code may be decoded incorrectly.
+ */
+class Tracer {
+public:
+    //! The number of entries in the instruction cache.
+    static constexpr std::size_t instruction_cache_size{ 0x400 };
+
+    /**
+     * @brief Create a trace session.
+     *
+     * @param process_id The ID of the process the thread belongs to.
+     * @param file_path The trace file path.
+     * @param options Trace options.
+     */
+    Tracer(std::uint32_t process_id, std::wstring_view file_path,
+           const TraceOptions& options);
+
+    Tracer(Tracer&& tracer) noexcept = default;
+
+    Tracer(const Tracer&) = delete;
+
+    Tracer& operator=(const Tracer&) = delete;
+
+    std::uint32_t ProcessId() const noexcept;
+
+    const TraceOptions& Options() const noexcept;
+
+    /**
+     * @brief Write a record.
+     *
+     * @param address The instruction address.
+     * @param registers The register values, ignored if registers are not recorded.
+     * @param memory The address of the memory operand, ignored if memory is not recorded.
+     */
+    void Write(std::uintptr_t address, const TraceRegisters& registers,
+               std::optional<std::uintptr_t> memory);
+
+    //! Close the trace file.
+    void Close();
+
+    //! Whether an address is in the traced range.
+    bool InRange(std::uintptr_t address) const noexcept;
+
+    //! Whether instructions need to be decoded, for memory operands or calls leaving the traced range.
+    bool DecodesInstructions() const noexcept;
+
+    /**
+     * @brief Find an instruction in the cache.
+     *
+     * @param address The instruction address.
+     * @return The instruction, or @p nullptr if it has not been cached.
+     */
+    const Instruction* FindInstruction(std::uintptr_t address) const noexcept;
+
+    //! Cache an instruction.
+    const Instruction& CacheInstruction(const Instruction& instruction) noexcept;
+
+    /**
+     * @brief Set the call executed by the last step.
+     *
+     * @param address The return address.
+     * @param frame The stack pointer before the call.
+     */
+    void SetCall(std::uintptr_t address, std::uintptr_t frame) noexcept;
+
+    //! Whether the last step has executed a call.
+    bool HasCall() const noexcept;
+
+    //! Get the return address of the call executed by the last step.
+    std::uintptr_t CallReturnAddress() const noexcept;
+
+    void ResetCall() noexcept;
+
+    //! Run the last call at full speed until it returns.
+    void SkipCall() noexcept;
+
+    //! Whether the thread is running a call outside the traced range.
+    bool Skipping() const noexcept;
+
+    /**
+     * @brief Whether the thread has returned from the skipped call.
+     *
+     * @param address The current instruction address.
+     * @param stack The current stack pointer.
+     */
+    bool ReachedSkip(std::uintptr_t address,
+                     std::uintptr_t stack) const noexcept;
+
+    void ResetSkip() noexcept;
+
+private:
+    std::uint32_t process_id_;
+
+    TraceOptions options_;
+
+    std::variant<TraceWriter, CompressedTraceWriter> writer_;
+
+    //! A direct-mapped cache of decoded instructions, indexed by address.
+    std::vector<Instruction> instructions_;
+
+    bool has_call_{ false };
+
+    bool skipping_{ false };
+
+    //! The return address of the last call.
+    std::uintptr_t call_address_{ 0 };
+
+    //! The stack pointer before the last call.
+    std::uintptr_t call_frame_{ 0 };
+};
\ No newline at end of file
@@ -0,0 +1,219 @@
+/**
+ * @file tracepoint.h
+ * @brief Tracepoints.
+ *
+ * @details
+ * A tracepoint is a software breakpoint that captures registers and memory slices
+ * into a preallocated ring buffer, then lets the thread continue without user callbacks.
+ *
+ * It is declared by a list of registers and memory expressions, for example:
+ *
+ * ```
+ * eax, ecx, [esp+4], [ecx+0x10]:32, [ebx+esi*4-8]:2
+ * ```
+ *
+ * A memory expression reads 4 bytes unless a size follows the colon.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "instruction.h"
+#include "register/register.h"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+//! The maximum number of memory expressions of a tracepoint.
+inline constexpr std::size_t max_tracepoint_memory_count{ 16 };
+
+//! The size of the data captured by a tracepoint record in bytes.
+inline constexpr std::size_t tracepoint_payload_size{ 0x100 };
+
+//! The default number of records in a tracepoint buffer.
+inline constexpr std::size_t default_tracepoint_buffer_capacity{ 0x1000 };
+
+//! A fixed-size record captured by a tracepoint.
+struct TracepointRecord {
+    //! The sequence number since the buffer was created or cleared.
+    std::uint64_t sequence{ 0 };
+
+    //! The memory address of the tracepoint.
+    std::uintptr_t address{ 0 };
+
+    std::uint32_t process_id{ 0 };
+
+    std::uint32_t thread_id{ 0 };
+
+    //! A bit mask of memory expressions that could not be read, whose data are zeros.
+    std::uint16_t failures{ 0 };
+
+    //! The used size of the payload.
+    std::uint16_t size{ 0 };
+
+    //! Register values in the order of @p RegisterIndex, followed by memory data in the order of expressions.
+    std::array<std::byte, tracepoint_payload_size> payload{};
+};
+
+//! A memory slice captured by a tracepoint.
+struct TracepointMemory {
+    MemoryOperand operand;
+
+    //! The size in bytes.
+    std::uint16_t size{ sizeof(std::uint32_t) };
+
+    //! The offset in record payloads.
+    std::uint16_t offset{ 0 };
+};
+
+//! A tracepoint.
+struct Tracepoint {
+    //! Whether a register is captured.
+    constexpr bool Captures(const RegisterIndex index) const noexcept {
+        return (registers & RegisterBit(index)) != 0;
+    }
+
+    //! Get the size of the data captured by each hit.
+    std::size_t PayloadSize() const noexcept;
+
+    /**
+     * @brief Get a register value from a record.
+     *
+     * @param record A record captured by this tracepoint.
+     * @param index The register index.
+     * @return The value, or @p std::nullopt if the register is not captured.
+     */
+    std::optional<std::uint32_t> Register(const TracepointRecord& record,
+                                          RegisterIndex index) const noexcept;
+
+    /**
+     * @brief Get a memory slice from a record.
+     *
+     * @param record A record captured by this tracepoint.
+     * @param index The index of the memory expression.
+     * @return The data, or an empty span if the index is out of range.
+     */
+    std::span<const std::byte> Memory(const TracepointRecord& record,
+                                      std::size_t index) const noexcept;
+
+    /**
+     * @brief Write captured register values to a record.
+     *
+     * @param record The record.
+     * @param read A function reading the value of a register.
+     */
+    template <std::invocable<RegisterIndex> Reader>
+    void CaptureRegisters(TracepointRecord& record,
+                          Reader&& read) const noexcept {
+        std::size_t offset{ 0 };
+        for (auto mask{ registers }; mask != 0; mask &= mask - 1) {
+            const auto index{ static_cast<RegisterIndex>(
+                std::countr_zero(mask)) };
+            const auto value{ static_cast<std::uint32_t>(read(index)) };
+            std::memcpy(record.payload.data() + offset, &value, sizeof(value));
+            offset += sizeof(value);
+        }
+    }
+
+    //! Get the bit of a register in @p registers.
+    static constexpr std::uint32_t RegisterBit(
+        const RegisterIndex index) noexcept {
+        return 1U << static_cast<std::uint32_t>(index);
+    }
+
+    std::uintptr_t address{ 0 };
+
+    //! A bit mask of captured registers, indexed by @p RegisterIndex.
+    std::uint32_t registers{ 0 };
+
+    std::vector<TracepointMemory> memory{};
+};
+
+//! An optional reference to a tracepoint.
+using OptionalTracepoint =
+    std::optional<std::reference_wrapper<const Tracepoint>>;
+
+/**
+ * @brief Parse a tracepoint declaration.
+ *
+ * @param address The memory address of the tracepoint.
+ * @param declaration Registers and memory expressions separated by commas.
+ * @exception std::runtime_error The declaration is invalid.
+ */
+Tracepoint ParseTracepoint(std::uintptr_t address,
+                           std::string_view declaration);
+
+/**
+ * @brief Parse a tracepoint memory expression, such as `[esp+4]` or `[ecx+0x10]:32`.
+ *
+ * @exception std::runtime_error The expression is invalid.
+ */
+TracepointMemory ParseTracepointMemory(std::string_view expression);
+
+/**
+ * @brief
+ * A preallocated ring buffer of tracepoint records.
+ * The oldest records are overwritten when it is full.
+ */
+class TracepointBuffer {
+public:
+    /**
+     * @brief Create a buffer.
+     *
+     * @param capacity The maximum number of records.
+     */
+    explicit TracepointBuffer(
+        std::size_t capacity = default_tracepoint_buffer_capacity);
+
+    /**
+     * @brief Get the next record to be filled, overwriting the oldest one if the buffer is full.
+     *
+     * @return The record, whose sequence number has been set.
+     */
+    TracepointRecord& Push() noexcept;
+
+    /**
+     * @brief Get a record.
+     *
+     * @param index The index, where zero is the oldest available record.
+     */
+    const TracepointRecord& operator[](std::size_t index) const noexcept;
+
+    //! Get the maximum number of records.
+    std::size_t Capacity() const noexcept;
+
+    //! Get the number of available records.
+    std::size_t Size() const noexcept;
+
+    //! Get the number of records pushed since the buffer was created or cleared.
+    std::uint64_t Count() const noexcept;
+
+    //! Get the number of records that have been overwritten.
+    std::uint64_t Overwritten() const noexcept;
+
+    //! Remove all records.
+    void Clear() noexcept;
+
+private:
+    std::vector<TracepointRecord> records_;
+
+    std::uint64_t count_{ 0 };
+};
\ No newline at end of file
@@ -1,10 +1,36 @@
 #include "breakpoint.h"
 
+#include <algorithm>
+
 
 Breakpoint::Breakpoint(const std::uintptr_t address, const BreakpointType type,
                        const bool single_shoot) noexcept :
     address{ address }, type{ type }, single_shoot{ single_shoot } {}
 
+bool Breakpoint::Hit() noexcept {
+    if (!enabled) {
+        return false;
+    }
+
+    ++hits;
+    if (hits <= hit_policy.ignore_count) {
+        return false;
+    }
+
+    const auto sample_rate{ std::max<std::uint64_t>(hit_policy.sample_rate,
+                                                    1) };
+    if ((hits - hit_policy.ignore_count - 1) % sample_rate != 0) {
+        return false;
+    }
+
+    ++reported_hits;
+    return true;
+}
+
+bool Breakpoint::Exhausted() const noexcept {
+    return hit_policy.max_hits != 0 && reported_hits >= hit_policy.max_hits;
+}
+
 
 SoftwareBreakpoint::SoftwareBreakpoint(const std::uintptr_t address,
                                        const std::byte original_byte,
@@ -21,4 +47,14 @@ HardwareBreakpoint::HardwareBreakpoint(const std::uintptr_t address,
     Breakpoint{ address, BreakpointType::Hardware, single_shoot },
     slot{ slot },
     access{ access },
-    size{ size } {}
\ No newline at end of file
+    size{ size } {}
+
+
+ReturnBreakpoint::ReturnBreakpoint(const std::uintptr_t address,
+                                   const std::byte original_byte) noexcept :
+    address{ address }, original_byte{ original_byte } {}
+
+
+bool ThreadFilter::Contains(const std::uint32_t thread_id) const noexcept {
+    return std::ranges::binary_search(threads, thread_id);
+}
\ No newline at end of file
@@ -0,0 +1,469 @@
+#include "condition.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+
+namespace {
+
+//! A context for folding constant sub-expressions, which never reads registers or memory.
+class ConstantContext final : public ConditionContext {
+public:
+    std::uint32_t ReadRegister(RegisterIndex) const noexcept override {
+        return 0;
+    }
+
+    bool ReadMemory(std::uintptr_t, std::span<std::byte>) noexcept override {
+        return false;
+    }
+};
+
+//! Symbols, where longer ones come first.
+constexpr std::array<std::string_view, 24> symbols{
+    "||", "&&", "==", "!=", "<=", ">=", "<<", ">>", "|", "^", "&", "<",
+    ">",  "+",  "-",  "*",  "/",  "%",  "!",  "~",  "(", ")", "[", "]"
+};
+
+}  // namespace
+
+
+//! A recursive descent compiler from expressions to bytecode.
+class Condition::Compiler {
+public:
+    Compiler(const std::string_view expression,
+             std::vector<std::uint8_t>& code) noexcept :
+        expression_{ expression }, code_{ code } {}
+
+    //! Compile the expression.
+    void Compile() {
+        Next();
+        ParseBinary(0);
+        if (token_.type != TokenType::End) {
+            Fail(std::format("unexpected '{}'", token_.text));
+        }
+
+        CheckStackDepth();
+    }
+
+private:
+    enum class TokenType { End, Number, Identifier, Symbol };
+
+    struct Token {
+        TokenType type{ TokenType::End };
+
+        std::string_view text{};
+
+        std::uint32_t number{ 0 };
+    };
+
+    //! A compiled sub-expression.
+    struct Value {
+        //! The offset of its first instruction.
+        std::size_t begin;
+
+        //! The value if it is a constant.
+        std::optional<std::uint32_t> constant;
+    };
+
+    //! A binary operator.
+    struct BinaryOperator {
+        std::string_view symbol;
+
+        Opcode opcode;
+    };
+
+    //! The number of binary precedence levels.
+    static constexpr std::size_t precedence_levels{ 10 };
+
+    //! Get binary operators of a precedence level, from the lowest to the highest.
+    static std::span<const BinaryOperator> Operators(const std::size_t level) {
+        static constexpr std::array<BinaryOperator, 1> logical_or{
+            { { "||", Opcode::JumpIfTrue } }
+        };
+        static constexpr std::array<BinaryOperator, 1> logical_and{
+            { { "&&", Opcode::JumpIfFalse } }
+        };
+        static constexpr std::array<BinaryOperator, 1> bit_or{
+            { { "|", Opcode::BitOr } }
+        };
+        static constexpr std::array<BinaryOperator, 1> bit_xor{
+            { { "^", Opcode::BitXor } }
+        };
+        static constexpr std::array<BinaryOperator, 1> bit_and{
+            { { "&", Opcode::BitAnd } }
+        };
+        static constexpr std::array<BinaryOperator, 2> equality{
+            { { "==", Opcode::Equal }, { "!=", Opcode::NotEqual } }
+        };
+        static constexpr std::array<BinaryOperator, 4> relation{
+            { { "<", Opcode::Less },
+              { "<=", Opcode::LessEqual },
+              { ">", Opcode::Greater },
+              { ">=", Opcode::GreaterEqual } }
+        };
+        static constexpr std::array<BinaryOperator, 2> shift{
+            { { "<<", Opcode::ShiftLeft }, { ">>", Opcode::ShiftRight } }
+        };
+        static constexpr std::array<BinaryOperator, 2> additive{
+            { { "+", Opcode::Add }, { "-", Opcode::Subtract } }
+        };
+        static constexpr std::array<BinaryOperator, 3> multiplicative{
+            { { "*", Opcode::Multiply },
+              { "/", Opcode::Divide },
+              { "%", Opcode::Modulo } }
+        };
+
+        static constexpr std::array<std::span<const BinaryOperator>,
+                                    precedence_levels>
+            levels{ logical_or, logical_and, bit_or,   bit_xor,  bit_and,
+                    equality,   relation,    shift,    additive, multiplicative };
+        return levels[level];
+    }
+
+    //! Throw an exception for an invalid expression.
+    [[noreturn]] void Fail(const std::string_view reason) const {
+        throw std::runtime_error{ std::format("Invalid condition '{}': {}.",
+                                              expression_, reason) };
+    }
+
+    //! Read the next token.
+    void Next() {
+        while (position_ < expression_.size()
+               && std::isspace(
+                   static_cast<unsigned char>(expression_[position_]))) {
+            ++position_;
+        }
+
+        const auto rest{ expression_.substr(position_) };
+        if (rest.empty()) {
+            token_ = {};
+            return;
+        }
+
+        const auto first{ static_cast<unsigned char>(rest.front()) };
+        if (std::isdigit(first)) {
+            auto base{ 10 };
+            auto begin{ rest.data() };
+            if (rest.size() > 2 && rest[0] == '0'
+                && (rest[1] == 'x' || rest[1] == 'X')) {
+                base = 16;
+                begin += 2;
+            }
+
+            std::uint32_t number{ 0 };
+            const auto [end, error]{ std::from_chars(
+                begin, rest.data() + rest.size(), number, base) };
+            if (error != std::errc{} || end == begin
+                || (end != rest.data() + rest.size()
+                    && std::isalnum(static_cast<unsigned char>(*end)))) {
+                Fail("invalid number");
+            }
+
+            const auto length{ static_cast<std::size_t>(end - rest.data()) };
+            token_ = { TokenType::Number, rest.substr(0, length), number };
+            position_ += length;
+
+        } else if (std::isalpha(first)) {
+            const auto end{ std::ranges::find_if_not(rest, [](const char c) {
+                return std::isalnum(static_cast<unsigned char>(c));
+            }) };
+            const auto length{ static_cast<std::size_t>(end - rest.begin()) };
+            token_ = { TokenType::Identifier, rest.substr(0, length) };
+            position_ += length;
+
+        } else {
+            const auto symbol{ std::ranges::find_if(
+                symbols, [rest](const auto symbol) {
+                    return rest.starts_with(symbol);
+                }) };
+            if (symbol == symbols.cend()) {
+                Fail(std::format("unexpected character '{}'", rest.front()));
+            }
+
+            token_ = { TokenType::Symbol, *symbol };
+            position_ += symbol->size();
+        }
+    }
+
+    //! Consume the current token if it is a symbol.
+    bool Accept(const std::string_view symbol) {
+        if (token_.type == TokenType::Symbol && token_.text == symbol) {
+            Next();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    //! Consume a symbol or fail.
+    void Expect(const std::string_view symbol) {
+        if (!Accept(symbol)) {
+            Fail(std::format("'{}' is expected", symbol));
+        }
+    }
+
+    //! Parse binary operations at or above a precedence level.
+    Value ParseBinary(const std::size_t level) {
+        if (level == precedence_levels) {
+            return ParseUnary();
+        }
+
+        auto lhs{ ParseBinary(level + 1) };
+        while (true) {
+            const auto operators{ Operators(level) };
+            const auto found{ std::ranges::find_if(
+                operators, [this](const auto& binary) {
+                    return token_.type == TokenType::Symbol
+                           && token_.text == binary.symbol;
+                }) };
+            if (found == operators.end()) {
+                return lhs;
+            }
+
+            Next();
+            if (found->opcode == Opcode::JumpIfFalse
+                || found->opcode == Opcode::JumpIfTrue) {
+                lhs = EmitLogical(lhs, found->opcode, level);
+            } else {
+                const auto rhs{ ParseBinary(level + 1) };
+                Emit(found->opcode);
+                lhs = Fold(lhs, rhs);
+            }
+        }
+    }
+
+    /**
+     * @brief Emit a short-circuit logical operation.
+     *
+     * @param lhs The left operand, which has been emitted.
+     * @param jump @p JumpIfFalse for `&&` and @p JumpIfTrue for `||`.
+     * @param level The precedence level.
+     */
+    Value EmitLogical(const Value lhs, const Opcode jump,
+                      const std::size_t level) {
+        const auto short_circuit{ jump == Opcode::JumpIfTrue };
+        if (lhs.constant && (*lhs.constant != 0) == short_circuit) {
+            // The right operand is never evaluated.
+            code_.resize(lhs.begin);
+            ParseBinary(level + 1);
+            code_.resize(lhs.begin);
+            EmitConstant(short_circuit ? 1 : 0);
+            return { lhs.begin, short_circuit ? 1U : 0U };
+        }
+
+        if (lhs.constant) {
+            // The result only depends on the right operand.
+            code_.resize(lhs.begin);
+            const auto rhs{ ParseBinary(level + 1) };
+            Emit(Opcode::Boolean);
+            return Fold({ lhs.begin, rhs.constant }, rhs);
+        }
+
+        Emit(Opcode::Boolean);
+        Emit(jump);
+        const auto target{ code_.size() };
+        code_.resize(code_.size() + sizeof(std::uint16_t));
+
+        ParseBinary(level + 1);
+        Emit(Opcode::Boolean);
+
+        if (code_.size() > std::numeric_limits<std::uint16_t>::max()) {
+            Fail("it is too long");
+        }
+
+        const auto end{ static_cast<std::uint16_t>(code_.size()) };
+        std::memcpy(code_.data() + target, &end, sizeof(end));
+        return { lhs.begin, std::nullopt };
+    }
+
+    //! Parse unary operations.
+    Value ParseUnary() {
+        // Nested operands recurse through here, so the depth is limited before the native stack overflows.
+        if (++nesting_ > max_condition_nesting_depth) {
+            Fail("it is nested too deeply");
+        }
+
+        const auto begin{ code_.size() };
+        for (const auto& [symbol, opcode] :
+             { std::pair{ "-", Opcode::Negate },
+               std::pair{ "~", Opcode::Complement },
+               std::pair{ "!", Opcode::LogicalNot } }) {
+            if (Accept(symbol)) {
+                const auto operand{ ParseUnary() };
+                Emit(opcode);
+                --nesting_;
+                return Fold({ begin, operand.constant }, operand);
+            }
+        }
+
+        const auto value{ ParsePrimary() };
+        --nesting_;
+        return value;
+    }
+
+    //! Parse numbers, registers, memory reads and parentheses.
+    Value ParsePrimary() {
+        const auto begin{ code_.size() };
+        if (token_.type == TokenType::Number) {
+            const auto number{ token_.number };
+            Next();
+            EmitConstant(number);
+            return { begin, number };
+
+        } else if (token_.type == TokenType::Identifier) {
+            const auto name{ token_.text };
+            Next();
+
+            static constexpr std::array<std::pair<std::string_view, Opcode>, 3>
+                sizes{ { { "byte", Opcode::LoadByte },
+                         { "word", Opcode::LoadWord },
+                         { "dword", Opcode::LoadDword } } };
+            for (const auto& [keyword, load] : sizes) {
+                if (std::ranges::equal(name, keyword, [](const char c,
+                                                         const char k) {
+                        return std::tolower(static_cast<unsigned char>(c)) == k;
+                    })) {
+                    Expect("[");
+                    return ParseMemory(load);
+                }
+            }
+
+            const auto index{ ParseRegisterIndex(name) };
+            if (!index || !IsGeneralRegister(*index)) {
+                Fail(std::format("'{}' is not a general register", name));
+            }
+
+            Emit(Opcode::Register);
+            code_.push_back(static_cast<std::uint8_t>(*index));
+            return { begin, std::nullopt };
+
+        } else if (Accept("[")) {
+            return ParseMemory(Opcode::LoadDword);
+
+        } else if (Accept("(")) {
+            const auto value{ ParseBinary(0) };
+            Expect(")");
+            return value;
+
+        } else {
+            Fail(token_.type == TokenType::End
+                     ? std::string{ "an operand is missing" }
+                     : std::format("unexpected '{}'", token_.text));
+        }
+    }
+
+    //! Parse a memory read after its opening bracket.
+    Value ParseMemory(const Opcode load) {
+        const auto address{ ParseBinary(0) };
+        Expect("]");
+        Emit(load);
+        return { address.begin, std::nullopt };
+    }
+
+    void Emit(const Opcode opcode) {
+        code_.push_back(static_cast<std::uint8_t>(opcode));
+    }
+
+    void EmitConstant(const std::uint32_t value) {
+        Emit(Opcode::Constant);
+        const auto offset{ code_.size() };
+        code_.resize(offset + sizeof(value));
+        std::memcpy(code_.data() + offset, &value, sizeof(value));
+    }
+
+    /**
+     * @brief Replace an operation just emitted with a constant if all of its operands are constants.
+     *
+     * @param lhs The first operand.
+     * @param rhs The last operand.
+     * @return The result.
+     */
+    Value Fold(const Value lhs, const Value rhs) {
+        if (!lhs.constant || !rhs.constant) {
+            return { lhs.begin, std::nullopt };
+        }
+
+        ConstantContext context{};
+        const auto value{ Execute(std::span{ code_ }.subspan(lhs.begin),
+                                  context) };
+        if (!value) {
+            // Errors such as divisions by zero are kept until evaluation.
+            return { lhs.begin, std::nullopt };
+        }
+
+        code_.resize(lhs.begin);
+        EmitConstant(*value);
+        return { lhs.begin, *value };
+    }
+
+    //! Check whether the evaluation stack is deep enough.
+    void CheckStackDepth() const {
+        std::size_t depth{ 0 };
+        std::size_t max_depth{ 0 };
+        for (std::size_t pc{ 0 }; pc < code_.size();) {
+            switch (static_cast<Opcode>(code_[pc++])) {
+                case Opcode::Constant: {
+                    pc += sizeof(std::uint32_t);
+                    ++depth;
+                    break;
+                }
+                case Opcode::Register: {
+                    ++pc;
+                    ++depth;
+                    break;
+                }
+                case Opcode::JumpIfFalse:
+                case Opcode::JumpIfTrue: {
+                    pc += sizeof(std::uint16_t);
+                    --depth;
+                    break;
+                }
+                case Opcode::LoadByte:
+                case Opcode::LoadWord:
+                case Opcode::LoadDword:
+                case Opcode::Negate:
+                case Opcode::Complement:
+                case Opcode::LogicalNot:
+                case Opcode::Boolean: {
+                    break;
+                }
+                default: {
+                    --depth;
+                    break;
+                }
+            }
+
+            max_depth = std::max(max_depth, depth);
+        }
+
+        if (max_depth > max_condition_stack_depth) {
+            Fail("it is nested too deeply");
+        }
+    }
+
+    std::string_view expression_;
+
+    std::vector<std::uint8_t>& code_;
+
+    std::size_t position_{ 0 };
+
+    Token token_{};
+
+    //! The number of operands being parsed.
+    std::size_t nesting_{ 0 };
+};
+
+
+Condition::Condition(const std::string_view expression) :
+    expression_{ expression } {
+    Compiler{ expression_, code_ }.Compile();
+    code_.shrink_to_fit();
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "condition.h"
+
+#include <array>
+#include <cstring>
+
+
+namespace {
+
+/**
+ * @brief Read an unsigned integer from memory.
+ *
+ * @param context The thread state.
+ * @param address The memory address.
+ * @param[out] value The value.
+ * @return @p true if it succeeds, otherwise @p false.
+ */
+template <typename T>
+bool Load(ConditionContext& context, const std::uint32_t address,
+          std::uint32_t& value) noexcept {
+    T data{ 0 };
+    if (!context.ReadMemory(address, std::as_writable_bytes(
+                                         std::span{ &data, 1 }))) {
+        return false;
+    }
+
+    value = data;
+    return true;
+}
+
+}  // namespace
+
+
+std::string_view Condition::Expression() const noexcept {
+    return expression_;
+}
+
+std::span<const std::uint8_t> Condition::Bytecode() const noexcept {
+    return code_;
+}
+
+std::optional<std::uint32_t> Condition::Evaluate(
+    ConditionContext& context) const noexcept {
+    return Execute(code_, context);
+}
+
+bool Condition::Matches(ConditionContext& context) const noexcept {
+    return Evaluate(context).value_or(1) != 0;
+}
+
+std::optional<std::uint32_t> Condition::Execute(
+    const std::span<const std::uint8_t> code,
+    ConditionContext& context) noexcept {
+    std::array<std::uint32_t, max_condition_stack_depth> stack;
+    std::size_t size{ 0 };
+
+    for (std::size_t pc{ 0 }; pc < code.size();) {
+        const auto opcode{ static_cast<Opcode>(code[pc++]) };
+        if (opcode >= Opcode::Multiply && opcode <= Opcode::BitOr) {
+            const auto rhs{ stack[--size] };
+            auto& lhs{ stack[size - 1] };
+            switch (opcode) {
+                case Opcode::Multiply: {
+                    lhs *= rhs;
+                    break;
+                }
+                case Opcode::Divide: {
+                    if (rhs == 0) {
+                        return std::nullopt;
+                    }
+
+                    lhs /= rhs;
+                    break;
+                }
+                case Opcode::Modulo: {
+                    if (rhs == 0) {
+                        return std::nullopt;
+                    }
+
+                    lhs %= rhs;
+                    break;
+                }
+                case Opcode::Add: {
+                    lhs += rhs;
+                    break;
+                }
+                case Opcode::Subtract: {
+                    lhs -= rhs;
+                    break;
+                }
+                case Opcode::ShiftLeft: {
+                    lhs = rhs < 32 ? lhs << rhs : 0;
+                    break;
+                }
+                case Opcode::ShiftRight: {
+                    lhs = rhs < 32 ? lhs >> rhs : 0;
+                    break;
+                }
+                case Opcode::Less: {
+                    lhs = lhs < rhs;
+                    break;
+                }
+                case Opcode::LessEqual: {
+                    lhs = lhs <= rhs;
+                    break;
+                }
+                case Opcode::Greater: {
+                    lhs = lhs > rhs;
+                    break;
+                }
+                case Opcode::GreaterEqual: {
+                    lhs = lhs >= rhs;
+                    break;
+                }
+                case Opcode::Equal: {
+                    lhs = lhs == rhs;
+                    break;
+                }
+                case Opcode::NotEqual: {
+                    lhs = lhs != rhs;
+                    break;
+                }
+                case Opcode::BitAnd: {
+                    lhs &= rhs;
+                    break;
+                }
+                case Opcode::BitXor: {
+                    lhs ^= rhs;
+                    break;
+                }
+                case Opcode::BitOr: {
+                    lhs |= rhs;
+                    break;
+                }
+                default: {
+                    break;
+                }
+            }
+
+            continue;
+        }
+
+        switch (opcode) {
+            case Opcode::Constant: {
+                std::memcpy(&stack[size++], code.data() + pc,
+                            sizeof(std::uint32_t));
+                pc += sizeof(std::uint32_t);
+                break;
+            }
+            case Opcode::Register: {
+                stack[size++] = context.ReadRegister(
+                    static_cast<RegisterIndex>(code[pc++]));
+                break;
+            }
+            case Opcode::LoadByte: {
+                if (!Load<std::uint8_t>(context, stack[size - 1],
+                                        stack[size - 1])) {
+                    return std::nullopt;
+                }
+
+                break;
+            }
+            case Opcode::LoadWord: {
+                if (!Load<std::uint16_t>(context, stack[size - 1],
+                                         stack[size - 1])) {
+                    return std::nullopt;
+                }
+
+                break;
+            }
+            case Opcode::LoadDword: {
+                if (!Load<std::uint32_t>(context, stack[size - 1],
+                                         stack[size - 1])) {
+                    return std::nullopt;
+                }
+
+                break;
+            }
+            case Opcode::Negate: {
+                stack[size - 1] = 0U - stack[size - 1];
+                break;
+            }
+            case Opcode::Complement: {
+                stack[size - 1] = ~stack[size - 1];
+                break;
+            }
+            case Opcode::LogicalNot: {
+                stack[size - 1] = stack[size - 1] == 0;
+                break;
+            }
+            case Opcode::Boolean: {
+                stack[size - 1] = stack[size - 1] != 0;
+                break;
+            }
+            case Opcode::JumpIfFalse:
+            case Opcode::JumpIfTrue: {
+                std::uint16_t target{ 0 };
+                std::memcpy(&target, code.data() + pc, sizeof(target));
+                pc += sizeof(target);
+                if ((stack[size - 1] != 0) == (opcode == Opcode::JumpIfTrue)) {
+                    pc = target;
+                } else {
+                    --size;
+                }
+
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    return stack[0];
+}
\ No newline at end of file
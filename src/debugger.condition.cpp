@@ -0,0 +1,90 @@
+#include "debugger.h"
+#include "register/registers.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+
+namespace {
+
+//! The size of memory lines cached for condition evaluation.
+constexpr std::size_t condition_cache_line_size{ 0x40 };
+
+//! The number of memory lines cached for condition evaluation.
+constexpr std::size_t condition_cache_line_count{ 4 };
+
+/**
+ * @brief
+ * The state of a stopped thread where breakpoint conditions are evaluated.
+ * Memory is read in aligned lines, so nearby reads share one @p ReadProcessMemory call.
+ */
+class StoppedThreadContext final : public ConditionContext {
+public:
+    StoppedThreadContext(const Process& process,
+                         const Registers& registers) noexcept :
+        process_{ process }, registers_{ registers } {}
+
+    std::uint32_t ReadRegister(const RegisterIndex index) const noexcept override {
+        return static_cast<std::uint32_t>(registers_.Get(index));
+    }
+
+    bool ReadMemory(const std::uintptr_t address,
+                    const std::span<std::byte> buffer) noexcept override {
+        const auto line_address{ address & ~(condition_cache_line_size - 1) };
+        if (address - line_address + buffer.size() > condition_cache_line_size) {
+            return process_.ReadMemorySafe(address, buffer);
+        }
+
+        auto line{ std::ranges::find_if(lines_, [line_address](const auto& line) {
+            return line.valid && line.address == line_address;
+        }) };
+
+        if (line == lines_.end()) {
+            line = lines_.begin() + next_line_;
+            next_line_ = (next_line_ + 1) % condition_cache_line_count;
+
+            line->valid = process_.ReadMemorySafe(line_address, line->data);
+            line->address = line_address;
+            if (!line->valid) {
+                return false;
+            }
+        }
+
+        std::memcpy(buffer.data(), line->data.data() + (address - line_address),
+                    buffer.size());
+        return true;
+    }
+
+private:
+    struct Line {
+        std::uintptr_t address{ 0 };
+
+        bool valid{ false };
+
+        std::array<std::byte, condition_cache_line_size> data;
+    };
+
+    const Process& process_;
+
+    const Registers& registers_;
+
+    std::array<Line, condition_cache_line_count> lines_{};
+
+    std::size_t next_line_{ 0 };
+};
+
+}  // namespace
+
+
+bool Debugger::MatchBreakpointCondition(
+    const BreakpointKey breakpoint, const Registers& registers) const noexcept {
+    const auto& process{ DebuggedProcess() };
+    const auto condition{ process.FindBreakpointCondition(breakpoint) };
+    if (!condition) {
+        return true;
+    }
+
+    StoppedThreadContext context{ process, registers };
+    return condition->get().Matches(context);
+}
\ No newline at end of file
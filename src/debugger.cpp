@@ -32,7 +32,7 @@ void Debugger::Create(const std::wstring_view file_path,
     }
 }
 
-void Debugger::Attach(const std::uint32_t process_id) {
+void Debugger::Attach(const std::uint32_t process_id, const bool fast) {
     ClearCache();
 
     if (!DebugActiveProcess(process_id)) {
@@ -40,14 +40,25 @@ void Debugger::Attach(const std::uint32_t process_id) {
     }
 
     attached_ = true;
+    fast_attach_ = fast;
 }
 
 void Debugger::Start() {
     debugging_ = true;
 
     while (!main_process_exited_) {
+        // Buffers of the previous event are released even if its handlers failed.
+        event_arena_.release();
+
         try {
-            if (!WaitForDebugEvent(&debug_event_, INFINITE)) {
+            SampleProfile();
+
+            if (!WaitForDebugEvent(&debug_event_, ProfileTimeout())) {
+                // A timeout only wakes the loop for the next sample.
+                if (GetLastError() == ERROR_SEM_TIMEOUT) {
+                    continue;
+                }
+
                 ThrowLastError();
             }
 
@@ -56,6 +67,10 @@ void Debugger::Start() {
             SetDebuggedProcessThread(debug_event_.dwProcessId,
                                      debug_event_.dwThreadId);
 
+            if (HasDebuggedProcess()) {
+                DebuggedProcess().AdaptBreakpoints();
+            }
+
             cbPreDebugEvent(debug_event_);
 
             switch (debug_event_.dwDebugEventCode) {
@@ -104,10 +119,27 @@ void Debugger::Start() {
             cbPostDebugEvent(debug_event_);
 
             if (HasDebuggedThread()) {
-                Registers{ DebuggedThread().Handle(), CONTEXT_DEBUG_REGISTERS }
-                    .DR6.Reset();
+                ExpireReturnStep();
+                ArmReturnStep();
+
+                auto& thread{ DebuggedThread() };
+                const auto recorded{ thread.History()
+                                     && debug_event_.dwDebugEventCode
+                                            == EXCEPTION_DEBUG_EVENT };
+                // The history is recorded from the context fetched to reset `DR6`.
+                Registers registers{ thread.Handle(),
+                                     recorded ? CONTEXT_DEBUG_REGISTERS
+                                                    | CONTEXT_CONTROL
+                                                    | CONTEXT_INTEGER
+                                              : CONTEXT_DEBUG_REGISTERS };
+                registers.DR6.Reset();
+                if (recorded) {
+                    thread.RecordHistory(registers);
+                }
             }
 
+            UpdateFrozenThreads();
+
             if (!ContinueDebugEvent(debug_event_.dwProcessId,
                                     debug_event_.dwThreadId,
                                     continue_status_)) {
@@ -128,6 +160,8 @@ void Debugger::Start() {
 }
 
 void Debugger::UnsafeDetach() {
+    ThawFrozenThreads();
+
     if (HasDebuggedThread()) {
         Registers(DebuggedThread().Handle(), CONTEXT_CONTROL).EFLAGS.ResetTF();
     }
@@ -147,6 +181,42 @@ void Debugger::Stop() {
     }
 }
 
+void Debugger::SetFreezeOthers(const bool enabled) noexcept {
+    freeze_others_ = enabled;
+}
+
+void Debugger::SetModuleBreakpoint(const ModuleBreakpoint& breakpoint) {
+    module_breakpoints_.push_back(breakpoint);
+    for (auto& [_, process] : processes_) {
+        process.SetModuleBreakpoint(breakpoint);
+    }
+}
+
+void Debugger::UpdateFrozenThreads() {
+    const auto stepping{ freeze_others_ && HasDebuggedThread()
+                         && DebuggedThread().InternalStepping() };
+    if (!stepping || frozen_process_id_ != debug_event_.dwProcessId) {
+        ThawFrozenThreads();
+    }
+
+    if (stepping) {
+        DebuggedProcess().FreezeThreads(DebuggedThread().Id());
+        frozen_process_id_ = debug_event_.dwProcessId;
+    }
+}
+
+void Debugger::ThawFrozenThreads() {
+    if (frozen_process_id_ == 0) {
+        return;
+    }
+
+    if (const auto process{ FindProcess(frozen_process_id_) }) {
+        process->get().ThawThreads();
+    }
+
+    frozen_process_id_ = 0;
+}
+
 void Debugger::ClearCache() noexcept {
     ResetDebuggedProcessThread();
 
@@ -161,8 +231,13 @@ void Debugger::ClearCache() noexcept {
     main_process_ = {};
     main_startup_ = {};
     debug_event_ = {};
-    processes_.clear();
+    traces_.clear();
+    profiler_.reset();
+    processes_.Clear();
     attached_ = false;
+    fast_attach_ = false;
+    deferred_threads_.clear();
+    frozen_process_id_ = 0;
     detached_ = false;
     main_process_exited_ = false;
     debugging_ = false;
@@ -179,6 +254,10 @@ Thread& Debugger::DebuggedThread() const noexcept {
     return debugged_thread_->get();
 }
 
+std::pmr::memory_resource& Debugger::EventArena() noexcept {
+    return event_arena_;
+}
+
 bool Debugger::HasDebuggedProcess() const noexcept {
     return debugged_process_.has_value();
 }
@@ -198,7 +277,10 @@ void Debugger::ResetDebuggedProcessThread() noexcept {
 void Debugger::SetDebuggedProcessThread(
     const std::uint32_t process_id, const std::uint32_t thread_id) noexcept {
     if (process_id != 0) {
-        debugged_process_ = FindProcess(process_id);
+        // Consecutive debug events usually come from the same process.
+        const auto process{ processes_.Find(process_id, last_process_) };
+        debugged_process_ = process ? OptionalProcess{ *process }
+                                    : OptionalProcess{ std::nullopt };
     }
 
     if (debugged_process_) {
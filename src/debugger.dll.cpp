@@ -2,6 +2,17 @@
 
 
 void Debugger::OnLoadDll(const LOAD_DLL_DEBUG_INFO& details) {
+    if (HasDebuggedProcess()) {
+        auto& process{ DebuggedProcess() };
+        process.LoadModule(
+            reinterpret_cast<std::uintptr_t>(details.lpBaseOfDll),
+            process.ModulePath(
+                details.hFile,
+                reinterpret_cast<std::uintptr_t>(details.lpImageName),
+                details.fUnicode != 0),
+            EventArena());
+    }
+
     cbLoadDll(details);
 
     if (details.hFile) {
@@ -11,4 +22,9 @@ void Debugger::OnLoadDll(const LOAD_DLL_DEBUG_INFO& details) {
 
 void Debugger::OnUnloadDll(const UNLOAD_DLL_DEBUG_INFO& details) {
     cbUnloadDll(details);
+
+    if (HasDebuggedProcess()) {
+        DebuggedProcess().UnloadModule(
+            reinterpret_cast<std::uintptr_t>(details.lpBaseOfDll));
+    }
 }
\ No newline at end of file
@@ -23,6 +23,14 @@ void Debugger::OnException(const EXCEPTION_DEBUG_INFO& details) {
     }
 
     if (continue_status_ == DBG_EXCEPTION_NOT_HANDLED) {
+        if (!first_chance && HasDebuggedThread()
+            && DebuggedThread().ReturnStepping()) {
+            // The thread is going to be terminated and will never return.
+            DebuggedProcess().DeleteReturnBreakpoint(
+                DebuggedThread().ReturnStepAddress());
+            DebuggedThread().ResetReturnStepping();
+        }
+
         cbUnhandledException(record, first_chance);
     }
 }
@@ -39,6 +47,8 @@ void Debugger::OnSingleStep(const EXCEPTION_RECORD& record,
         thread.ExecuteInternalStepCallback();
     }
 
+    const auto traced{ TraceStep() };
+
     if (thread.SingleStepping()) {
         thread.ResetSingleStepping();
         continue_status_ = DBG_CONTINUE;
@@ -47,7 +57,7 @@ void Debugger::OnSingleStep(const EXCEPTION_RECORD& record,
 
         thread.ExecuteSingleStepCallbacks();
 
-    } else {
+    } else if (!traced) {
         OnHardwareBreakpoint(
             reinterpret_cast<std::uintptr_t>(record.ExceptionAddress));
     }
@@ -58,43 +68,160 @@ void Debugger::OnBreakpoint(const EXCEPTION_RECORD& record,
     auto& process{ DebuggedProcess() };
     auto& thread{ DebuggedThread() };
 
-    const auto found{ process.FindSoftwareBreakpoint(
-        reinterpret_cast<std::uintptr_t>(record.ExceptionAddress)) };
+    const auto address{ reinterpret_cast<std::uintptr_t>(
+        record.ExceptionAddress) };
+    auto found{ process.FindSoftwareBreakpoint(address) };
+
+    // Thread filters are checked before any context access.
+    if (found
+        && process.FilterBreakpointHit({ BreakpointType::Software, address },
+                                       debug_event_.dwThreadId)) {
+        found.reset();
+        if (!process.FindTracepoint(address)
+            && !process.FindReturnBreakpoint(address)) {
+            Registers registers{ thread.Handle(), CONTEXT_CONTROL };
+            StepOverInt3(registers, address);
+            return;
+        }
+    }
+
+    if (const auto tracepoint{ process.FindTracepoint(address) }) {
+        if (!found && !process.FindReturnBreakpoint(address)) {
+            OnTracepoint(address);
+            return;
+        }
+
+        // Other breakpoints at the same address are handled after the capture.
+        Registers registers{ thread.Handle(),
+                             CONTEXT_CONTROL | CONTEXT_INTEGER };
+        registers.EIP.Set(address);
+        CaptureTracepoint(*tracepoint, registers);
+    }
 
-    if (!found && !process.HasHitSystemBreakpoint()) {
+    if (!found && process.FindReturnBreakpoint(address)) {
+        OnReturnBreakpoint(address);
+
+    } else if (!found && !process.HasHitSystemBreakpoint()) {
         process.HitSystemBreakpoint();
         continue_status_ = DBG_CONTINUE;
 
+        NotifyDeferredThreads();
         cbSystemBreakpoint(process);
 
-    } else {
+    } else if (found) {
         const auto& breakpoint{ *found };
-        Registers(thread.Handle(), CONTEXT_CONTROL).EIP.Set(breakpoint.address);
-        process.DeleteInt3(breakpoint.address, breakpoint.original_byte);
+        const BreakpointKey key{ BreakpointType::Software, address };
+        std::uintptr_t stack{ 0 };
+        auto matched{ true };
+        {
+            Registers registers(thread.Handle(),
+                                CONTEXT_CONTROL | CONTEXT_INTEGER);
+            registers.EIP.Set(address);
+            stack = registers.ESP.Get();
+            matched = MatchBreakpointCondition(key, registers);
+
+            // The breakpoint has been promoted since the thread hit `INT3` instruction.
+            if (process.FindPromotedBreakpoint(address)) {
+                registers.EFLAGS.SetRF();
+            }
+        }
+
+        process.DeleteInt3(address, breakpoint.original_byte);
         continue_status_ = DBG_CONTINUE;
 
-        cbBreakpoint(breakpoint);
+        // A step-over or step-out may return to a software breakpoint.
+        const auto returned{ thread.ReachedReturnStep(address, stack) };
+        if (returned) {
+            process.DeleteReturnBreakpoint(address);
+        }
+
+        const auto resumed{ ReachedTraceSkip(address, stack) };
+
+        if (const auto reported{ matched ? process.HitBreakpoint(key)
+                                         : std::nullopt }) {
+            cbBreakpoint(*reported);
+
+            if (address == thread.Entry()) {
+                cbEntryBreakpoint(process);
+            }
+
+            process.ExecuteBreakpointCallback(key);
 
-        if (breakpoint.address == thread.Entry()) {
-            cbEntryBreakpoint(process);
+            if (breakpoint.single_shoot) {
+                process.DeleteSoftwareBreakpoint(address);
+            }
         }
 
-        if (breakpoint.single_shoot) {
-            process.DeleteSoftwareBreakpoint(breakpoint.address);
-        } else {
-            thread.InternalStep([this, breakpoint]() {
-                if (DebuggedProcess().FindSoftwareBreakpoint(
-                        breakpoint.address)) {
-                    DebuggedProcess().SetInt3(breakpoint.address);
-                }
+        if (process.FindInt3(address)) {
+            thread.InternalStep([this, address]() {
+                auto& process{ DebuggedProcess() };
+                process.CountBreakpointHit(address);
+                process.RestoreInt3(address);
             });
         }
 
-        process.ExecuteBreakpointCallback(
-            { BreakpointType::Software, breakpoint.address });
+        if (resumed) {
+            ResumeTrace();
+        }
+
+        if (returned) {
+            cbStep(thread);
+
+            thread.ExecuteReturnStepCallback();
+        }
     }
 }
 
+void Debugger::StepOverInt3(Registers& registers,
+                            const std::uintptr_t address) {
+    auto& process{ DebuggedProcess() };
+
+    registers.EIP.Set(address);
+    continue_status_ = DBG_CONTINUE;
+
+    const auto original_byte{ process.FindInt3(address) };
+    if (!original_byte) {
+        // The breakpoint has been promoted since the thread hit `INT3` instruction.
+        registers.EFLAGS.SetRF();
+        return;
+    }
+
+    process.DeleteInt3(address, *original_byte);
+
+    DebuggedThread().InternalStep(registers, [this, address]() {
+        auto& process{ DebuggedProcess() };
+        process.CountBreakpointHit(address);
+        process.RestoreInt3(address);
+    });
+}
+
+void Debugger::OnPromotedBreakpoint(const SoftwareBreakpoint& breakpoint,
+                                    const Registers& registers) {
+    auto& process{ DebuggedProcess() };
+    auto& thread{ DebuggedThread() };
+
+    const BreakpointKey key{ BreakpointType::Software, breakpoint.address };
+    continue_status_ = DBG_CONTINUE;
+
+    process.CountBreakpointHit(breakpoint.address);
+
+    if (!process.FilterBreakpointHit(key, thread.Id())
+        && MatchBreakpointCondition(key, registers)) {
+        if (const auto reported{ process.HitBreakpoint(key) }) {
+            cbBreakpoint(*reported);
+
+            if (breakpoint.address == thread.Entry()) {
+                cbEntryBreakpoint(process);
+            }
+
+            process.ExecuteBreakpointCallback(key);
+        }
+    }
+
+    // Callbacks may change debug registers, so the flag is set in a fresh context.
+    Registers{ thread.Handle(), CONTEXT_CONTROL }.EFLAGS.SetRF();
+}
+
 void Debugger::OnAccessViolation(const EXCEPTION_RECORD& record,
                                  const bool first_chance) {}
 
@@ -102,44 +229,70 @@ void Debugger::OnHardwareBreakpoint(const std::uintptr_t address) {
     auto& process{ DebuggedProcess() };
     auto& thread{ DebuggedThread() };
 
-    Registers registers(thread.Handle(), CONTEXT_DEBUG_REGISTERS);
+    Registers registers(thread.Handle(), CONTEXT_DEBUG_REGISTERS
+                                             | CONTEXT_CONTROL
+                                             | CONTEXT_INTEGER);
     const auto& dr6{ registers.DR6 };
-    HardwareBreakpointSlot slot{};
-    if (address == registers.DR0.Get() || dr6.B0()) {
-        slot = HardwareBreakpointSlot::DR0;
-    } else if (address == registers.DR1.Get() || dr6.B1()) {
-        slot = HardwareBreakpointSlot::DR1;
-    } else if (address == registers.DR2.Get() || dr6.B2()) {
-        slot = HardwareBreakpointSlot::DR2;
-    } else if (address == registers.DR3.Get() || dr6.B3()) {
-        slot = HardwareBreakpointSlot::DR3;
-    } else {
+    std::size_t number{ 0 };
+    while (number != debug_address_register_count
+           && address != registers.Get(DebugAddressIndex(number))
+           && !dr6.B(number)) {
+        ++number;
+    }
+
+    if (number == debug_address_register_count) {
         return;
     }
 
+    const auto slot{ static_cast<HardwareBreakpointSlot>(number) };
+
     const auto found{ process.FindHardwareBreakpoint(address) };
-    assert(found);
+    if (!found) {
+        if (const auto promoted{ process.FindPromotedBreakpoint(address) }) {
+            // A step may stop in front of the breakpoint without triggering it.
+            if (*promoted == slot && dr6.B(number)) {
+                OnPromotedBreakpoint(*process.FindSoftwareBreakpoint(address),
+                                     registers);
+            }
+        } else {
+            // The breakpoint has been demoted or deleted since the thread triggered it.
+            registers.EFLAGS.SetRF();
+            continue_status_ = DBG_CONTINUE;
+        }
+
+        return;
+    }
 
     const auto& breakpoint{ *found };
     assert(breakpoint.slot == slot);
 
+    const BreakpointKey key{ BreakpointType::Hardware, address };
     continue_status_ = DBG_CONTINUE;
 
-    cbBreakpoint(breakpoint);
-
     thread.DeleteHardwareBreakpoint(slot);
 
-    if (breakpoint.single_shoot) {
-        process.DeleteHardwareBreakpoint(address);
-    } else {
-        thread.InternalStep([this, breakpoint]() {
-            if (DebuggedProcess().FindHardwareBreakpoint(breakpoint.address)) {
+    if (const auto reported{ MatchBreakpointCondition(key, registers)
+                                 ? process.HitBreakpoint(key)
+                                 : std::nullopt }) {
+        cbBreakpoint(*reported);
+
+        process.ExecuteBreakpointCallback(key);
+
+        if (breakpoint.single_shoot) {
+            process.DeleteHardwareBreakpoint(address);
+        }
+    }
+
+    if (const auto remained{ process.FindHardwareBreakpoint(address) };
+        remained && remained->enabled) {
+        // Only the address is captured, so the callback is stored in place.
+        thread.InternalStep([this, address]() {
+            const auto found{ DebuggedProcess().FindHardwareBreakpoint(
+                address) };
+            if (found && found->enabled) {
                 DebuggedThread().SetHardwareBreakpoint(
-                    breakpoint.address, breakpoint.slot, breakpoint.access,
-                    breakpoint.size);
+                    address, found->slot, found->access, found->size);
             }
         });
     }
-
-    process.ExecuteBreakpointCallback({ BreakpointType::Hardware, address });
 }
\ No newline at end of file
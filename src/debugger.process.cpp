@@ -1,5 +1,6 @@
 #include "debugger.h"
 
+#include <unordered_map>
 #include <utility>
 
 
@@ -25,6 +26,17 @@ void Debugger::OnCreateProcess(const CREATE_PROCESS_DEBUG_INFO& details) {
 
     SetDebuggedProcessThread(debug_event_.dwProcessId, debug_event_.dwThreadId);
 
+    for (const auto& breakpoint : module_breakpoints_) {
+        DebuggedProcess().SetModuleBreakpoint(breakpoint);
+    }
+
+    DebuggedProcess().LoadModule(
+        reinterpret_cast<std::uintptr_t>(details.lpBaseOfImage),
+        DebuggedProcess().ModulePath(
+            details.hFile, reinterpret_cast<std::uintptr_t>(details.lpImageName),
+            details.fUnicode != 0),
+        EventArena());
+
     cbCreateProcess(details, DebuggedProcess());
 
     if (attached) {
@@ -45,22 +57,25 @@ void Debugger::OnExitProcess(const EXIT_PROCESS_DEBUG_INFO& details) {
 
     cbExitProcess(details, DebuggedProcess());
 
+    std::erase_if(traces_, [this](const auto& pair) {
+        return pair.second.ProcessId() == debug_event_.dwProcessId;
+    });
+
     RemoveProcess(debug_event_.dwProcessId);
 
     ResetDebuggedProcessThread();
 }
 
 void Debugger::NewProcess(Process&& process) noexcept {
-    processes_.insert({ process.Id(), std::move(process) });
+    const auto id{ process.Id() };
+    processes_.Insert(id, std::move(process));
 }
 
 bool Debugger::RemoveProcess(const std::uint32_t id) noexcept {
-    return processes_.erase(id) != 0;
+    return processes_.Erase(id);
 }
 
 OptionalProcess Debugger::FindProcess(const std::uint32_t id) const noexcept {
-    const auto found{ processes_.find(id) };
-    return found != processes_.cend()
-               ? OptionalProcess{ const_cast<Process&>(found->second) }
-               : std::nullopt;
+    const auto found{ processes_.Find(id) };
+    return found ? OptionalProcess{ *found } : std::nullopt;
 }
\ No newline at end of file
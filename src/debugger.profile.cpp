@@ -0,0 +1,42 @@
+#include "debugger.h"
+
+#include <format>
+#include <stdexcept>
+
+
+void Debugger::StartProfile(const ProfileOptions& options) {
+    if (profiler_ && profiler_->Active()) {
+        throw std::runtime_error{ std::format(
+            "The process {} is being profiled.", profiler_->ProcessId()) };
+    }
+
+    profiler_.emplace(DebuggedProcess().Id(), options);
+}
+
+void Debugger::StopProfile() noexcept {
+    if (profiler_) {
+        profiler_->Stop();
+    }
+}
+
+const Profiler* Debugger::Profile() const noexcept {
+    return profiler_ ? &*profiler_ : nullptr;
+}
+
+std::uint32_t Debugger::ProfileTimeout() const noexcept {
+    return profiler_ && profiler_->Active()
+               ? static_cast<std::uint32_t>(profiler_->Delay().count())
+               : INFINITE;
+}
+
+void Debugger::SampleProfile() {
+    if (!profiler_ || !profiler_->Due()) {
+        return;
+    }
+
+    if (const auto process{ FindProcess(profiler_->ProcessId()) }) {
+        profiler_->Sample(process->get());
+    } else {
+        profiler_->Stop();
+    }
+}
\ No newline at end of file
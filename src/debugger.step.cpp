@@ -0,0 +1,165 @@
+#include "debugger.h"
+#include "error.h"
+#include "register/registers.h"
+
+#include <cassert>
+#include <span>
+
+
+namespace {
+
+/**
+ * @brief Read a double word from a stack.
+ *
+ * @param process The process.
+ * @param address The stack address.
+ */
+std::uintptr_t ReadStack(const Process& process, const std::uintptr_t address) {
+    std::uint32_t value{ 0 };
+    if (!process.ReadMemorySafe(
+            address, std::as_writable_bytes(std::span{ &value, 1 }))) {
+        ThrowLastError();
+    }
+
+    return value;
+}
+
+//! Whether an instruction is `PUSH EBP`.
+bool IsPushEbp(const Instruction& instruction) noexcept {
+    return instruction.map == OpcodeMap::Primary && instruction.opcode == 0x55
+           && instruction.prefixes == 0;
+}
+
+//! Whether an instruction is `MOV EBP, ESP`.
+bool IsMovEbpEsp(const Instruction& instruction) noexcept {
+    return instruction.map == OpcodeMap::Primary && instruction.prefixes == 0
+           && ((instruction.opcode == 0x8B && instruction.modrm == 0xEC)
+               || (instruction.opcode == 0x89 && instruction.modrm == 0xE5));
+}
+
+}  // namespace
+
+
+void Debugger::ArmReturnStep() {
+    auto& process{ DebuggedProcess() };
+    auto& thread{ DebuggedThread() };
+
+    const auto step{ thread.PendingReturnStep() };
+    if (step == ReturnStep::None) {
+        return;
+    }
+
+    if (thread.ReturnStepping()) {
+        // A new step replaces the previous one.
+        process.DeleteReturnBreakpoint(thread.ReturnStepAddress());
+    }
+
+    std::uintptr_t eip{ 0 };
+    std::uintptr_t esp{ 0 };
+    std::uintptr_t ebp{ 0 };
+    {
+        const Registers registers{ thread.Handle(), CONTEXT_CONTROL };
+        eip = registers.EIP.Get();
+        esp = registers.ESP.Get();
+        ebp = registers.EBP.Get();
+    }
+
+    try {
+        const auto instruction{ process.ReadInstruction(eip) };
+
+        std::uintptr_t address{ 0 };
+        std::uintptr_t frame{ 0 };
+        if (step == ReturnStep::Over) {
+            if (!instruction || !instruction->IsCall()) {
+                thread.DowngradeReturnStep();
+                return;
+            }
+
+            address = eip + instruction->length;
+            frame = esp;
+
+        } else {
+            if (instruction && instruction->IsReturn()) {
+                thread.DowngradeReturnStep();
+                return;
+            }
+
+            // The stack frame has not been built at the start of a function.
+            if (instruction && IsPushEbp(*instruction)) {
+                address = ReadStack(process, esp);
+                frame = esp + sizeof(std::uint32_t);
+            } else if (instruction && IsMovEbpEsp(*instruction)) {
+                address = ReadStack(process, esp + sizeof(std::uint32_t));
+                frame = esp + sizeof(std::uint32_t) * 2;
+            } else {
+                address = ReadStack(process, ebp + sizeof(std::uint32_t));
+                frame = ebp + sizeof(std::uint32_t) * 2;
+            }
+        }
+
+        process.SetReturnBreakpoint(address);
+        thread.ArmReturnStep(address, frame);
+
+    } catch (const std::exception& error) {
+        // The return address cannot be read, such as from a function without a stack frame.
+        thread.DowngradeReturnStep();
+        cbInternalLoopError(error);
+    }
+}
+
+void Debugger::ExpireReturnStep() {
+    auto& thread{ DebuggedThread() };
+    if (!thread.ReturnStepping()) {
+        return;
+    }
+
+    const auto stack{ Registers{ thread.Handle(), CONTEXT_CONTROL }.ESP.Get() };
+    if (thread.LeftReturnStep(stack)) {
+        DebuggedProcess().DeleteReturnBreakpoint(thread.ReturnStepAddress());
+
+        cbStep(thread);
+
+        thread.ExecuteReturnStepCallback();
+    }
+}
+
+void Debugger::OnReturnBreakpoint(const std::uintptr_t address) {
+    auto& process{ DebuggedProcess() };
+    auto& thread{ DebuggedThread() };
+
+    const auto found{ process.FindReturnBreakpoint(address) };
+    assert(found);
+
+    std::uintptr_t stack{ 0 };
+    {
+        Registers registers{ thread.Handle(), CONTEXT_CONTROL };
+        registers.EIP.Set(address);
+        stack = registers.ESP.Get();
+    }
+
+    process.DeleteInt3(address, found->original_byte);
+    continue_status_ = DBG_CONTINUE;
+
+    // Other threads and recursive calls may also reach the return address.
+    const auto reached{ thread.ReachedReturnStep(address, stack) };
+    if (reached) {
+        process.DeleteReturnBreakpoint(address);
+    }
+
+    const auto resumed{ ReachedTraceSkip(address, stack) };
+
+    if (process.FindInt3(address)) {
+        thread.InternalStep(
+            [this, address]() { DebuggedProcess().RestoreInt3(address); });
+    }
+
+    if (resumed) {
+        ResumeTrace();
+    }
+
+    if (reached) {
+        cbStep(thread);
+
+        thread.ExecuteReturnStepCallback();
+    }
+}
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "debugger.h"
 
+#include <utility>
+#include <vector>
+
 
 void Debugger::OnCreateThread(const CREATE_THREAD_DEBUG_INFO& details) {
     DebuggedProcess().NewThread(
@@ -9,13 +12,51 @@ void Debugger::OnCreateThread(const CREATE_THREAD_DEBUG_INFO& details) {
 
     SetDebuggedProcessThread(0, debug_event_.dwThreadId);
 
+    // Threads existing before a fast attach are only recorded until the system breakpoint.
+    if (fast_attach_ && debug_event_.dwProcessId == main_process_.dwProcessId
+        && !DebuggedProcess().HasHitSystemBreakpoint()) {
+        deferred_threads_.push_back(debug_event_.dwThreadId);
+        return;
+    }
+
     cbCreateThread(details, DebuggedThread());
 }
 
 void Debugger::OnExitThread(const EXIT_THREAD_DEBUG_INFO& details) {
-    cbExitThread(details, DebuggedThread());
+    // Threads whose creation has not been reported exit silently.
+    if (std::erase(deferred_threads_, debug_event_.dwThreadId) == 0) {
+        cbExitThread(details, DebuggedThread());
+    }
+
+    RemoveTrace(debug_event_.dwThreadId);
+
+    if (DebuggedThread().ReturnStepping()) {
+        DebuggedProcess().DeleteReturnBreakpoint(
+            DebuggedThread().ReturnStepAddress());
+    }
 
     DebuggedProcess().RemoveThread(debug_event_.dwThreadId);
 
     ResetDebuggedProcessThread();
+}
+
+void Debugger::NotifyDeferredThreads() {
+    if (deferred_threads_.empty()) {
+        return;
+    }
+
+    auto& process{ DebuggedProcess() };
+    for (const auto id : std::exchange(deferred_threads_, {})) {
+        if (const auto thread{ process.FindThread(id) }) {
+            const CREATE_THREAD_DEBUG_INFO details{
+                .hThread = thread->get().Handle(),
+                .lpThreadLocalBase =
+                    reinterpret_cast<LPVOID>(thread->get().LocalBase()),
+                .lpStartAddress = reinterpret_cast<LPTHREAD_START_ROUTINE>(
+                    thread->get().Entry())
+            };
+
+            cbCreateThread(details, *thread);
+        }
+    }
 }
\ No newline at end of file
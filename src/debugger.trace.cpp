@@ -0,0 +1,162 @@
+#include "debugger.h"
+#include "register/registers.h"
+
+#include <format>
+#include <stdexcept>
+
+
+void Debugger::StartTrace(Thread& thread, const std::wstring_view file_path,
+                          const TraceOptions& options) {
+    if (traces_.contains(thread.Id())) {
+        throw std::runtime_error{ std::format(
+            "The thread {} is being traced.", thread.Id()) };
+    }
+
+    if (!DebuggedProcess().FindThread(thread.Id())) {
+        throw std::runtime_error{ std::format(
+            "The thread {} does not belong to the debugged process.",
+            thread.Id()) };
+    }
+
+    auto& tracer{ traces_
+                      .emplace(thread.Id(), Tracer{ DebuggedProcess().Id(),
+                                                    file_path, options })
+                      .first->second };
+    try {
+        RecordTrace(thread, tracer);
+    } catch (...) {
+        traces_.erase(thread.Id());
+        throw;
+    }
+}
+
+bool Debugger::StopTrace(const std::uint32_t thread_id) {
+    const auto found{ traces_.find(thread_id) };
+    if (found == traces_.cend()) {
+        return false;
+    }
+
+    const auto process{ FindProcess(found->second.ProcessId()) };
+    const auto thread{ process ? process->get().FindThread(thread_id)
+                               : std::nullopt };
+    if (thread && !thread->get().SingleStepping()
+        && !thread->get().InternalStepping()) {
+        Registers(thread->get().Handle(), CONTEXT_CONTROL).EFLAGS.ResetTF();
+    }
+
+    return RemoveTrace(thread_id);
+}
+
+bool Debugger::Tracing(const std::uint32_t thread_id) const noexcept {
+    return traces_.contains(thread_id);
+}
+
+bool Debugger::TraceStep() {
+    const auto found{ traces_.find(DebuggedThread().Id()) };
+    if (found == traces_.end() || found->second.Skipping()) {
+        return false;
+    }
+
+    continue_status_ = DBG_CONTINUE;
+    RecordTrace(DebuggedThread(), found->second);
+    return true;
+}
+
+bool Debugger::ReachedTraceSkip(const std::uintptr_t address,
+                                const std::uintptr_t stack) {
+    const auto found{ traces_.find(DebuggedThread().Id()) };
+    if (found == traces_.end() || !found->second.ReachedSkip(address, stack)) {
+        return false;
+    }
+
+    found->second.ResetSkip();
+    DebuggedProcess().DeleteReturnBreakpoint(address);
+    return true;
+}
+
+void Debugger::ResumeTrace() {
+    if (const auto found{ traces_.find(DebuggedThread().Id()) };
+        found != traces_.end()) {
+        RecordTrace(DebuggedThread(), found->second);
+    }
+}
+
+void Debugger::RecordTrace(Thread& thread, Tracer& tracer) {
+    auto& process{ DebuggedProcess() };
+
+    Registers registers{ thread.Handle(), CONTEXT_CONTROL | CONTEXT_INTEGER };
+    const auto address{ registers.EIP.Get() };
+
+    if (tracer.HasCall() && !tracer.InRange(address)) {
+        // Run the call at full speed until it returns to the traced range.
+        process.SetReturnBreakpoint(tracer.CallReturnAddress());
+        tracer.SkipCall();
+        registers.EFLAGS.ResetTF();
+        return;
+    }
+
+    const Instruction* instruction{ nullptr };
+    if (tracer.DecodesInstructions()) {
+        instruction = tracer.FindInstruction(address);
+        if (!instruction) {
+            if (const auto decoded{ process.ReadInstruction(address) }) {
+                instruction = &tracer.CacheInstruction(*decoded);
+            }
+        }
+    }
+
+    if (instruction && instruction->IsCall()) {
+        tracer.SetCall(address + instruction->length, registers.ESP.Get());
+    } else {
+        tracer.ResetCall();
+    }
+
+    if (tracer.InRange(address)) {
+        const auto content{ tracer.Options().content };
+
+        TraceRegisters values{};
+        if ((content & static_cast<std::uint16_t>(TraceContent::Registers))
+            != 0) {
+            for (std::size_t i{ 0 }; i != trace_eflags_index; ++i) {
+                values[i] = static_cast<std::uint32_t>(
+                    registers.Get(static_cast<RegisterIndex>(i)));
+            }
+
+            // The trap flag is set by the trace itself.
+            values[trace_eflags_index] =
+                static_cast<std::uint32_t>(flag_fields::tf.Encode(
+                    registers.Get(RegisterIndex::EFLAGS), 0));
+        }
+
+        std::optional<std::uintptr_t> memory{};
+        if (instruction && instruction->memory_access) {
+            memory = EffectiveAddress(*instruction,
+                                      [&registers](const RegisterIndex index) {
+                                          return registers.Get(index);
+                                      });
+        }
+
+        tracer.Write(address, values, memory);
+    }
+
+    registers.EFLAGS.SetTF();
+}
+
+bool Debugger::RemoveTrace(const std::uint32_t thread_id) {
+    const auto found{ traces_.find(thread_id) };
+    if (found == traces_.cend()) {
+        return false;
+    }
+
+    auto tracer{ std::move(found->second) };
+    traces_.erase(found);
+
+    if (tracer.Skipping()) {
+        if (const auto process{ FindProcess(tracer.ProcessId()) }) {
+            process->get().DeleteReturnBreakpoint(tracer.CallReturnAddress());
+        }
+    }
+
+    tracer.Close();
+    return true;
+}
\ No newline at end of file
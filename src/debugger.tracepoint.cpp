@@ -0,0 +1,105 @@
+#include "debugger.h"
+#include "register/registers.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <span>
+
+
+namespace {
+
+//! The maximum size of a memory area read at once for nearby tracepoint memory slices.
+constexpr std::size_t tracepoint_batch_size{ 0x1000 };
+
+//! A memory slice to be captured by a tracepoint.
+struct MemorySlice {
+    std::uintptr_t address;
+
+    //! The index of the memory expression.
+    std::size_t index;
+};
+
+}  // namespace
+
+
+void Debugger::OnTracepoint(const std::uintptr_t address) {
+    auto& process{ DebuggedProcess() };
+    auto& thread{ DebuggedThread() };
+
+    const auto tracepoint{ process.FindTracepoint(address) };
+    assert(tracepoint);
+
+    // The same context is used to capture, rewind and step over the breakpoint.
+    Registers registers{ thread.Handle(), CONTEXT_CONTROL | CONTEXT_INTEGER };
+    registers.EIP.Set(address);
+    CaptureTracepoint(*tracepoint, registers);
+
+    StepOverInt3(registers, address);
+}
+
+void Debugger::CaptureTracepoint(const Tracepoint& tracepoint,
+                                 const Registers& registers) noexcept {
+    const auto& process{ DebuggedProcess() };
+
+    auto& record{ tracepoint_records_.Push() };
+    record.address = tracepoint.address;
+    record.process_id = process.Id();
+    record.thread_id = DebuggedThread().Id();
+    record.failures = 0;
+    record.size = static_cast<std::uint16_t>(tracepoint.PayloadSize());
+
+    const auto read{ [&registers](const RegisterIndex index) {
+        return registers.Get(index);
+    } };
+
+    tracepoint.CaptureRegisters(record, read);
+
+    // Sort memory slices by address and read nearby ones at once.
+    const auto count{ tracepoint.memory.size() };
+    std::array<MemorySlice, max_tracepoint_memory_count> slices{};
+    for (std::size_t i{ 0 }; i != count; ++i) {
+        slices[i] = { EffectiveAddress(tracepoint.memory[i].operand, read), i };
+    }
+
+    std::ranges::sort(std::span{ slices }.first(count), {},
+                      &MemorySlice::address);
+
+    std::array<std::byte, tracepoint_batch_size> batch;
+    for (std::size_t begin{ 0 }; begin != count;) {
+        const auto base{ slices[begin].address };
+        auto limit{ base };
+        auto end{ begin };
+        for (; end != count; ++end) {
+            const auto& memory{ tracepoint.memory[slices[end].index] };
+            const auto slice_end{ slices[end].address + memory.size };
+            if (end != begin && slice_end - base > tracepoint_batch_size) {
+                break;
+            }
+
+            limit = std::max(limit, slice_end);
+        }
+
+        const auto batched{ end - begin > 1
+                            && process.ReadMemorySafe(
+                                base, std::span{ batch }.first(limit - base)) };
+
+        // Slices are read one by one if they are far apart or some pages are inaccessible.
+        for (auto i{ begin }; i != end; ++i) {
+            const auto& [address, index]{ slices[i] };
+            const auto& memory{ tracepoint.memory[index] };
+            const auto data{ std::span{ record.payload }.subspan(memory.offset,
+                                                                 memory.size) };
+            if (batched) {
+                std::memcpy(data.data(), batch.data() + (address - base),
+                            data.size());
+            } else if (!process.ReadMemorySafe(address, data)) {
+                std::ranges::fill(data, std::byte{ 0 });
+                record.failures |= static_cast<std::uint16_t>(1U << index);
+            }
+        }
+
+        begin = end;
+    }
+}
\ No newline at end of file
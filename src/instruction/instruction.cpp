@@ -0,0 +1,1018 @@
+#include "instruction.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+
+namespace {
+
+//! The kinds of immediate operands.
+enum class Immediate : std::uint8_t {
+    None,
+    //! @p ib.
+    Byte,
+    //! @p iw.
+    Word,
+    //! @p iz, a word or a double word by the operand size.
+    Full,
+    //! @p Ap, @p ptr16:16 or @p ptr16:32 by the operand size.
+    FarPointer,
+    //! @p moffs, a word or a double word by the address size.
+    Offset,
+    //! @p iw and @p ib of `ENTER`.
+    Enter,
+    //! @p ib only when @p ModRM.reg is @p 0 or @p 1 (`F6`).
+    Group3Byte,
+    //! @p iz only when @p ModRM.reg is @p 0 or @p 1 (`F7`).
+    Group3Full
+};
+
+struct OpcodeTraits {
+    bool valid{ false };
+
+    bool modrm{ false };
+
+    Immediate immediate{ Immediate::None };
+
+    InstructionFlow flow{ InstructionFlow::Sequential };
+
+    //! Whether the branch target is a relative offset.
+    bool relative{ false };
+
+    //! Whether it accesses memory implicitly, such as stack and string operations.
+    bool implicit_memory{ false };
+
+    //! Whether the memory operand is only an address and never accessed, such as `LEA`.
+    bool address_only{ false };
+
+    //! Whether @p ModRM.mod is ignored and always treated as a register, such as `MOV CR0, EAX`.
+    bool register_only{ false };
+};
+
+using OpcodeTable = std::array<OpcodeTraits, 0x100>;
+
+constexpr OpcodeTraits plain{ .valid = true };
+constexpr OpcodeTraits modrm{ .valid = true, .modrm = true };
+constexpr OpcodeTraits modrm_ib{ .valid = true,
+                                 .modrm = true,
+                                 .immediate = Immediate::Byte };
+constexpr OpcodeTraits modrm_iz{ .valid = true,
+                                 .modrm = true,
+                                 .immediate = Immediate::Full };
+constexpr OpcodeTraits ib{ .valid = true, .immediate = Immediate::Byte };
+constexpr OpcodeTraits iz{ .valid = true, .immediate = Immediate::Full };
+constexpr OpcodeTraits stack{ .valid = true, .implicit_memory = true };
+constexpr OpcodeTraits string{ .valid = true, .implicit_memory = true };
+constexpr OpcodeTraits hint{ .valid = true,
+                             .modrm = true,
+                             .address_only = true };
+constexpr OpcodeTraits invalid{};
+
+//! Set the traits of opcodes from @p first to @p last inclusively.
+constexpr void Fill(OpcodeTable& table, const std::size_t first,
+                    const std::size_t last,
+                    const OpcodeTraits& traits) noexcept {
+    for (auto i{ first }; i <= last; ++i) {
+        table[i] = traits;
+    }
+}
+
+//! One-byte opcodes.
+constexpr OpcodeTable primary_table{ [] {
+    OpcodeTable table{};
+    Fill(table, 0x00, 0xFF, plain);
+
+    // Arithmetic and logic instructions: `ADD`, `OR`, `ADC`, `SBB`, `AND`, `SUB`, `XOR` and `CMP`.
+    for (std::size_t row{ 0x00 }; row < 0x40; row += 0x08) {
+        Fill(table, row, row + 0x03, modrm);
+        table[row + 0x04] = ib;
+        table[row + 0x05] = iz;
+    }
+
+    // `PUSH` and `POP` segment registers.
+    for (const std::size_t opcode : { 0x06, 0x07, 0x0E, 0x16, 0x17, 0x1E, 0x1F }) {
+        table[opcode] = stack;
+    }
+
+    Fill(table, 0x50, 0x61, stack);
+    table[0x62] = modrm;
+    table[0x63] = modrm;
+    table[0x68] = { .valid = true,
+                    .immediate = Immediate::Full,
+                    .implicit_memory = true };
+    table[0x69] = modrm_iz;
+    table[0x6A] = { .valid = true,
+                    .immediate = Immediate::Byte,
+                    .implicit_memory = true };
+    table[0x6B] = modrm_ib;
+    Fill(table, 0x6C, 0x6F, string);
+
+    Fill(table, 0x70, 0x7F,
+         { .valid = true,
+           .immediate = Immediate::Byte,
+           .flow = InstructionFlow::ConditionalJump,
+           .relative = true });
+
+    table[0x80] = modrm_ib;
+    table[0x81] = modrm_iz;
+    table[0x82] = modrm_ib;
+    table[0x83] = modrm_ib;
+    Fill(table, 0x84, 0x8E, modrm);
+    table[0x8D] = { .valid = true, .modrm = true, .address_only = true };
+    table[0x8F] = { .valid = true, .modrm = true, .implicit_memory = true };
+
+    table[0x9A] = { .valid = true,
+                    .immediate = Immediate::FarPointer,
+                    .flow = InstructionFlow::Call,
+                    .implicit_memory = true };
+    table[0x9C] = stack;
+    table[0x9D] = stack;
+
+    Fill(table, 0xA0, 0xA3,
+         { .valid = true,
+           .immediate = Immediate::Offset,
+           .implicit_memory = true });
+    Fill(table, 0xA4, 0xA7, string);
+    table[0xA8] = ib;
+    table[0xA9] = iz;
+    Fill(table, 0xAA, 0xAF, string);
+
+    Fill(table, 0xB0, 0xB7, ib);
+    Fill(table, 0xB8, 0xBF, iz);
+
+    table[0xC0] = modrm_ib;
+    table[0xC1] = modrm_ib;
+    constexpr OpcodeTraits ret{ .valid = true,
+                                .flow = InstructionFlow::Return,
+                                .implicit_memory = true };
+    constexpr OpcodeTraits ret_iw{ .valid = true,
+                                   .immediate = Immediate::Word,
+                                   .flow = InstructionFlow::Return,
+                                   .implicit_memory = true };
+    table[0xC2] = ret_iw;
+    table[0xC3] = ret;
+    table[0xC4] = modrm;
+    table[0xC5] = modrm;
+    table[0xC6] = modrm_ib;
+    table[0xC7] = modrm_iz;
+    table[0xC8] = { .valid = true,
+                    .immediate = Immediate::Enter,
+                    .implicit_memory = true };
+    table[0xC9] = stack;
+    table[0xCA] = ret_iw;
+    table[0xCB] = ret;
+    table[0xCC] = { .valid = true, .flow = InstructionFlow::Interrupt };
+    table[0xCD] = { .valid = true,
+                    .immediate = Immediate::Byte,
+                    .flow = InstructionFlow::Interrupt };
+    table[0xCE] = { .valid = true, .flow = InstructionFlow::Interrupt };
+    table[0xCF] = ret;
+
+    Fill(table, 0xD0, 0xD3, modrm);
+    table[0xD4] = ib;
+    table[0xD5] = ib;
+    table[0xD7] = string;
+    Fill(table, 0xD8, 0xDF, modrm);
+
+    Fill(table, 0xE0, 0xE3,
+         { .valid = true,
+           .immediate = Immediate::Byte,
+           .flow = InstructionFlow::ConditionalJump,
+           .relative = true });
+    Fill(table, 0xE4, 0xE7, ib);
+    table[0xE8] = { .valid = true,
+                    .immediate = Immediate::Full,
+                    .flow = InstructionFlow::Call,
+                    .relative = true,
+                    .implicit_memory = true };
+    table[0xE9] = { .valid = true,
+                    .immediate = Immediate::Full,
+                    .flow = InstructionFlow::Jump,
+                    .relative = true };
+    table[0xEA] = { .valid = true,
+                    .immediate = Immediate::FarPointer,
+                    .flow = InstructionFlow::Jump };
+    table[0xEB] = { .valid = true,
+                    .immediate = Immediate::Byte,
+                    .flow = InstructionFlow::Jump,
+                    .relative = true };
+
+    table[0xF1] = { .valid = true, .flow = InstructionFlow::Interrupt };
+    table[0xF6] = { .valid = true,
+                    .modrm = true,
+                    .immediate = Immediate::Group3Byte };
+    table[0xF7] = { .valid = true,
+                    .modrm = true,
+                    .immediate = Immediate::Group3Full };
+    table[0xFE] = modrm;
+    table[0xFF] = modrm;
+    return table;
+}() };
+
+//! Two-byte opcodes, escaped by `0F`.
+constexpr OpcodeTable secondary_table{ [] {
+    OpcodeTable table{};
+    Fill(table, 0x00, 0xFF, modrm);
+
+    table[0x04] = invalid;
+    Fill(table, 0x05, 0x09, plain);
+    table[0x0A] = invalid;
+    table[0x0B] = plain;
+    table[0x0C] = invalid;
+    table[0x0D] = hint;
+    table[0x0E] = plain;
+    // 3DNow! instructions use an immediate byte as the opcode suffix.
+    table[0x0F] = modrm_ib;
+    Fill(table, 0x18, 0x1F, hint);
+
+    Fill(table, 0x20, 0x27,
+         { .valid = true, .modrm = true, .register_only = true });
+    table[0x25] = invalid;
+    table[0x27] = invalid;
+
+    Fill(table, 0x30, 0x33, plain);
+    table[0x34] = { .valid = true, .flow = InstructionFlow::Interrupt };
+    table[0x35] = { .valid = true, .flow = InstructionFlow::Return };
+    table[0x36] = invalid;
+    table[0x37] = plain;
+    table[0x39] = invalid;
+    Fill(table, 0x3B, 0x3F, invalid);
+
+    Fill(table, 0x70, 0x73, modrm_ib);
+    table[0x77] = plain;
+    table[0x7A] = invalid;
+    table[0x7B] = invalid;
+
+    Fill(table, 0x80, 0x8F,
+         { .valid = true,
+           .immediate = Immediate::Full,
+           .flow = InstructionFlow::ConditionalJump,
+           .relative = true });
+
+    table[0xA0] = stack;
+    table[0xA1] = stack;
+    table[0xA2] = plain;
+    table[0xA4] = modrm_ib;
+    table[0xA6] = invalid;
+    table[0xA7] = invalid;
+    table[0xA8] = stack;
+    table[0xA9] = stack;
+    table[0xAA] = plain;
+    table[0xAC] = modrm_ib;
+
+    table[0xBA] = modrm_ib;
+    table[0xC2] = modrm_ib;
+    Fill(table, 0xC4, 0xC6, modrm_ib);
+    Fill(table, 0xC8, 0xCF, plain);
+    return table;
+}() };
+
+//! Three-byte opcodes, escaped by `0F 38`.
+constexpr OpcodeTable tertiary_38_table{ [] {
+    OpcodeTable table{};
+    Fill(table, 0x00, 0xFF, modrm);
+    return table;
+}() };
+
+//! Three-byte opcodes, escaped by `0F 3A`.
+constexpr OpcodeTable tertiary_3a_table{ [] {
+    OpcodeTable table{};
+    Fill(table, 0x00, 0xFF, modrm_ib);
+    return table;
+}() };
+
+//! General-purpose registers in the order of their encoding in @p ModRM and @p SIB.
+constexpr std::array<RegisterIndex, 8> encoded_registers{
+    RegisterIndex::EAX, RegisterIndex::ECX, RegisterIndex::EDX,
+    RegisterIndex::EBX, RegisterIndex::ESP, RegisterIndex::EBP,
+    RegisterIndex::ESI, RegisterIndex::EDI
+};
+
+//! The base and index registers of 16-bit memory operands, indexed by @p ModRM.rm.
+constexpr std::array<std::pair<std::optional<RegisterIndex>,
+                               std::optional<RegisterIndex>>,
+                     8>
+    address16_registers{ {
+        { RegisterIndex::EBX, RegisterIndex::ESI },
+        { RegisterIndex::EBX, RegisterIndex::EDI },
+        { RegisterIndex::EBP, RegisterIndex::ESI },
+        { RegisterIndex::EBP, RegisterIndex::EDI },
+        { RegisterIndex::ESI, std::nullopt },
+        { RegisterIndex::EDI, std::nullopt },
+        { RegisterIndex::EBP, std::nullopt },
+        { RegisterIndex::EBX, std::nullopt },
+    } };
+
+//! Masks of little-endian values by their sizes in bytes.
+constexpr std::array<std::uint32_t, 5> size_masks{ 0, 0xFF, 0xFFFF, 0xFFFFFF,
+                                                   0xFFFFFFFF };
+
+//! A bounded little-endian reader of machine code.
+class CodeReader {
+public:
+    constexpr explicit CodeReader(const std::span<const std::byte> code) noexcept :
+        code_{ code.first(std::min(code.size(), max_instruction_length)) } {}
+
+    constexpr std::size_t Position() const noexcept {
+        return position_;
+    }
+
+    constexpr bool Peek(std::uint8_t& byte) const noexcept {
+        if (position_ >= code_.size()) {
+            return false;
+        }
+
+        byte = std::to_integer<std::uint8_t>(code_[position_]);
+        return true;
+    }
+
+    constexpr bool Read(std::uint8_t& byte) noexcept {
+        if (!Peek(byte)) {
+            return false;
+        }
+
+        ++position_;
+        return true;
+    }
+
+    constexpr bool Read(const std::size_t size,
+                        std::uint32_t& value) noexcept {
+        if (position_ + size > code_.size()) {
+            return false;
+        }
+
+        value = 0;
+        if !consteval {
+            // Load the whole double word at once when possible, avoiding a loop per byte.
+            if (position_ + sizeof(value) <= code_.size()) {
+                std::memcpy(&value, code_.data() + position_, sizeof(value));
+                value &= size_masks[size];
+                position_ += size;
+                return true;
+            }
+        }
+
+        for (std::size_t i{ 0 }; i != size; ++i) {
+            value |= std::to_integer<std::uint32_t>(code_[position_ + i])
+                     << (i * 8);
+        }
+
+        position_ += size;
+        return true;
+    }
+
+private:
+    std::span<const std::byte> code_;
+
+    std::size_t position_{ 0 };
+};
+
+constexpr std::int32_t SignExtend(const std::uint32_t value,
+                                  const std::size_t size) noexcept {
+    if (size == 0) {
+        return 0;
+    }
+
+    const auto shift{ 32 - size * 8 };
+    return static_cast<std::int32_t>(value << shift) >> shift;
+}
+
+constexpr bool IsLegacyPrefix(const std::uint8_t byte,
+                              Instruction& instruction) noexcept {
+    InstructionPrefix prefix{ InstructionPrefix::None };
+    switch (byte) {
+        case 0xF0: {
+            prefix = InstructionPrefix::Lock;
+            break;
+        }
+        case 0xF2: {
+            prefix = InstructionPrefix::Repne;
+            break;
+        }
+        case 0xF3: {
+            prefix = InstructionPrefix::Rep;
+            break;
+        }
+        case 0x66: {
+            prefix = InstructionPrefix::OperandSize;
+            break;
+        }
+        case 0x67: {
+            prefix = InstructionPrefix::AddressSize;
+            break;
+        }
+        case 0x26:
+        case 0x2E:
+        case 0x36:
+        case 0x3E:
+        case 0x64:
+        case 0x65: {
+            prefix = InstructionPrefix::Segment;
+            instruction.segment = byte;
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+
+    instruction.prefixes |= static_cast<std::uint16_t>(prefix);
+    return true;
+}
+
+/**
+ * @brief Decode a @p VEX or @p EVEX prefix and its opcode.
+ *
+ * @details
+ * In 32-bit mode, `C4`, `C5` and `62` are `LES`, `LDS` and `BOUND` unless the next byte has @p ModRM.mod of @p 11.
+ */
+constexpr bool DecodeVectorPrefix(CodeReader& reader, const std::uint8_t escape,
+                                  Instruction& instruction,
+                                  OpcodeTraits& traits) noexcept {
+    constexpr std::uint16_t conflicts{
+        static_cast<std::uint16_t>(InstructionPrefix::Lock)
+        | static_cast<std::uint16_t>(InstructionPrefix::Repne)
+        | static_cast<std::uint16_t>(InstructionPrefix::Rep)
+        | static_cast<std::uint16_t>(InstructionPrefix::OperandSize)
+    };
+
+    if ((instruction.prefixes & conflicts) != 0) {
+        return false;
+    }
+
+    std::uint8_t payload{ 0 };
+    std::uint8_t map{ 1 };
+    if (!reader.Read(payload)) {
+        return false;
+    }
+
+    if (escape == 0xC4 || escape == 0x62) {
+        map = escape == 0xC4 ? payload & 0B11111 : payload & 0B11;
+        if (!reader.Read(payload)) {
+            return false;
+        }
+    }
+
+    if (escape == 0x62 && !reader.Read(payload)) {
+        return false;
+    }
+
+    instruction.prefixes |= static_cast<std::uint16_t>(InstructionPrefix::Vex);
+    if (!reader.Read(instruction.opcode)) {
+        return false;
+    }
+
+    switch (map) {
+        case 1: {
+            instruction.map = OpcodeMap::Secondary;
+            traits = secondary_table[instruction.opcode];
+            if (traits.relative) {
+                return false;
+            }
+
+            break;
+        }
+        case 2: {
+            instruction.map = OpcodeMap::Tertiary38;
+            traits = tertiary_38_table[instruction.opcode];
+            break;
+        }
+        case 3: {
+            instruction.map = OpcodeMap::Tertiary3A;
+            traits = tertiary_3a_table[instruction.opcode];
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+
+    // Vector instructions always have a `ModRM` byte, except `VZEROUPPER` and `VZEROALL`.
+    traits.modrm = !(map == 1 && instruction.opcode == 0x77);
+    return true;
+}
+
+//! Decode a @p ModRM byte and its @p SIB byte and displacement.
+constexpr bool DecodeModRM(CodeReader& reader, const OpcodeTraits& traits,
+                           Instruction& instruction) noexcept {
+    if (!reader.Read(instruction.modrm)) {
+        return false;
+    }
+
+    instruction.has_modrm = true;
+    const std::uint8_t mod{ static_cast<std::uint8_t>(instruction.modrm >> 6) };
+    const std::uint8_t rm{ static_cast<std::uint8_t>(instruction.modrm & 0B111) };
+    if (mod == 0B11 || traits.register_only) {
+        return true;
+    }
+
+    MemoryOperand memory{};
+    if (instruction.HasPrefix(InstructionPrefix::AddressSize)) {
+        if (mod == 0B00 && rm == 0B110) {
+            instruction.displacement_size = 2;
+        } else {
+            std::tie(memory.base, memory.index) = address16_registers[rm];
+            instruction.displacement_size = mod == 0B01 ? 1 : mod == 0B10 ? 2 : 0;
+        }
+
+    } else {
+        std::uint8_t base{ rm };
+        if (rm == 0B100) {
+            if (!reader.Read(instruction.sib)) {
+                return false;
+            }
+
+            instruction.has_sib = true;
+            base = instruction.sib & 0B111;
+            if (const std::uint8_t index{ static_cast<std::uint8_t>(
+                    (instruction.sib >> 3) & 0B111) };
+                index != 0B100) {
+                memory.index = encoded_registers[index];
+                memory.scale = static_cast<std::uint8_t>(1 << (instruction.sib >> 6));
+            }
+        }
+
+        if (mod == 0B00 && base == 0B101) {
+            instruction.displacement_size = 4;
+        } else {
+            memory.base = encoded_registers[base];
+            instruction.displacement_size = mod == 0B01 ? 1 : mod == 0B10 ? 4 : 0;
+        }
+    }
+
+    std::uint32_t displacement{ 0 };
+    if (!reader.Read(instruction.displacement_size, displacement)) {
+        return false;
+    }
+
+    instruction.displacement =
+        SignExtend(displacement, instruction.displacement_size);
+    memory.displacement = instruction.displacement;
+    instruction.memory = memory;
+    instruction.memory_access = instruction.memory_access || !traits.address_only;
+    return true;
+}
+
+//! Get the size of an immediate in bytes.
+constexpr std::size_t ImmediateSize(const Immediate immediate,
+                                    const Instruction& instruction) noexcept {
+    const auto operand16{ instruction.HasPrefix(InstructionPrefix::OperandSize) };
+    const auto reg{ (instruction.modrm >> 3) & 0B111 };
+    switch (immediate) {
+        case Immediate::Byte: {
+            return 1;
+        }
+        case Immediate::Word: {
+            return 2;
+        }
+        case Immediate::Full: {
+            return operand16 ? 2 : 4;
+        }
+        case Immediate::FarPointer: {
+            return operand16 ? 4 : 6;
+        }
+        case Immediate::Offset: {
+            return instruction.HasPrefix(InstructionPrefix::AddressSize) ? 2 : 4;
+        }
+        case Immediate::Enter: {
+            return 3;
+        }
+        case Immediate::Group3Byte: {
+            return reg <= 1 ? 1 : 0;
+        }
+        case Immediate::Group3Full: {
+            return reg <= 1 ? (operand16 ? 2 : 4) : 0;
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+//! Decode immediate operands.
+constexpr bool DecodeImmediate(CodeReader& reader, const Immediate immediate,
+                               Instruction& instruction) noexcept {
+    const auto size{ ImmediateSize(immediate, instruction) };
+    instruction.immediate_size = static_cast<std::uint8_t>(size);
+
+    std::uint32_t second{ 0 };
+    switch (immediate) {
+        case Immediate::FarPointer: {
+            if (!reader.Read(size - 2, instruction.immediate)
+                || !reader.Read(2, second)) {
+                return false;
+            }
+
+            break;
+        }
+        case Immediate::Enter: {
+            if (!reader.Read(2, instruction.immediate)
+                || !reader.Read(1, second)) {
+                return false;
+            }
+
+            break;
+        }
+        default: {
+            return reader.Read(size, instruction.immediate);
+        }
+    }
+
+    instruction.immediate2 = static_cast<std::uint16_t>(second);
+    return true;
+}
+
+//! Whether a one-byte group opcode has a defined @p ModRM.reg extension.
+constexpr bool ValidGroupExtension(const Instruction& instruction) noexcept {
+    const auto mod{ instruction.modrm >> 6 };
+    const auto reg{ (instruction.modrm >> 3) & 0B111 };
+    switch (instruction.opcode) {
+        case 0x8D: {
+            // `LEA` requires a memory operand.
+            return mod != 0B11;
+        }
+        case 0x8F: {
+            return reg == 0;
+        }
+        case 0xC6:
+        case 0xC7: {
+            // `XABORT` and `XBEGIN` are encoded as `C6 F8` and `C7 F8`.
+            return reg == 0 || instruction.modrm == 0xF8;
+        }
+        case 0xFE: {
+            return reg <= 1;
+        }
+        case 0xFF: {
+            // Far calls and jumps require a memory operand.
+            return reg != 7 && !(mod == 0B11 && (reg == 3 || reg == 5));
+        }
+        default: {
+            return true;
+        }
+    }
+}
+
+//! Classify the group-5 instruction `FF` by @p ModRM.reg.
+constexpr void ClassifyGroup5(Instruction& instruction) noexcept {
+    switch ((instruction.modrm >> 3) & 0B111) {
+        case 2:
+        case 3: {
+            instruction.flow = InstructionFlow::IndirectCall;
+            instruction.memory_access = true;
+            break;
+        }
+        case 4:
+        case 5: {
+            instruction.flow = InstructionFlow::IndirectJump;
+            break;
+        }
+        case 6: {
+            instruction.memory_access = true;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+constexpr std::optional<Instruction> Decode(
+    const std::span<const std::byte> code,
+    const std::uintptr_t address) noexcept {
+    CodeReader reader{ code };
+    Instruction instruction{};
+    instruction.address = address;
+
+    std::uint8_t byte{ 0 };
+    while (true) {
+        if (!reader.Read(byte)) {
+            return std::nullopt;
+        } else if (!IsLegacyPrefix(byte, instruction)) {
+            break;
+        }
+
+        ++instruction.prefix_count;
+    }
+
+    OpcodeTraits traits{};
+    std::uint8_t next{ 0 };
+    if (byte == 0x0F) {
+        if (!reader.Read(byte)) {
+            return std::nullopt;
+        }
+
+        if (byte == 0x38 || byte == 0x3A) {
+            instruction.map = byte == 0x38 ? OpcodeMap::Tertiary38
+                                           : OpcodeMap::Tertiary3A;
+            if (!reader.Read(byte)) {
+                return std::nullopt;
+            }
+
+            traits = instruction.map == OpcodeMap::Tertiary38
+                         ? tertiary_38_table[byte]
+                         : tertiary_3a_table[byte];
+        } else {
+            instruction.map = OpcodeMap::Secondary;
+            traits = secondary_table[byte];
+        }
+
+        instruction.opcode = byte;
+
+    } else if ((byte == 0xC4 || byte == 0xC5 || byte == 0x62)
+               && reader.Peek(next) && (next >> 6) == 0B11) {
+        if (!DecodeVectorPrefix(reader, byte, instruction, traits)) {
+            return std::nullopt;
+        }
+
+    } else {
+        instruction.opcode = byte;
+        traits = primary_table[byte];
+    }
+
+    if (!traits.valid) {
+        return std::nullopt;
+    }
+
+    instruction.flow = traits.flow;
+    instruction.relative = traits.relative;
+    instruction.memory_access = traits.implicit_memory;
+
+    if (traits.modrm && !DecodeModRM(reader, traits, instruction)) {
+        return std::nullopt;
+    }
+
+    if (instruction.map == OpcodeMap::Primary && traits.modrm) {
+        if (!ValidGroupExtension(instruction)) {
+            return std::nullopt;
+        } else if (instruction.opcode == 0xFF) {
+            ClassifyGroup5(instruction);
+        }
+    }
+
+    if (!DecodeImmediate(reader, traits.immediate, instruction)) {
+        return std::nullopt;
+    }
+
+    instruction.length = static_cast<std::uint8_t>(reader.Position());
+    if (instruction.relative) {
+        const auto offset{ SignExtend(instruction.immediate,
+                                      instruction.immediate_size) };
+        instruction.target = address + instruction.length + offset;
+        if (instruction.HasPrefix(InstructionPrefix::OperandSize)) {
+            instruction.target &= 0xFFFF;
+        }
+    }
+
+    return instruction;
+}
+
+
+/**
+ * @brief
+ * The layout of an opcode for the fast length path.
+ *
+ * @details
+ * - Bits 0-2: The size of the immediate with 32-bit operand and address sizes.
+ * - Bit 3: Whether it has a @p ModRM byte.
+ * - Bit 4: Whether it must be decoded by the slow path.
+ */
+using OpcodeLayout = std::uint8_t;
+
+constexpr OpcodeLayout layout_immediate_mask{ 0B00111 };
+constexpr OpcodeLayout layout_modrm{ 0B01000 };
+constexpr OpcodeLayout layout_slow{ 0B10000 };
+
+constexpr std::array<OpcodeLayout, 0x100> MakeLayouts(
+    const OpcodeTable& table) noexcept {
+    std::array<OpcodeLayout, 0x100> layouts{};
+    for (std::size_t i{ 0 }; i != table.size(); ++i) {
+        const auto& traits{ table[i] };
+        Instruction instruction{};
+        const auto size{ ImmediateSize(traits.immediate, instruction) };
+        if (!traits.valid || traits.register_only
+            || traits.immediate == Immediate::Group3Byte
+            || traits.immediate == Immediate::Group3Full) {
+            layouts[i] = layout_slow;
+        } else {
+            layouts[i] = static_cast<OpcodeLayout>(
+                size | (traits.modrm ? layout_modrm : 0));
+        }
+    }
+
+    return layouts;
+}
+
+constexpr std::array<OpcodeLayout, 0x100> primary_layouts{ [] {
+    auto layouts{ MakeLayouts(primary_table) };
+    // Legacy prefixes, the two-byte escape and vector prefixes.
+    for (const std::size_t opcode : { 0x0F, 0x26, 0x2E, 0x36, 0x3E, 0x62, 0x64,
+                                      0x65, 0x66, 0x67, 0xC4, 0xC5, 0xF0, 0xF2,
+                                      0xF3 }) {
+        layouts[opcode] = layout_slow;
+    }
+
+    return layouts;
+}() };
+
+constexpr std::array<OpcodeLayout, 0x100> secondary_layouts{ [] {
+    auto layouts{ MakeLayouts(secondary_table) };
+    // Three-byte escapes.
+    layouts[0x38] = layout_slow;
+    layouts[0x3A] = layout_slow;
+    return layouts;
+}() };
+
+/**
+ * @brief
+ * The layout of a @p ModRM byte with 32-bit address size.
+ *
+ * @details
+ * - Bits 0-2: The size of the displacement.
+ * - Bit 3: Whether it has a @p SIB byte.
+ */
+constexpr std::array<std::uint8_t, 0x100> modrm_layouts{ [] {
+    std::array<std::uint8_t, 0x100> layouts{};
+    for (std::size_t modrm{ 0 }; modrm != layouts.size(); ++modrm) {
+        const auto mod{ modrm >> 6 };
+        const auto rm{ modrm & 0B111 };
+        if (mod == 0B11) {
+            continue;
+        }
+
+        const auto sib{ rm == 0B100 ? 0B1000 : 0 };
+        const auto displacement{
+            mod == 0B01 ? 1
+            : mod == 0B10 || (mod == 0B00 && rm == 0B101) ? 4
+                                                            : 0
+        };
+        layouts[modrm] = static_cast<std::uint8_t>(sib | displacement);
+    }
+
+    return layouts;
+}() };
+
+//! The valid @p ModRM.reg extensions of one-byte group opcodes with memory operands, as bit masks.
+constexpr std::array<std::uint8_t, 0x100> primary_memory_group_masks{ [] {
+    std::array<std::uint8_t, 0x100> masks{};
+    masks.fill(0xFF);
+    masks[0x8F] = 0B00000001;
+    masks[0xC6] = 0B00000001;
+    masks[0xC7] = 0B00000001;
+    masks[0xFE] = 0B00000011;
+    masks[0xFF] = 0B01111111;
+    return masks;
+}() };
+
+//! The valid @p ModRM.reg extensions of one-byte group opcodes with register operands, as bit masks.
+constexpr std::array<std::uint8_t, 0x100> primary_register_group_masks{ [] {
+    auto masks{ primary_memory_group_masks };
+    masks[0x8D] = 0B00000000;
+    masks[0xFF] = 0B01010111;
+    return masks;
+}() };
+
+/**
+ * @brief Get the length of an instruction.
+ *
+ * @details
+ * Instructions without prefixes are measured by table lookups without bounds checking,
+ * if there are enough bytes for the longest instruction.
+ * Others fall back to the full decoder.
+ */
+constexpr std::size_t Length(const std::span<const std::byte> code) noexcept {
+    const auto slow{ [code]() noexcept -> std::size_t {
+        const auto instruction{ Decode(code, 0) };
+        return instruction ? instruction->length : 0;
+    } };
+
+    if (code.size() < max_instruction_length) {
+        return slow();
+    }
+
+    const auto byte{ [code](const std::size_t i) noexcept {
+        return std::to_integer<std::uint8_t>(code[i]);
+    } };
+
+    const auto opcode{ byte(0) };
+    std::size_t length{ 1 };
+    auto layout{ primary_layouts[opcode] };
+    if (opcode == 0x0F) {
+        layout = secondary_layouts[byte(1)];
+        ++length;
+    }
+
+    if ((layout & layout_slow) != 0) {
+        return slow();
+    }
+
+    if ((layout & layout_modrm) != 0) {
+        const auto modrm{ byte(length) };
+        const auto& masks{ modrm >= 0B11000000 ? primary_register_group_masks
+                                               : primary_memory_group_masks };
+        if (opcode != 0x0F
+            && ((masks[opcode] >> ((modrm >> 3) & 0B111)) & 1) == 0) {
+            return slow();
+        }
+
+        const auto modrm_layout{ modrm_layouts[modrm] };
+        length += 1 + (modrm_layout & 0B111);
+        if ((modrm_layout & 0B1000) != 0) {
+            const auto sib{ byte(length - (modrm_layout & 0B111)) };
+            length += 1 + ((modrm < 0B01000000 && (sib & 0B111) == 0B101) ? 4 : 0);
+        }
+    }
+
+    return length + (layout & layout_immediate_mask);
+}
+
+
+//! Get the length of an instruction in a constant expression.
+constexpr std::size_t LengthOf(const std::initializer_list<std::uint8_t> bytes) noexcept {
+    std::array<std::byte, max_instruction_length> code{};
+    std::ranges::transform(bytes, code.begin(),
+                           [](const auto byte) { return std::byte{ byte }; });
+    const auto instruction{ Decode(std::span{ code }.first(bytes.size()), 0) };
+    if (!instruction) {
+        return 0;
+    }
+
+    // The fast path only runs on a full-length buffer, padded with zeros here.
+    return Length(code) == instruction->length ? instruction->length : 0;
+}
+
+//! Get the control flow of an instruction in a constant expression.
+constexpr std::optional<InstructionFlow> FlowOf(
+    const std::initializer_list<std::uint8_t> bytes) noexcept {
+    std::array<std::byte, max_instruction_length> code{};
+    std::ranges::transform(bytes, code.begin(),
+                           [](const auto byte) { return std::byte{ byte }; });
+    const auto instruction{ Decode(std::span{ code }.first(bytes.size()), 0) };
+    return instruction ? std::make_optional(instruction->flow) : std::nullopt;
+}
+
+// push ebp
+static_assert(LengthOf({ 0x55 }) == 1);
+// mov ebp, esp
+static_assert(LengthOf({ 0x8B, 0xEC }) == 2);
+// mov eax, dword ptr [ebp+8]
+static_assert(LengthOf({ 0x8B, 0x45, 0x08 }) == 3);
+// mov eax, dword ptr [esp+eax*4+0x12345678]
+static_assert(LengthOf({ 0x8B, 0x84, 0x84, 0x78, 0x56, 0x34, 0x12 }) == 7);
+// mov eax, dword ptr [0x12345678] (SIB without base)
+static_assert(LengthOf({ 0x8B, 0x04, 0x25, 0x78, 0x56, 0x34, 0x12 }) == 7);
+// mov dword ptr fs:[0], eax
+static_assert(LengthOf({ 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00 }) == 6);
+// mov ax, 0x1234
+static_assert(LengthOf({ 0x66, 0xB8, 0x34, 0x12 }) == 4);
+// mov word ptr [bx+si+0x10], 0x1234
+static_assert(LengthOf({ 0x66, 0x67, 0xC7, 0x40, 0x10, 0x34, 0x12 }) == 7);
+// test dword ptr [eax], 0x12345678
+static_assert(LengthOf({ 0xF7, 0x00, 0x78, 0x56, 0x34, 0x12 }) == 6);
+// not dword ptr [eax]
+static_assert(LengthOf({ 0xF7, 0x10 }) == 2);
+// enter 0x10, 0
+static_assert(LengthOf({ 0xC8, 0x10, 0x00, 0x00 }) == 4);
+// call 0x1234:0x12345678
+static_assert(LengthOf({ 0x9A, 0x78, 0x56, 0x34, 0x12, 0x34, 0x12 }) == 7);
+// jz rel32
+static_assert(LengthOf({ 0x0F, 0x84, 0x00, 0x00, 0x00, 0x00 }) == 6);
+// pshufd xmm0, xmm1, 0x1B
+static_assert(LengthOf({ 0x66, 0x0F, 0x70, 0xC1, 0x1B }) == 5);
+// pshufb xmm0, xmm1
+static_assert(LengthOf({ 0x66, 0x0F, 0x38, 0x00, 0xC1 }) == 5);
+// vaddps ymm0, ymm1, ymmword ptr [eax+0x10]
+static_assert(LengthOf({ 0xC5, 0xF4, 0x58, 0x40, 0x10 }) == 5);
+// vpermq ymm0, ymm1, 0x1B
+static_assert(LengthOf({ 0xC4, 0xE3, 0xFD, 0x00, 0xC1, 0x1B }) == 6);
+// lds eax, fword ptr [eax]
+static_assert(LengthOf({ 0xC5, 0x00 }) == 2);
+// Truncated instructions.
+static_assert(LengthOf({ 0x8B, 0x45 }) == 0);
+static_assert(LengthOf({ 0xE8, 0x00, 0x00 }) == 0);
+
+static_assert(FlowOf({ 0xE8, 0x00, 0x00, 0x00, 0x00 }) == InstructionFlow::Call);
+static_assert(FlowOf({ 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00 })
+              == InstructionFlow::IndirectCall);
+static_assert(FlowOf({ 0xFF, 0xE0 }) == InstructionFlow::IndirectJump);
+static_assert(FlowOf({ 0xEB, 0xFE }) == InstructionFlow::Jump);
+static_assert(FlowOf({ 0xE2, 0xFE }) == InstructionFlow::ConditionalJump);
+static_assert(FlowOf({ 0xC2, 0x08, 0x00 }) == InstructionFlow::Return);
+static_assert(FlowOf({ 0xCC }) == InstructionFlow::Interrupt);
+static_assert(FlowOf({ 0x8D, 0x45, 0x08 }) == InstructionFlow::Sequential);
+
+}  // namespace
+
+
+std::optional<Instruction> DecodeInstruction(
+    const std::span<const std::byte> code,
+    const std::uintptr_t address) noexcept {
+    return Decode(code, address);
+}
+
+std::size_t InstructionLength(const std::span<const std::byte> code) noexcept {
+    return Length(code);
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "module.h"
+
+#include <algorithm>
+#include <cwctype>
+
+
+std::wstring_view Module::Name() const noexcept {
+    const std::wstring_view name{ path };
+    const auto separator{ name.find_last_of(L"\\/") };
+    return separator != std::wstring_view::npos ? name.substr(separator + 1)
+                                                : name;
+}
+
+bool Module::Contains(const std::uintptr_t address) const noexcept {
+    return base <= address && address - base < size;
+}
+
+std::wstring LowerModuleName(const std::wstring_view name) {
+    std::wstring lower(name.size(), L'\0');
+    std::ranges::transform(name, lower.begin(), [](const wchar_t c) {
+        return static_cast<wchar_t>(std::towlower(c));
+    });
+    return lower;
+}
\ No newline at end of file
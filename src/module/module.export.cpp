@@ -0,0 +1,64 @@
+#include "pe.h"
+
+#include <algorithm>
+#include <iterator>
+
+
+std::size_t ExportTable::NameHash::operator()(
+    const std::string_view name) const noexcept {
+    return std::hash<std::string_view>{}(name);
+}
+
+ExportTable::ExportTable(std::vector<Export> exports) :
+    exports_{ std::move(exports) } {
+    std::ranges::stable_sort(exports_, {}, &Export::ordinal);
+
+    names_.reserve(exports_.size());
+    offsets_.reserve(exports_.size());
+    for (std::size_t i{ 0 }; i != exports_.size(); ++i) {
+        if (!exports_[i].name.empty()) {
+            names_.try_emplace(exports_[i].name, i);
+        }
+
+        if (exports_[i].forwarder.empty()) {
+            offsets_.push_back(i);
+        }
+    }
+
+    std::ranges::stable_sort(offsets_, {}, [this](const std::size_t i) {
+        return exports_[i].offset;
+    });
+}
+
+OptionalExport ExportTable::Find(const std::string_view name) const noexcept {
+    const auto found{ names_.find(name) };
+    return found != names_.cend() ? OptionalExport{ exports_[found->second] }
+                                  : std::nullopt;
+}
+
+OptionalExport ExportTable::FindOrdinal(
+    const std::uint32_t ordinal) const noexcept {
+    const auto found{ std::ranges::lower_bound(exports_, ordinal, {},
+                                               &Export::ordinal) };
+    return found != exports_.cend() && found->ordinal == ordinal
+               ? OptionalExport{ *found }
+               : std::nullopt;
+}
+
+OptionalExport ExportTable::FindNearest(
+    const std::uint32_t offset) const noexcept {
+    const auto found{ std::ranges::upper_bound(
+        offsets_, offset, {},
+        [this](const std::size_t i) { return exports_[i].offset; }) };
+    return found != offsets_.cbegin()
+               ? OptionalExport{ exports_[*std::prev(found)] }
+               : std::nullopt;
+}
+
+std::span<const Export> ExportTable::Exports() const noexcept {
+    return exports_;
+}
+
+std::size_t ExportTable::Size() const noexcept {
+    return exports_.size();
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include "pe.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+
+namespace {
+
+/**
+ * @brief Copy a structure from data.
+ *
+ * @param data The data.
+ * @param offset The offset of the structure.
+ * @return The structure, or @p std::nullopt if it extends past the data.
+ */
+template <typename T>
+std::optional<T> ReadStruct(const std::span<const std::byte> data,
+                            const std::size_t offset) noexcept {
+    if (offset > data.size() || data.size() - offset < sizeof(T)) {
+        return std::nullopt;
+    }
+
+    T value{};
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+/**
+ * @brief Read a null-terminated string from data.
+ *
+ * @param data The data.
+ * @param offset The offset of the string.
+ * @return The string, or @p std::nullopt if it is not terminated within the data.
+ */
+std::optional<std::string> ReadString(const std::span<const std::byte> data,
+                                      const std::size_t offset) {
+    if (offset >= data.size()) {
+        return std::nullopt;
+    }
+
+    const auto begin{ data.begin() + offset };
+    const auto end{ std::find(begin, data.end(), std::byte{ 0 }) };
+    if (end == data.end()) {
+        return std::nullopt;
+    }
+
+    return std::string{ reinterpret_cast<const char*>(&*begin),
+                        static_cast<std::size_t>(end - begin) };
+}
+
+/**
+ * @brief Get an array of export data.
+ *
+ * @param data Memory of the export directory.
+ * @param offset The offset of the directory from the module base.
+ * @param array_offset The offset of the array from the module base.
+ * @param count The number of elements.
+ * @return The array, or @p std::nullopt if it extends past the data.
+ */
+template <typename T>
+std::optional<std::span<const std::byte>> ExportArray(
+    const std::span<const std::byte> data, const std::uint32_t offset,
+    const std::uint32_t array_offset, const std::size_t count) noexcept {
+    // Empty arrays may have no address, such as the name arrays of modules exporting only ordinals.
+    if (count == 0) {
+        return std::span<const std::byte>{};
+    }
+
+    if (array_offset < offset || array_offset - offset > data.size()
+        || (data.size() - (array_offset - offset)) / sizeof(T) < count) {
+        return std::nullopt;
+    }
+
+    return data.subspan(array_offset - offset, count * sizeof(T));
+}
+
+//! Get an element of an array returned by @p ExportArray.
+template <typename T>
+T ArrayElement(const std::span<const std::byte> array,
+               const std::size_t index) noexcept {
+    T value{};
+    std::memcpy(&value, array.data() + index * sizeof(T), sizeof(T));
+    return value;
+}
+
+}  // namespace
+
+
+bool ModuleSection::Executable() const noexcept {
+    return (characteristics & pe::section_executable) != 0;
+}
+
+std::optional<PeHeaders> ParsePeHeaders(const std::span<const std::byte> data) {
+    const auto dos_header{ ReadStruct<pe::DosHeader>(data, 0) };
+    if (!dos_header || dos_header->magic != pe::dos_signature
+        || dos_header->nt_offset < 0) {
+        return std::nullopt;
+    }
+
+    const auto nt_offset{ static_cast<std::size_t>(dos_header->nt_offset) };
+    const auto nt_headers{ ReadStruct<pe::NtHeaders32>(data, nt_offset) };
+    if (!nt_headers || nt_headers->signature != pe::nt_signature
+        || nt_headers->optional_header.magic != pe::optional_header32_magic) {
+        return std::nullopt;
+    }
+
+    const auto& optional_header{ nt_headers->optional_header };
+    const auto& file_header{ nt_headers->file_header };
+    const auto section_offset{ nt_offset
+                               + offsetof(pe::NtHeaders32, optional_header)
+                               + file_header.optional_header_size };
+    PeHeaders headers{
+        .image_size = optional_header.image_size,
+        .required_size = section_offset
+                         + sizeof(pe::SectionHeader) * file_header.section_count,
+        .entry = optional_header.entry
+    };
+
+    // A directory outside the image is ignored, so it never causes a large read.
+    if (optional_header.directory_count > pe::export_directory_index) {
+        const auto& directory{
+            optional_header.directories[pe::export_directory_index]
+        };
+        if (directory.offset < headers.image_size
+            && directory.size <= headers.image_size - directory.offset) {
+            headers.export_offset = directory.offset;
+            headers.export_size = directory.size;
+        }
+    }
+
+    if (headers.required_size > data.size()) {
+        return headers;
+    }
+
+    headers.sections.reserve(file_header.section_count);
+    for (std::size_t i{ 0 }; i != file_header.section_count; ++i) {
+        const auto section{ *ReadStruct<pe::SectionHeader>(
+            data, section_offset + sizeof(pe::SectionHeader) * i) };
+        const std::string_view name{ section.name.data(), section.name.size() };
+        headers.sections.push_back(
+            { .name = std::string{ name.substr(0, name.find('\0')) },
+              .offset = section.offset,
+              // The virtual size of some linkers' sections is zero.
+              .size = section.virtual_size != 0 ? section.virtual_size
+                                                : section.raw_size,
+              .characteristics = section.characteristics });
+    }
+
+    return headers;
+}
+
+std::optional<ExportTable> ParseExportDirectory(
+    const std::span<const std::byte> data, const std::uint32_t offset) {
+    const auto directory{ ReadStruct<pe::ExportDirectory>(data, 0) };
+    if (!directory) {
+        return std::nullopt;
+    }
+
+    const auto functions{ ExportArray<std::uint32_t>(
+        data, offset, directory->functions, directory->function_count) };
+    const auto names{ ExportArray<std::uint32_t>(
+        data, offset, directory->names, directory->name_count) };
+    const auto ordinals{ ExportArray<std::uint16_t>(
+        data, offset, directory->name_ordinals, directory->name_count) };
+    if (!functions || !names || !ordinals) {
+        return std::nullopt;
+    }
+
+    // Indexes of exports in the address array, or -1 for unused entries.
+    std::vector<std::ptrdiff_t> indexes(directory->function_count, -1);
+    std::vector<Export> exports{};
+    for (std::size_t i{ 0 }; i != directory->function_count; ++i) {
+        const auto function{ ArrayElement<std::uint32_t>(*functions, i) };
+        if (function == 0) {
+            continue;
+        }
+
+        Export exported{ .ordinal = static_cast<std::uint32_t>(
+                             directory->ordinal_base + i),
+                         .offset = function };
+        // An address inside the directory points to a forwarder string instead of code.
+        if (function >= offset && function - offset < data.size()) {
+            exported.forwarder =
+                ReadString(data, function - offset).value_or("");
+        }
+
+        indexes[i] = static_cast<std::ptrdiff_t>(exports.size());
+        exports.push_back(std::move(exported));
+    }
+
+    for (std::size_t i{ 0 }; i != directory->name_count; ++i) {
+        const auto index{ ArrayElement<std::uint16_t>(*ordinals, i) };
+        const auto name_offset{ ArrayElement<std::uint32_t>(*names, i) };
+        if (index >= indexes.size() || indexes[index] < 0
+            || name_offset < offset) {
+            continue;
+        }
+
+        auto name{ ReadString(data, name_offset - offset) };
+        if (!name) {
+            continue;
+        }
+
+        auto& exported{ exports[static_cast<std::size_t>(indexes[index])] };
+        if (exported.name.empty()) {
+            exported.name = std::move(*name);
+        } else {
+            // A function exported under several names gets an export for each name.
+            auto alias{ exported };
+            alias.name = std::move(*name);
+            exports.push_back(std::move(alias));
+        }
+    }
+
+    return ExportTable{ std::move(exports) };
+}
+
+std::optional<std::string> ParseExportName(const std::span<const std::byte> data,
+                                           const std::uint32_t offset) {
+    const auto directory{ ReadStruct<pe::ExportDirectory>(data, 0) };
+    if (!directory || directory->name < offset) {
+        return std::nullopt;
+    }
+
+    auto name{ ReadString(data, directory->name - offset) };
+    return name && !name->empty() ? name : std::nullopt;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "module.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <iterator>
+
+
+const Module& ModuleTable::Insert(Module module) {
+    const auto position{ std::ranges::lower_bound(modules_, module.base, {},
+                                                  &Module::base) };
+    if (position != modules_.end() && position->base == module.base) {
+        *position = std::move(module);
+        return *position;
+    } else {
+        return *modules_.insert(position, std::move(module));
+    }
+}
+
+bool ModuleTable::Erase(const std::uintptr_t base) noexcept {
+    const auto position{ std::ranges::lower_bound(modules_, base, {},
+                                                  &Module::base) };
+    if (position == modules_.end() || position->base != base) {
+        return false;
+    }
+
+    modules_.erase(position);
+    return true;
+}
+
+OptionalModule ModuleTable::Find(const std::uintptr_t address) const noexcept {
+    const auto found{ std::ranges::upper_bound(modules_, address, {},
+                                               &Module::base) };
+    if (found == modules_.cbegin() || !std::prev(found)->Contains(address)) {
+        return std::nullopt;
+    }
+
+    return *std::prev(found);
+}
+
+OptionalModule ModuleTable::FindByName(
+    const std::wstring_view name) const noexcept {
+    const auto lower{ [](const wchar_t c) { return std::towlower(c); } };
+    const auto found{ std::ranges::find_if(
+        modules_, [&name, &lower](const Module& module) {
+            return std::ranges::equal(module.Name(), name, {}, lower, lower);
+        }) };
+    return found != modules_.cend() ? OptionalModule{ *found } : std::nullopt;
+}
+
+std::optional<ModuleAddress> ModuleTable::Locate(
+    const std::uintptr_t address) const noexcept {
+    const auto module{ Find(address) };
+    if (!module) {
+        return std::nullopt;
+    }
+
+    return ModuleAddress{ &module->get(), address - module->get().base };
+}
+
+std::vector<MemoryRange> ModuleTable::CodeRanges() const {
+    std::vector<MemoryRange> ranges{};
+    for (const auto& module : modules_) {
+        for (const auto& section : module.sections) {
+            if (section.Executable()) {
+                const auto begin{ module.base + section.offset };
+                ranges.emplace_back(begin, begin + section.size);
+            }
+        }
+    }
+
+    return ranges;
+}
+
+std::span<const Module> ModuleTable::Modules() const noexcept {
+    return modules_;
+}
+
+std::size_t ModuleTable::Size() const noexcept {
+    return modules_.size();
+}
+
+void ModuleTable::Clear() noexcept {
+    modules_.clear();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "process.h"
+
+#include <format>
+#include <stdexcept>
+
+
+void Process::SetBreakpointHitPolicy(const BreakpointKey breakpoint,
+                                     const BreakpointHitPolicy& policy) {
+    const auto found{ FindBreakpoint(breakpoint) };
+    if (!found) {
+        throw std::runtime_error{ std::format(
+            "There is no breakpoint of the type at {:#010x}.",
+            breakpoint.second) };
+    }
+
+    found->hit_policy = policy;
+    found->hits = 0;
+    found->reported_hits = 0;
+    EnableBreakpoint(breakpoint);
+}
+
+OptionalBreakpoint Process::HitBreakpoint(const BreakpointKey breakpoint) {
+    const auto found{ FindBreakpoint(breakpoint) };
+    if (!found || !found->Hit()) {
+        return std::nullopt;
+    }
+
+    if (found->Exhausted()) {
+        DisableBreakpoint(breakpoint);
+    }
+
+    return *found;
+}
+
+bool Process::EnableBreakpoint(const BreakpointKey breakpoint) {
+    const auto found{ FindBreakpoint(breakpoint) };
+    if (!found || found->enabled) {
+        return false;
+    }
+
+    const auto [type, address]{ breakpoint };
+    if (type == BreakpointType::Software) {
+        AcquireInt3(address);
+        breakpoint_heats_.try_emplace(address);
+    } else {
+        const auto& hardware{ hardware_breakpoints_.at(address) };
+        SetBreakpointDebugRegisters(breakpoint, hardware.slot, hardware.access,
+                                    hardware.size);
+    }
+
+    found->enabled = true;
+    return true;
+}
+
+bool Process::DisableBreakpoint(const BreakpointKey breakpoint) {
+    const auto found{ FindBreakpoint(breakpoint) };
+    if (!found || !found->enabled) {
+        return false;
+    }
+
+    const auto [type, address]{ breakpoint };
+    if (type == BreakpointType::Software) {
+        if (const auto promoted{ promoted_breakpoints_.find(address) };
+            promoted != promoted_breakpoints_.cend()) {
+            for (const auto& [_, thread] : threads_) {
+                thread.DeleteHardwareBreakpoint(promoted->second);
+            }
+
+            promoted_breakpoints_.erase(promoted);
+        } else {
+            ReleaseInt3(address);
+        }
+
+        breakpoint_heats_.erase(address);
+    } else {
+        const auto slot{ hardware_breakpoints_.at(address).slot };
+        for (const auto& [_, thread] : threads_) {
+            thread.DeleteHardwareBreakpoint(slot);
+        }
+    }
+
+    found->enabled = false;
+    return true;
+}
\ No newline at end of file
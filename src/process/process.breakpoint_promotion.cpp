@@ -0,0 +1,148 @@
+#include "process.h"
+
+#include <algorithm>
+#include <utility>
+
+
+void Process::SetBreakpointPromotionPolicy(
+    const BreakpointPromotionPolicy& policy,
+    BreakpointMigrationCallback callback) {
+    promotion_policy_ = policy;
+    migration_callback_ = std::move(callback);
+
+    if (!promotion_policy_.enabled) {
+        while (!promoted_breakpoints_.empty()) {
+            DemoteBreakpoint(promoted_breakpoints_.cbegin()->first);
+        }
+
+        for (auto& [_, heat] : breakpoint_heats_) {
+            heat = {};
+        }
+    }
+}
+
+void Process::CountBreakpointHit(const std::uintptr_t address) {
+    if (!promotion_policy_.enabled) {
+        return;
+    }
+
+    const auto breakpoint{ software_breakpoints_.find(address) };
+    if (breakpoint == software_breakpoints_.cend()
+        || breakpoint->second.single_shoot) {
+        return;
+    }
+
+    const auto heat_found{ breakpoint_heats_.find(address) };
+    if (heat_found == breakpoint_heats_.end()) {
+        return;
+    }
+
+    auto& heat{ heat_found->second };
+    if (promoted_breakpoints_.contains(address)) {
+        // Periods of promoted breakpoints are closed by `AdaptBreakpoints`.
+        ++heat.hits;
+        return;
+    }
+
+    const auto now{ std::chrono::steady_clock::now() };
+    if (now - heat.window_start >= promotion_policy_.window) {
+        heat = { now, 0 };
+    }
+
+    if (++heat.hits < promotion_policy_.promotion_hits
+        || hardware_breakpoints_.contains(address)) {
+        return;
+    }
+
+    // `INT3` instruction shared with tracepoints or return breakpoints must stay in memory.
+    if (const auto site{ int3_sites_.find(address) };
+        site == int3_sites_.cend() || site->second.references != 1) {
+        return;
+    }
+
+    HardwareBreakpointSlot slot{};
+    if (FindIdleHardwareBreakpointSlot(slot)
+        || DemoteColdestBreakpoint(heat.hits, slot)) {
+        PromoteBreakpoint(address, slot);
+        heat = { now, 0 };
+    }
+}
+
+void Process::AdaptBreakpoints() {
+    if (promoted_breakpoints_.empty()) {
+        return;
+    }
+
+    const auto now{ std::chrono::steady_clock::now() };
+    for (auto promoted{ promoted_breakpoints_.begin() };
+         promoted != promoted_breakpoints_.end();) {
+        const auto address{ (promoted++)->first };
+        auto& heat{ breakpoint_heats_[address] };
+        if (now - heat.window_start < promotion_policy_.window) {
+            continue;
+        }
+
+        const auto cold{ heat.hits < promotion_policy_.demotion_hits };
+        heat = { now, 0 };
+        if (cold) {
+            DemoteBreakpoint(address);
+        }
+    }
+}
+
+std::optional<HardwareBreakpointSlot> Process::FindPromotedBreakpoint(
+    const std::uintptr_t address) const noexcept {
+    const auto found{ promoted_breakpoints_.find(address) };
+    return found != promoted_breakpoints_.cend()
+               ? std::make_optional(found->second)
+               : std::nullopt;
+}
+
+bool Process::DemoteColdestBreakpoint(const std::size_t hits,
+                                      HardwareBreakpointSlot& slot) {
+    const auto coldest{ std::ranges::min_element(
+        promoted_breakpoints_, {}, [this](const auto& promoted) {
+            return breakpoint_heats_[promoted.first].hits;
+        }) };
+
+    if (coldest == promoted_breakpoints_.cend()
+        || breakpoint_heats_[coldest->first].hits >= hits) {
+        return false;
+    }
+
+    slot = coldest->second;
+    DemoteBreakpoint(coldest->first);
+    return true;
+}
+
+void Process::PromoteBreakpoint(const std::uintptr_t address,
+                                const HardwareBreakpointSlot slot) {
+    ReleaseInt3(address);
+    promoted_breakpoints_.insert({ address, slot });
+    SetBreakpointDebugRegisters({ BreakpointType::Software, address }, slot,
+                                HardwareBreakpointType::Execute,
+                                HardwareBreakpointSize::Byte);
+
+    if (migration_callback_) {
+        migration_callback_({ address, slot, true });
+    }
+}
+
+void Process::DemoteBreakpoint(const std::uintptr_t address) {
+    const auto found{ promoted_breakpoints_.find(address) };
+    if (found == promoted_breakpoints_.cend()) {
+        return;
+    }
+
+    const auto slot{ found->second };
+    promoted_breakpoints_.erase(found);
+    for (const auto& [_, thread] : threads_) {
+        thread.DeleteHardwareBreakpoint(slot);
+    }
+
+    AcquireInt3(address);
+
+    if (migration_callback_) {
+        migration_callback_({ address, slot, false });
+    }
+}
\ No newline at end of file
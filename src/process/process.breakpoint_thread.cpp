@@ -0,0 +1,82 @@
+#include "process.h"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+
+void Process::SetBreakpointThreads(
+    const BreakpointKey breakpoint,
+    const std::span<const std::uint32_t> thread_ids) {
+    const auto [type, address]{ breakpoint };
+    if ((type == BreakpointType::Software
+         && !software_breakpoints_.contains(address))
+        || (type == BreakpointType::Hardware
+            && !hardware_breakpoints_.contains(address))
+        || type == BreakpointType::Memory) {
+        throw std::runtime_error{ std::format(
+            "There is no breakpoint of the type at {:#010x}.", address) };
+    }
+
+    if (thread_ids.empty()) {
+        breakpoint_threads_.erase(breakpoint);
+    } else {
+        ThreadFilter filter{ { thread_ids.begin(), thread_ids.end() } };
+        std::ranges::sort(filter.threads);
+        const auto [first, last]{ std::ranges::unique(filter.threads) };
+        filter.threads.erase(first, last);
+
+        if (const auto found{ breakpoint_threads_.find(breakpoint) };
+            found != breakpoint_threads_.cend()) {
+            filter.filtered_hits = found->second.filtered_hits;
+        }
+
+        breakpoint_threads_.insert_or_assign(breakpoint, std::move(filter));
+    }
+
+    // Debug registers are per thread, so excluded threads never hit the breakpoint.
+    if (type == BreakpointType::Hardware) {
+        if (const auto& hardware{ hardware_breakpoints_.at(address) };
+            hardware.enabled) {
+            SetBreakpointDebugRegisters(breakpoint, hardware.slot,
+                                        hardware.access, hardware.size);
+        }
+    } else if (const auto promoted{ promoted_breakpoints_.find(address) };
+               promoted != promoted_breakpoints_.cend()) {
+        SetBreakpointDebugRegisters(breakpoint, promoted->second,
+                                    HardwareBreakpointType::Execute,
+                                    HardwareBreakpointSize::Byte);
+    }
+}
+
+void Process::SetBreakpointDebugRegisters(
+    const BreakpointKey breakpoint, const HardwareBreakpointSlot slot,
+    const HardwareBreakpointType access,
+    const HardwareBreakpointSize size) const {
+    const auto found{ breakpoint_threads_.find(breakpoint) };
+    for (const auto& [id, thread] : threads_) {
+        if (found == breakpoint_threads_.cend() || found->second.Contains(id)) {
+            thread.SetHardwareBreakpoint(breakpoint.second, slot, access, size);
+        } else {
+            thread.DeleteHardwareBreakpoint(slot);
+        }
+    }
+}
+
+bool Process::FilterBreakpointHit(const BreakpointKey breakpoint,
+                                  const std::uint32_t thread_id) noexcept {
+    const auto found{ breakpoint_threads_.find(breakpoint) };
+    if (found == breakpoint_threads_.end() || found->second.Contains(thread_id)) {
+        return false;
+    }
+
+    ++found->second.filtered_hits;
+    return true;
+}
+
+std::uint64_t Process::FilteredBreakpointHits(
+    const BreakpointKey breakpoint) const noexcept {
+    const auto found{ breakpoint_threads_.find(breakpoint) };
+    return found != breakpoint_threads_.cend() ? found->second.filtered_hits
+                                               : 0;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "process.h"
+
+
+void Process::SetBreakpointCondition(const BreakpointKey breakpoint,
+                                     const std::string_view expression) {
+    breakpoint_conditions_.insert_or_assign(breakpoint, Condition{ expression });
+}
+
+bool Process::DeleteBreakpointCondition(const BreakpointKey breakpoint) noexcept {
+    return breakpoint_conditions_.erase(breakpoint) != 0;
+}
+
+OptionalCondition Process::FindBreakpointCondition(
+    const BreakpointKey breakpoint) const noexcept {
+    const auto found{ breakpoint_conditions_.find(breakpoint) };
+    return found != breakpoint_conditions_.cend()
+               ? OptionalCondition{ found->second }
+               : std::nullopt;
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <exception>
 #include <utility>
 
 
@@ -22,11 +23,25 @@ Process::Process(Process&& process) noexcept :
     create_info_{ process.create_info_ },
     hit_system_breakpoint_{ process.hit_system_breakpoint_ },
     threads_{ std::move(process.threads_) },
-    debugged_thread_{ std::move(debugged_thread_) },
-    breakpoint_callbacks_{ std::move(breakpoint_callbacks_) },
-    software_breakpoints_{ std::move(software_breakpoints_) },
-    hardware_breakpoints_{ std::move(hardware_breakpoints_) },
-    hardware_breakpoint_slots_{ std::move(hardware_breakpoint_slots_) } {
+    debugged_thread_{ std::move(process.debugged_thread_) },
+    frozen_threads_{ std::move(process.frozen_threads_) },
+    last_thread_{ process.last_thread_ },
+    breakpoint_callbacks_{ std::move(process.breakpoint_callbacks_) },
+    breakpoint_conditions_{ std::move(process.breakpoint_conditions_) },
+    breakpoint_threads_{ std::move(process.breakpoint_threads_) },
+    software_breakpoints_{ std::move(process.software_breakpoints_) },
+    hardware_breakpoints_{ std::move(process.hardware_breakpoints_) },
+    hardware_breakpoint_slots_{ std::move(process.hardware_breakpoint_slots_) },
+    return_breakpoints_{ std::move(process.return_breakpoints_) },
+    tracepoints_{ std::move(process.tracepoints_) },
+    int3_sites_{ std::move(process.int3_sites_) },
+    promotion_policy_{ process.promotion_policy_ },
+    migration_callback_{ std::move(process.migration_callback_) },
+    promoted_breakpoints_{ std::move(process.promoted_breakpoints_) },
+    breakpoint_heats_{ std::move(process.breakpoint_heats_) },
+    modules_{ std::move(process.modules_) },
+    module_breakpoints_{ std::move(process.module_breakpoints_) },
+    resolved_breakpoints_{ std::move(process.resolved_breakpoints_) } {
     process.handle_ = nullptr;
     process.id_ = 0;
 }
@@ -61,12 +76,43 @@ void Process::Resume() const {
     });
 }
 
+void Process::Suspend(std::vector<std::uint32_t>& suspended) const {
+    // Recording an ID cannot fail after its thread has been suspended.
+    suspended.reserve(suspended.size() + threads_.Size());
+    for (const auto& [id, thread] : threads_) {
+        thread.Suspend();
+        suspended.push_back(id);
+    }
+}
+
+void Process::Resume(const std::span<const std::uint32_t> suspended) const {
+    std::exception_ptr error{};
+    for (const auto id : suspended) {
+        if (const auto thread{ threads_.Find(id) }) {
+            try {
+                thread->Resume();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 OptionalThread Process::DebuggedThread() const noexcept {
     return debugged_thread_;
 }
 
 OptionalThread Process::SetDebuggedThread(const std::uint32_t id) noexcept {
-    debugged_thread_ = FindThread(id);
+    // Consecutive debug events usually come from the same thread.
+    const auto thread{ threads_.Find(id, last_thread_) };
+    debugged_thread_ =
+        thread ? OptionalThread{ *thread } : OptionalThread{ std::nullopt };
     return debugged_thread_;
 }
 
@@ -88,35 +134,48 @@ void Process::HitSystemBreakpoint() noexcept {
 
 void Process::ExecuteBreakpointCallback(const BreakpointKey key) {
     const auto callback_found{ breakpoint_callbacks_.find(key) };
-    if (callback_found != breakpoint_callbacks_.cend()) {
-        const auto [type, address]{ key };
-        switch (type) {
-            case BreakpointType::Software: {
-                const auto breakpoint_found{ software_breakpoints_.find(
-                    address) };
-                if (breakpoint_found != software_breakpoints_.cend()) {
-                    callback_found->second(breakpoint_found->second);
-                }
+    const auto breakpoint{ FindBreakpoint(key) };
+    if (callback_found == breakpoint_callbacks_.cend() || !breakpoint
+        || !callback_found->second) {
+        return;
+    }
 
-                break;
-            }
-            case BreakpointType::Hardware: {
-                const auto breakpoint_found{ hardware_breakpoints_.find(
-                    address) };
-                if (breakpoint_found != hardware_breakpoints_.cend()) {
-                    callback_found->second(breakpoint_found->second);
-                }
+    // The callback may delete its breakpoint, so it is moved out while running,
+    // and receives a copy of the breakpoint instead of the stored one.
+    auto callback{ std::move(callback_found->second) };
+    if (breakpoint->type == BreakpointType::Software) {
+        callback(SoftwareBreakpoint{
+            static_cast<const SoftwareBreakpoint&>(*breakpoint) });
+    } else {
+        callback(HardwareBreakpoint{
+            static_cast<const HardwareBreakpoint&>(*breakpoint) });
+    }
 
-                break;
-            }
-            case BreakpointType::Memory: {
-                break;
-            }
-            default: {
-                assert(false);
-            }
-        }
+    if (const auto found{ breakpoint_callbacks_.find(key) };
+        found != breakpoint_callbacks_.cend() && !found->second) {
+        found->second = std::move(callback);
+    }
+}
 
-        breakpoint_callbacks_.erase(callback_found);
+Breakpoint* Process::FindBreakpoint(const BreakpointKey breakpoint) noexcept {
+    const auto [type, address]{ breakpoint };
+    switch (type) {
+        case BreakpointType::Software: {
+            const auto found{ software_breakpoints_.find(address) };
+            return found != software_breakpoints_.end() ? &found->second
+                                                        : nullptr;
+        }
+        case BreakpointType::Hardware: {
+            const auto found{ hardware_breakpoints_.find(address) };
+            return found != hardware_breakpoints_.end() ? &found->second
+                                                        : nullptr;
+        }
+        case BreakpointType::Memory: {
+            return nullptr;
+        }
+        default: {
+            assert(false);
+            return nullptr;
+        }
     }
 }
\ No newline at end of file
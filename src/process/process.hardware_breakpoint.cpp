@@ -19,6 +19,8 @@ bool Process::DeleteHardwareBreakpoint(const std::uintptr_t address) {
 
     hardware_breakpoints_.erase(found);
     breakpoint_callbacks_.erase({ BreakpointType::Hardware, address });
+    breakpoint_conditions_.erase({ BreakpointType::Hardware, address });
+    breakpoint_threads_.erase({ BreakpointType::Hardware, address });
     hardware_breakpoint_slots_[breakpoint.slot] = nullptr;
     return true;
 }
@@ -32,10 +34,30 @@ std::optional<HardwareBreakpoint> Process::FindHardwareBreakpoint(
 }
 
 bool Process::FindFreeHardwareBreakpointSlot(
+    HardwareBreakpointSlot& slot) const noexcept {
+    if (FindIdleHardwareBreakpointSlot(slot)) {
+        return true;
+    }
+
+    // Promoted software breakpoints give their slots up to hardware breakpoints.
+    if (!promoted_breakpoints_.empty()) {
+        slot = promoted_breakpoints_.cbegin()->second;
+        return true;
+    }
+
+    return false;
+}
+
+bool Process::FindIdleHardwareBreakpointSlot(
     HardwareBreakpointSlot& slot) const noexcept {
     for (auto i{ 0 }; i != hardware_breakpoint_slot_count; ++i) {
         slot = static_cast<HardwareBreakpointSlot>(i);
-        if (!hardware_breakpoint_slots_.at(slot)) {
+        const auto found{ hardware_breakpoint_slots_.find(slot) };
+        if ((found == hardware_breakpoint_slots_.cend() || !found->second)
+            && !std::ranges::any_of(promoted_breakpoints_,
+                                    [slot](const auto& promoted) {
+                                        return promoted.second == slot;
+                                    })) {
             return true;
         }
     }
@@ -57,6 +79,14 @@ void Process::SetHardwareBreakpoint(const std::uintptr_t address,
             "A hardware breakpoint is already located at {:#010x}.", address) };
     }
 
+    for (auto promoted{ promoted_breakpoints_.begin() };
+         promoted != promoted_breakpoints_.end();) {
+        const auto [promoted_address, promoted_slot]{ *promoted++ };
+        if (promoted_address == address || promoted_slot == slot) {
+            DemoteBreakpoint(promoted_address);
+        }
+    }
+
     for (auto& [_, thread] : threads_) {
         thread.SetHardwareBreakpoint(address, slot, type, size);
     }
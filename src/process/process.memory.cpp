@@ -1,11 +1,63 @@
 #include "process.h"
 #include "error.h"
+#include "memory.h"
 
-#include <cassert>
+#include <algorithm>
+#include <array>
 #include <format>
 #include <stdexcept>
 
 
+namespace {
+
+/**
+ * @brief Read data from a memory area into a new buffer.
+ *
+ * @param process The process handle.
+ * @param address The memory address.
+ * @param data An empty buffer of the size to read.
+ * @return The buffer filled with memory data.
+ */
+template <typename Buffer>
+Buffer ReadBuffer(const HANDLE process, const std::uintptr_t address,
+                  Buffer data) {
+    std::size_t read_size{ 0 };
+    if (!ReadProcessMemory(process, reinterpret_cast<LPCVOID>(address),
+                           data.data(), data.size(),
+                           reinterpret_cast<SIZE_T*>(&read_size))) {
+        ThrowLastError();
+    }
+
+    return data;
+}
+
+/**
+ * @brief Write data to a memory area.
+ *
+ * @param process The process handle.
+ * @param address The memory address.
+ * @param data The data.
+ * @param origin An empty buffer of the data size.
+ * @return The buffer filled with original memory data.
+ */
+template <typename Buffer>
+Buffer WriteBuffer(const HANDLE process, const std::uintptr_t address,
+                   const std::span<const std::byte> data, Buffer origin) {
+    origin = ReadBuffer(process, address, std::move(origin));
+
+    std::size_t written_size{ 0 };
+    if (!WriteProcessMemory(process, reinterpret_cast<LPVOID>(address),
+                            data.data(), data.size(),
+                            reinterpret_cast<SIZE_T*>(&written_size))) {
+        ThrowLastError();
+    }
+
+    return origin;
+}
+
+}  // namespace
+
+
 bool Process::ValidMemory(const std::uintptr_t address) const noexcept {
     std::byte data{};
     std::size_t read_size{ 0 };
@@ -23,31 +75,54 @@ std::vector<std::byte> Process::WriteMemory(
 
 std::vector<std::byte> Process::WriteMemorySafe(
     const std::uintptr_t address, const std::span<const std::byte> data) const {
-    const auto end{ address + data.size() };
-    for (const auto& [_, breakpoint] : software_breakpoints_) {
-        if (breakpoint.type == BreakpointType::Software
-            && address <= breakpoint.address && breakpoint.address < end) {
-            throw std::runtime_error{ std::format(
-                "A software breakpoint {:#010x} is located in the memory "
-                "address range.",
-                breakpoint.address) };
-        }
-    }
-
+    CheckBreakpointOverlap(address, data.size());
     return WriteMemoryUnsafe(address, data);
 }
 
+std::pmr::vector<std::byte> Process::WriteMemorySafe(
+    const std::uintptr_t address, const std::span<const std::byte> data,
+    std::pmr::memory_resource& resource) const {
+    CheckBreakpointOverlap(address, data.size());
+    return WriteMemoryUnsafe(address, data, resource);
+}
+
 std::vector<std::byte> Process::WriteMemoryUnsafe(
     const std::uintptr_t address, const std::span<const std::byte> data) const {
-    std::vector<std::byte> origin{ data.size() };
-    std::size_t written_size{ 0 };
-    if (!WriteProcessMemory(handle_, reinterpret_cast<LPVOID>(address),
-                            data.data(), data.size(),
-                            reinterpret_cast<SIZE_T*>(&written_size))) {
+    return WriteBuffer(handle_, address, data,
+                       std::vector<std::byte>(data.size()));
+}
+
+std::pmr::vector<std::byte> Process::WriteMemoryUnsafe(
+    const std::uintptr_t address, const std::span<const std::byte> data,
+    std::pmr::memory_resource& resource) const {
+    return WriteBuffer(handle_, address, data,
+                       std::pmr::vector<std::byte>(data.size(), &resource));
+}
+
+void Process::CheckBreakpointOverlap(const std::uintptr_t address,
+                                     const std::size_t size) const {
+    if (const auto found{ int3_sites_.lower_bound(address) };
+        found != int3_sites_.cend() && found->first < address + size) {
+        throw std::runtime_error{ std::format(
+            "A breakpoint {:#010x} is located in the memory address range.",
+            found->first) };
+    }
+}
+
+void Process::PatchByte(const std::uintptr_t address, const std::byte value,
+                        std::byte* const original_byte) const {
+    std::size_t size{ 0 };
+    if (original_byte
+        && !ReadProcessMemory(handle_, reinterpret_cast<LPCVOID>(address),
+                              original_byte, sizeof(std::byte),
+                              reinterpret_cast<SIZE_T*>(&size))) {
         ThrowLastError();
     }
 
-    return origin;
+    if (!WriteProcessMemory(handle_, reinterpret_cast<LPVOID>(address), &value,
+                            sizeof(value), reinterpret_cast<SIZE_T*>(&size))) {
+        ThrowLastError();
+    }
 }
 
 std::vector<std::byte> Process::ReadMemory(const std::uintptr_t address,
@@ -60,30 +135,66 @@ std::vector<std::byte> Process::ReadMemory(const std::uintptr_t address,
 std::vector<std::byte> Process::ReadMemorySafe(const std::uintptr_t address,
                                                const std::size_t size) const {
     auto data{ ReadMemoryUnsafe(address, size) };
+    RestoreOriginalBytes(address, data);
+    return data;
+}
 
-    const auto end{ address + size };
-    for (const auto& [_, breakpoint] : software_breakpoints_) {
-        if (breakpoint.type == BreakpointType::Software
-            && address <= breakpoint.address && breakpoint.address < end) {
-            const auto offset{ breakpoint.address - address };
-            assert(data[offset] == int_3);
+std::pmr::vector<std::byte> Process::ReadMemorySafe(
+    const std::uintptr_t address, const std::size_t size,
+    std::pmr::memory_resource& resource) const {
+    auto data{ ReadMemoryUnsafe(address, size, resource) };
+    RestoreOriginalBytes(address, data);
+    return data;
+}
 
-            data[offset] = breakpoint.original_byte;
-        }
+bool Process::ReadMemorySafe(const std::uintptr_t address,
+                             const std::span<std::byte> buffer) const noexcept {
+    std::size_t read_size{ 0 };
+    if (!ReadProcessMemory(handle_, reinterpret_cast<LPCVOID>(address),
+                           buffer.data(), buffer.size(),
+                           reinterpret_cast<SIZE_T*>(&read_size))) {
+        return false;
     }
 
-    return data;
+    RestoreOriginalBytes(address, buffer);
+    return true;
 }
 
 std::vector<std::byte> Process::ReadMemoryUnsafe(const std::uintptr_t address,
                                                  const std::size_t size) const {
-    std::vector<std::byte> data{ size };
-    std::size_t read_size{ 0 };
-    if (!ReadProcessMemory(handle_, reinterpret_cast<LPCVOID>(address),
-                           data.data(), size,
-                           reinterpret_cast<SIZE_T*>(&read_size))) {
-        ThrowLastError();
+    return ReadBuffer(handle_, address, std::vector<std::byte>(size));
+}
+
+std::pmr::vector<std::byte> Process::ReadMemoryUnsafe(
+    const std::uintptr_t address, const std::size_t size,
+    std::pmr::memory_resource& resource) const {
+    return ReadBuffer(handle_, address,
+                      std::pmr::vector<std::byte>(size, &resource));
+}
+
+std::optional<Instruction> Process::ReadInstruction(
+    const std::uintptr_t address) const {
+    std::array<std::byte, max_instruction_length> buffer{};
+    std::span<std::byte> code{ buffer };
+    if (!ReadMemorySafe(address, code)) {
+        // The instruction may be at the end of the last readable page.
+        const auto page_end{ (address / memory_page_size + 1)
+                             * memory_page_size };
+        code = code.first(std::min(page_end - address, code.size()));
+        if (!ReadMemorySafe(address, code)) {
+            ThrowLastError();
+        }
     }
 
-    return data;
+    return DecodeInstruction(code, address);
+}
+
+void Process::RestoreOriginalBytes(
+    const std::uintptr_t address,
+    const std::span<std::byte> data) const noexcept {
+    const auto end{ address + data.size() };
+    for (auto site{ int3_sites_.lower_bound(address) };
+         site != int3_sites_.cend() && site->first < end; ++site) {
+        data[site->first - address] = site->second.original_byte;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,324 @@
+#include "process.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <utility>
+
+
+namespace {
+
+//! The maximum number of forwarders followed to resolve an export.
+constexpr std::size_t max_forwarder_depth{ 8 };
+
+//! The maximum number of characters read from a module name in a process.
+constexpr std::size_t max_image_name_length{ MAX_PATH };
+
+/**
+ * @brief Get the path of a file.
+ *
+ * @param file The file handle.
+ * @return The path, or an empty string if it fails.
+ */
+std::wstring FilePath(const HANDLE file) {
+    if (!file) {
+        return {};
+    }
+
+    std::wstring path(MAX_PATH, L'\0');
+    auto size{ GetFinalPathNameByHandleW(
+        file, path.data(), static_cast<DWORD>(path.size()),
+        FILE_NAME_NORMALIZED) };
+    // If the buffer is too small, the returned size includes the terminating null character.
+    if (size >= path.size()) {
+        path.resize(size);
+        size = GetFinalPathNameByHandleW(file, path.data(),
+                                         static_cast<DWORD>(path.size()),
+                                         FILE_NAME_NORMALIZED);
+    }
+
+    if (size == 0 || size >= path.size()) {
+        return {};
+    }
+
+    path.resize(size);
+    constexpr std::wstring_view prefix{ L"\\\\?\\" };
+    if (path.starts_with(prefix)) {
+        path.erase(0, prefix.size());
+    }
+
+    return path;
+}
+
+/**
+ * @brief Get the length of a null-terminated string in data.
+ *
+ * @param data The data.
+ * @return The number of characters, or @p std::nullopt if the string is not terminated within the data.
+ */
+template <typename Char>
+std::optional<std::size_t> StringLength(
+    const std::span<const std::byte> data) noexcept {
+    for (std::size_t i{ 0 }; i + sizeof(Char) <= data.size(); i += sizeof(Char)) {
+        Char c{};
+        std::memcpy(&c, data.data() + i, sizeof(Char));
+        if (c == 0) {
+            return i / sizeof(Char);
+        }
+    }
+
+    return std::nullopt;
+}
+
+//! Convert a module name in the ANSI code page to a wide string.
+std::wstring WidenName(const std::string_view name) {
+    if (name.empty()) {
+        return {};
+    }
+
+    std::wstring wide(name.size(), L'\0');
+    const auto size{ MultiByteToWideChar(CP_ACP, 0, name.data(),
+                                         static_cast<int>(name.size()),
+                                         wide.data(),
+                                         static_cast<int>(wide.size())) };
+    wide.resize(size > 0 ? static_cast<std::size_t>(size) : 0);
+    return wide;
+}
+
+//! Convert a module name to a narrow string, replacing non-ASCII characters.
+std::string NarrowName(const std::wstring_view name) {
+    std::string narrow(name.size(), '?');
+    for (std::size_t i{ 0 }; i != name.size(); ++i) {
+        if (name[i] < 0x80) {
+            narrow[i] = static_cast<char>(name[i]);
+        }
+    }
+
+    return narrow;
+}
+
+/**
+ * @brief Find an export by name or by an ordinal following a hash sign.
+ *
+ * @param exports The export table.
+ * @param name A name such as `CreateFileW`, or an ordinal such as `#12`.
+ */
+OptionalExport FindExport(const ExportTable& exports,
+                          const std::string_view name) noexcept {
+    if (name.starts_with('#')) {
+        std::uint32_t ordinal{ 0 };
+        const auto [end, error]{ std::from_chars(
+            name.data() + 1, name.data() + name.size(), ordinal) };
+        return error == std::errc{} && end == name.data() + name.size()
+                   ? exports.FindOrdinal(ordinal)
+                   : std::nullopt;
+    } else {
+        return exports.Find(name);
+    }
+}
+
+}  // namespace
+
+
+std::wstring Process::ModulePath(const HANDLE file,
+                                 const std::uintptr_t image_name,
+                                 const bool unicode) const {
+    if (auto path{ FilePath(file) }; !path.empty()) {
+        return path;
+    }
+
+    std::uint32_t name_address{ 0 };
+    if (image_name == 0
+        || !ReadMemorySafe(image_name,
+                           std::as_writable_bytes(std::span{ &name_address, 1 }))
+        || name_address == 0) {
+        return {};
+    }
+
+    // The name is read up to page boundaries, as the page after its end may be unreadable.
+    const auto char_size{ unicode ? sizeof(wchar_t) : sizeof(char) };
+    std::vector<std::byte> data(max_image_name_length * char_size);
+    std::size_t size{ 0 };
+    std::optional<std::size_t> length{};
+    while (!length && size != data.size()) {
+        const auto address{ name_address + size };
+        const auto chunk{ std::min(data.size() - size,
+                                   memory_page_size - address % memory_page_size) };
+        if (!ReadMemorySafe(address, std::span{ data }.subspan(size, chunk))) {
+            return {};
+        }
+
+        size += chunk;
+        const auto read{ std::span{ data }.first(size) };
+        length = unicode ? StringLength<wchar_t>(read) : StringLength<char>(read);
+    }
+
+    if (!length) {
+        return {};
+    } else if (unicode) {
+        std::wstring path(*length, L'\0');
+        std::memcpy(path.data(), data.data(), *length * sizeof(wchar_t));
+        return path;
+    } else {
+        return WidenName(
+            { reinterpret_cast<const char*>(data.data()), *length });
+    }
+}
+
+OptionalModule Process::LoadModule(const std::uintptr_t base,
+                                   std::wstring path,
+                                   std::pmr::memory_resource& resource) {
+    // Headers are read in one batch, unless the section table does not fit.
+    std::pmr::vector<std::byte> data(module_header_read_size, &resource);
+    if (!ReadMemorySafe(base, data)) {
+        return std::nullopt;
+    }
+
+    auto headers{ ParsePeHeaders(data) };
+    if (headers && headers->required_size > data.size()) {
+        data.resize(headers->required_size);
+        if (!ReadMemorySafe(base, data)) {
+            return std::nullopt;
+        }
+
+        headers = ParsePeHeaders(data);
+    }
+
+    if (!headers) {
+        return std::nullopt;
+    }
+
+    // Without a path, the module is named after its export directory, so module breakpoints can still match it.
+    if (path.empty() && headers->export_size != 0) {
+        std::pmr::vector<std::byte> directory(headers->export_size, &resource);
+        if (ReadMemorySafe(base + headers->export_offset, directory)) {
+            if (const auto name{ ParseExportName(directory,
+                                                 headers->export_offset) }) {
+                path = WidenName(*name);
+            }
+        }
+    }
+
+    const auto& module{ modules_.Insert(
+        { .base = base,
+          .size = headers->image_size,
+          .entry = headers->entry != 0 ? base + headers->entry : 0,
+          .path = std::move(path),
+          .sections = std::move(headers->sections),
+          .export_offset = headers->export_offset,
+          .export_size = headers->export_size }) };
+
+    if (const auto found{ module_breakpoints_.find(
+            LowerModuleName(module.Name())) };
+        found != module_breakpoints_.cend()) {
+        ResolveModuleBreakpoints(module, found->second);
+    }
+
+    return module;
+}
+
+bool Process::UnloadModule(const std::uintptr_t base) {
+    if (const auto found{ resolved_breakpoints_.find(base) };
+        found != resolved_breakpoints_.cend()) {
+        // Deleting breakpoints removes their addresses from the list.
+        const auto addresses{ std::move(found->second) };
+        resolved_breakpoints_.erase(found);
+        for (const auto address : addresses) {
+            const auto breakpoint{ software_breakpoints_.find(address) };
+            if (breakpoint == software_breakpoints_.end()) {
+                continue;
+            }
+
+            // The module has been unmapped, so only this breakpoint's reference to `INT3` instruction is dropped without restoring memory.
+            if (breakpoint->second.enabled
+                && !promoted_breakpoints_.contains(address)) {
+                ReleaseInt3(address, false);
+                breakpoint_heats_.erase(address);
+                breakpoint->second.enabled = false;
+            }
+
+            DeleteSoftwareBreakpoint(address);
+        }
+    }
+
+    return modules_.Erase(base);
+}
+
+const ModuleTable& Process::Modules() const noexcept {
+    return modules_;
+}
+
+const ExportTable& Process::Exports(const Module& module) const {
+    if (!module.exports) {
+        // The whole directory is read at once, including the arrays and name strings it refers to.
+        std::optional<ExportTable> exports{};
+        if (module.export_size != 0) {
+            std::vector<std::byte> data(module.export_size);
+            if (ReadMemorySafe(module.base + module.export_offset, data)) {
+                exports = ParseExportDirectory(data, module.export_offset);
+            }
+        }
+
+        module.exports = std::make_unique<const ExportTable>(
+            exports ? std::move(*exports) : ExportTable{});
+    }
+
+    return *module.exports;
+}
+
+std::optional<std::uintptr_t> Process::ResolveExport(
+    const std::wstring_view module_name, const std::string_view name) const {
+    std::wstring current_module{ module_name };
+    std::string current_name{ name };
+    for (std::size_t depth{ 0 }; depth != max_forwarder_depth; ++depth) {
+        const auto module{ modules_.FindByName(current_module) };
+        if (!module) {
+            return std::nullopt;
+        }
+
+        const auto exported{ FindExport(Exports(*module), current_name) };
+        if (!exported) {
+            return std::nullopt;
+        } else if (exported->get().forwarder.empty()) {
+            return module->get().base + exported->get().offset;
+        }
+
+        // A forwarder names a module without its extension, such as `NTDLL.RtlAllocateHeap`.
+        const std::string_view forwarder{ exported->get().forwarder };
+        const auto separator{ forwarder.rfind('.') };
+        if (separator == std::string_view::npos) {
+            return std::nullopt;
+        }
+
+        current_module.assign(forwarder.cbegin(),
+                              forwarder.cbegin() + separator);
+        current_module += L".dll";
+        current_name = forwarder.substr(separator + 1);
+    }
+
+    return std::nullopt;
+}
+
+std::string Process::AddressName(const std::uintptr_t address) const {
+    const auto location{ modules_.Locate(address) };
+    if (!location) {
+        return std::format("{:#010x}", address);
+    }
+
+    const auto& module{ *location->module };
+    const auto module_name{ NarrowName(module.Name()) };
+    const auto offset{ static_cast<std::uint32_t>(location->offset) };
+    if (const auto nearest{ Exports(module).FindNearest(offset) }) {
+        const auto& exported{ nearest->get() };
+        const auto export_name{ exported.name.empty()
+                                    ? std::format("#{}", exported.ordinal)
+                                    : exported.name };
+        return offset == exported.offset
+                   ? std::format("{}!{}", module_name, export_name)
+                   : std::format("{}!{}+{:#x}", module_name, export_name,
+                                 offset - exported.offset);
+    } else {
+        return std::format("{}+{:#x}", module_name, offset);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "process.h"
+
+#include <algorithm>
+#include <utility>
+
+
+void Process::SetModuleBreakpoint(ModuleBreakpoint breakpoint) {
+    auto& breakpoints{ module_breakpoints_[LowerModuleName(
+        breakpoint.module)] };
+    breakpoints.push_back(std::move(breakpoint));
+    if (const auto module{ modules_.FindByName(breakpoints.back().module) }) {
+        ResolveModuleBreakpoints(module->get(),
+                                 std::span{ breakpoints }.last(1));
+    }
+}
+
+bool Process::DeleteModuleBreakpoints(const std::wstring_view module) {
+    const auto found{ module_breakpoints_.find(LowerModuleName(module)) };
+    if (found == module_breakpoints_.cend()) {
+        return false;
+    }
+
+    module_breakpoints_.erase(found);
+    if (const auto loaded{ modules_.FindByName(module) }) {
+        if (const auto resolved{ resolved_breakpoints_.find(
+                loaded->get().base) };
+            resolved != resolved_breakpoints_.cend()) {
+            // Deleting breakpoints removes their addresses from the list.
+            const auto addresses{ std::move(resolved->second) };
+            resolved_breakpoints_.erase(resolved);
+            for (const auto address : addresses) {
+                DeleteSoftwareBreakpoint(address);
+            }
+        }
+    }
+
+    return true;
+}
+
+void Process::ResolveModuleBreakpoints(
+    const Module& module, const std::span<const ModuleBreakpoint> breakpoints) {
+    std::vector<std::pair<std::uintptr_t, const ModuleBreakpoint*>> resolved{};
+    resolved.reserve(breakpoints.size());
+    for (const auto& breakpoint : breakpoints) {
+        const auto address{
+            breakpoint.function.empty()
+                ? std::make_optional(module.base)
+                : ResolveExport(module.Name(), breakpoint.function)
+        };
+        if (!address) {
+            continue;
+        }
+
+        const auto target{ *address + breakpoint.offset };
+        if (!software_breakpoints_.contains(target)
+            && !hardware_breakpoints_.contains(target)) {
+            resolved.emplace_back(target, &breakpoint);
+        }
+    }
+
+    // The first module breakpoint at an address wins.
+    std::ranges::stable_sort(resolved, {}, &decltype(resolved)::value_type::first);
+    const auto [duplicate, end]{ std::ranges::unique(
+        resolved, {}, &decltype(resolved)::value_type::first) };
+    resolved.erase(duplicate, end);
+
+    std::vector<std::uintptr_t> addresses(resolved.size());
+    std::ranges::transform(resolved, addresses.begin(),
+                           &decltype(resolved)::value_type::first);
+    const auto original_bytes{ AcquireInt3s(addresses) };
+
+    auto& installed{ resolved_breakpoints_[module.base] };
+    for (std::size_t i{ 0 }; i != resolved.size(); ++i) {
+        if (!original_bytes[i]) {
+            continue;
+        }
+
+        const auto [address, breakpoint]{ resolved[i] };
+        software_breakpoints_.insert(
+            { address,
+              { address, *original_bytes[i], breakpoint->single_shoot } });
+        breakpoint_heats_.try_emplace(address);
+        if (breakpoint->callback) {
+            breakpoint_callbacks_[{ BreakpointType::Software, address }] =
+                breakpoint->callback;
+        }
+
+        installed.push_back(address);
+    }
+}
\ No newline at end of file
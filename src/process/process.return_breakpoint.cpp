@@ -0,0 +1,37 @@
+#include "process.h"
+
+
+void Process::SetReturnBreakpoint(const std::uintptr_t address) {
+    if (const auto found{ return_breakpoints_.find(address) };
+        found != return_breakpoints_.cend()) {
+        ++found->second.references;
+        return;
+    }
+
+    const auto original_byte{ AcquireInt3(address) };
+    return_breakpoints_.insert({ address, { address, original_byte } });
+}
+
+bool Process::DeleteReturnBreakpoint(const std::uintptr_t address) {
+    const auto found{ return_breakpoints_.find(address) };
+    if (found == return_breakpoints_.cend()) {
+        return false;
+    }
+
+    auto& breakpoint{ found->second };
+    if (--breakpoint.references != 0) {
+        return false;
+    }
+
+    ReleaseInt3(address);
+    return_breakpoints_.erase(found);
+    return true;
+}
+
+std::optional<ReturnBreakpoint> Process::FindReturnBreakpoint(
+    const std::uintptr_t address) const noexcept {
+    const auto found{ return_breakpoints_.find(address) };
+    return found != return_breakpoints_.cend()
+               ? std::make_optional<ReturnBreakpoint>(found->second)
+               : std::nullopt;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "process.h"
+
+#include <vector>
+
+
+namespace {
+
+//! Capture the registers of a thread, leaving the snapshot empty if it fails.
+void Capture(const HANDLE thread, const std::uint32_t context_flags,
+             ThreadSnapshot& snapshot) noexcept {
+    CONTEXT context{};
+    context.ContextFlags = context_flags;
+    if (!GetThreadContext(thread, &context)) {
+        return;
+    }
+
+    if ((context_flags & CONTEXT_INTEGER) == CONTEXT_INTEGER) {
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EAX)] =
+            context.Eax;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EBX)] =
+            context.Ebx;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::ECX)] =
+            context.Ecx;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EDX)] =
+            context.Edx;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::ESI)] =
+            context.Esi;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EDI)] =
+            context.Edi;
+    }
+
+    if ((context_flags & CONTEXT_CONTROL) == CONTEXT_CONTROL) {
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::ESP)] =
+            context.Esp;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EBP)] =
+            context.Ebp;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EIP)] =
+            context.Eip;
+        snapshot.registers[static_cast<std::size_t>(HistoryRegister::EFLAGS)] =
+            context.EFlags;
+    }
+
+    if ((context_flags & CONTEXT_DEBUG_REGISTERS) == CONTEXT_DEBUG_REGISTERS) {
+        snapshot.debug_registers = { context.Dr0, context.Dr1, context.Dr2,
+                                     context.Dr3, context.Dr6, context.Dr7 };
+    }
+
+    snapshot.context_flags = context_flags;
+}
+
+}  // namespace
+
+
+std::vector<ThreadSnapshot> Process::SnapshotAllThreads(
+    const std::uint32_t context_flags) const {
+    // Contexts are fetched serially, as starting workers for each snapshot may cost more than it saves.
+    std::vector<ThreadSnapshot> snapshots{};
+    snapshots.reserve(threads_.Size());
+    for (const auto& [id, thread] : threads_) {
+        auto& snapshot{ snapshots.emplace_back() };
+        snapshot.thread_id = id;
+        Capture(thread.Handle(), context_flags, snapshot);
+    }
+
+    return snapshots;
+}
\ No newline at end of file
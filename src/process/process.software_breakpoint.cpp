@@ -1,8 +1,10 @@
 #include "process.h"
+#include "memory.h"
 
+#include <algorithm>
 #include <format>
-#include <initializer_list>
 #include <stdexcept>
+#include <vector>
 
 
 void Process::SetSoftwareBreakpoint(const std::uintptr_t address,
@@ -16,11 +18,12 @@ void Process::SetSoftwareBreakpoint(const std::uintptr_t address,
             "A hardware breakpoint is already located at {:#010x}.", address) };
     }
 
-    std::byte original_byte{};
-    SetInt3(address, &original_byte);
-
-    software_breakpoints_.insert(
-        { address, { address, original_byte, single_shoot } });
+    if (!software_breakpoints_.contains(address)) {
+        const auto original_byte{ AcquireInt3(address) };
+        software_breakpoints_.insert(
+            { address, { address, original_byte, single_shoot } });
+        breakpoint_heats_.try_emplace(address);
+    }
 
     if (callback) {
         breakpoint_callbacks_[{ BreakpointType::Software, address }] =
@@ -31,12 +34,20 @@ void Process::SetSoftwareBreakpoint(const std::uintptr_t address,
 bool Process::DeleteSoftwareBreakpoint(const std::uintptr_t address) {
     if (const auto found{ software_breakpoints_.find(address) };
         found != software_breakpoints_.cend()) {
-        const auto& breakpoint{ found->second };
-
-        DeleteInt3(breakpoint.address, breakpoint.original_byte);
-
+        DisableBreakpoint({ BreakpointType::Software, address });
         software_breakpoints_.erase(found);
         breakpoint_callbacks_.erase({ BreakpointType::Software, address });
+        breakpoint_conditions_.erase({ BreakpointType::Software, address });
+        breakpoint_threads_.erase({ BreakpointType::Software, address });
+
+        // A module breakpoint's address is forgotten, so it is never deleted again.
+        if (const auto module{ modules_.Find(address) }) {
+            if (const auto resolved{ resolved_breakpoints_.find(
+                    module->get().base) };
+                resolved != resolved_breakpoints_.cend()) {
+                std::erase(resolved->second, address);
+            }
+        }
 
         return true;
 
@@ -55,14 +66,115 @@ std::optional<SoftwareBreakpoint> Process::FindSoftwareBreakpoint(
 
 void Process::SetInt3(const std::uintptr_t address,
                       std::byte* const original_byte) const {
-    if (original_byte) {
-        *original_byte = ReadMemoryUnsafe(address, sizeof(std::byte))[0];
-    }
-
-    WriteMemoryUnsafe(address, std::initializer_list{ int_3 });
+    PatchByte(address, int_3, original_byte);
 }
 
 void Process::DeleteInt3(const std::uintptr_t address,
                          const std::byte original_byte) const {
-    WriteMemoryUnsafe(address, std::initializer_list{ original_byte });
+    PatchByte(address, original_byte);
+}
+
+std::byte Process::AcquireInt3(const std::uintptr_t address) {
+    if (promoted_breakpoints_.contains(address)) {
+        // A shared `INT3` instruction cannot coexist with a debug register at the same address.
+        DemoteBreakpoint(address);
+    }
+
+    if (const auto found{ int3_sites_.find(address) };
+        found != int3_sites_.cend()) {
+        ++found->second.references;
+        return found->second.original_byte;
+    }
+
+    std::byte original_byte{};
+    SetInt3(address, &original_byte);
+    int3_sites_.insert({ address, { original_byte, 1 } });
+    return original_byte;
+}
+
+std::vector<std::optional<std::byte>> Process::AcquireInt3s(
+    const std::span<const std::uintptr_t> addresses) {
+    std::vector<std::optional<std::byte>> original_bytes(addresses.size());
+    std::vector<std::byte> data{};
+    for (std::size_t begin{ 0 }; begin != addresses.size();) {
+        const auto page{ addresses[begin] & ~(memory_page_size - 1) };
+        auto end{ begin + 1 };
+        while (end != addresses.size()
+               && (addresses[end] & ~(memory_page_size - 1)) == page) {
+            ++end;
+        }
+
+        // The range from the first to the last address on the page is read and written once.
+        const auto first{ addresses[begin] };
+        data.resize(addresses[end - 1] - first + 1);
+        std::size_t size{ 0 };
+        if (!ReadProcessMemory(handle_, reinterpret_cast<LPCVOID>(first),
+                               data.data(), data.size(),
+                               reinterpret_cast<SIZE_T*>(&size))) {
+            begin = end;
+            continue;
+        }
+
+        for (auto i{ begin }; i != end; ++i) {
+            auto& byte{ data[addresses[i] - first] };
+            if (const auto site{ int3_sites_.find(addresses[i]) };
+                site != int3_sites_.cend()) {
+                original_bytes[i] = site->second.original_byte;
+            } else {
+                original_bytes[i] = byte;
+                byte = int_3;
+            }
+        }
+
+        if (!WriteProcessMemory(handle_, reinterpret_cast<LPVOID>(first),
+                                data.data(), data.size(),
+                                reinterpret_cast<SIZE_T*>(&size))) {
+            std::fill(original_bytes.begin() + begin,
+                      original_bytes.begin() + end, std::nullopt);
+            begin = end;
+            continue;
+        }
+
+        for (auto i{ begin }; i != end; ++i) {
+            if (const auto [site, inserted]{ int3_sites_.try_emplace(
+                    addresses[i], Int3Site{ *original_bytes[i], 1 }) };
+                !inserted) {
+                ++site->second.references;
+            }
+        }
+
+        begin = end;
+    }
+
+    return original_bytes;
+}
+
+void Process::ReleaseInt3(const std::uintptr_t address, const bool restore) {
+    const auto found{ int3_sites_.find(address) };
+    if (found == int3_sites_.cend()) {
+        return;
+    }
+
+    auto& site{ found->second };
+    if (--site.references == 0) {
+        if (restore) {
+            DeleteInt3(address, site.original_byte);
+        }
+
+        int3_sites_.erase(found);
+    }
+}
+
+std::optional<std::byte> Process::FindInt3(
+    const std::uintptr_t address) const noexcept {
+    const auto found{ int3_sites_.find(address) };
+    return found != int3_sites_.cend()
+               ? std::make_optional(found->second.original_byte)
+               : std::nullopt;
+}
+
+void Process::RestoreInt3(const std::uintptr_t address) const {
+    if (int3_sites_.contains(address)) {
+        SetInt3(address);
+    }
 }
\ No newline at end of file
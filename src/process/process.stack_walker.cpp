@@ -0,0 +1,142 @@
+#include "stack_walker.h"
+#include "process.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+
+namespace {
+
+//! The size of a stack slot.
+constexpr std::size_t slot_size{ sizeof(std::uint32_t) };
+
+//! The number of pages in a chunk of stack memory.
+constexpr std::size_t stack_chunk_pages{ 4 };
+
+//! The maximum size of stack memory scanned for a return address between two frames.
+constexpr std::size_t max_scan_size{ 0x800 };
+
+}  // namespace
+
+
+void StackWalker::SetCodeRanges(std::vector<MemoryRange> ranges) {
+    std::ranges::sort(ranges, {}, &MemoryRange::first);
+    code_ranges_.clear();
+    for (const auto& range : ranges) {
+        if (!code_ranges_.empty()
+            && range.first <= code_ranges_.back().second) {
+            code_ranges_.back().second =
+                std::max(code_ranges_.back().second, range.second);
+        } else {
+            code_ranges_.push_back(range);
+        }
+    }
+}
+
+bool StackWalker::InCode(const std::uintptr_t address) const noexcept {
+    const auto found{ std::ranges::upper_bound(code_ranges_, address, {},
+                                               &MemoryRange::first) };
+    return found != code_ranges_.cbegin() && address < std::prev(found)->second;
+}
+
+std::size_t StackWalker::Walk(const Process& process, const std::uintptr_t eip,
+                              const std::uintptr_t esp,
+                              const std::uintptr_t ebp,
+                              const std::span<std::uintptr_t> frames) {
+    if (frames.empty()) {
+        return 0;
+    }
+
+    chunk_size_ = 0;
+    std::size_t count{ 0 };
+    frames[count++] = eip;
+
+    const auto scan{ !code_ranges_.empty() };
+    auto stack{ esp };
+    auto frame{ ebp };
+    while (count != frames.size()) {
+        // Each frame lies above the stack pointer and the previous frame, which also rules out cycles.
+        if (frame >= stack && frame % slot_size == 0) {
+            const auto next_frame{ ReadSlot(process, frame) };
+            const auto return_address{ ReadSlot(process, frame + slot_size) };
+            if (next_frame && return_address && *return_address != 0
+                && (!scan || InCode(*return_address))) {
+                frames[count++] = *return_address;
+                stack = frame + slot_size * 2;
+                frame = *next_frame;
+                continue;
+            }
+        }
+
+        if (!scan) {
+            break;
+        }
+
+        // The frame pointer has been omitted or overwritten, so look for the nearest value pointing into code.
+        const auto slot{ ScanReturnAddress(process, stack) };
+        if (!slot) {
+            break;
+        }
+
+        frames[count++] = *ReadSlot(process, *slot);
+        stack = *slot + slot_size;
+    }
+
+    return count;
+}
+
+std::size_t StackWalker::Walk(const Process& process,
+                              const ThreadSnapshot& snapshot,
+                              const std::span<std::uintptr_t> frames) {
+    const auto& registers{ snapshot.registers };
+    return Walk(process,
+                registers[static_cast<std::size_t>(HistoryRegister::EIP)],
+                registers[static_cast<std::size_t>(HistoryRegister::ESP)],
+                registers[static_cast<std::size_t>(HistoryRegister::EBP)],
+                frames);
+}
+
+std::optional<std::uint32_t> StackWalker::ReadSlot(
+    const Process& process, const std::uintptr_t address) {
+    if (address < chunk_address_
+        || address + slot_size > chunk_address_ + chunk_size_) {
+        // Chunks start at page boundaries, so an aligned slot never straddles two chunks.
+        const auto page{ address & ~(memory_page_size - 1) };
+        chunk_.resize(memory_page_size * stack_chunk_pages);
+        chunk_size_ = 0;
+        // The stack may end within a chunk, so a failed read is retried with a single page.
+        for (const auto size : { chunk_.size(), memory_page_size }) {
+            if (process.ReadMemorySafe(page, std::span{ chunk_ }.first(size))) {
+                chunk_address_ = page;
+                chunk_size_ = size;
+                break;
+            }
+        }
+
+        if (chunk_size_ == 0) {
+            return std::nullopt;
+        }
+    }
+
+    std::uint32_t value{ 0 };
+    std::memcpy(&value, chunk_.data() + (address - chunk_address_),
+                sizeof(value));
+    return value;
+}
+
+std::optional<std::uintptr_t> StackWalker::ScanReturnAddress(
+    const Process& process, std::uintptr_t address) {
+    address = (address + slot_size - 1) & ~(slot_size - 1);
+    for (auto slot{ address }; slot < address + max_scan_size;
+         slot += slot_size) {
+        const auto value{ ReadSlot(process, slot) };
+        if (!value) {
+            return std::nullopt;
+        } else if (InCode(*value)) {
+            return slot;
+        }
+    }
+
+    return std::nullopt;
+}
\ No newline at end of file
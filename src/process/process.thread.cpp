@@ -1,19 +1,60 @@
 #include "process.h"
 
 #include <utility>
+#include <vector>
 
 
 OptionalThread Process::FindThread(const std::uint32_t id) const noexcept {
-    const auto found{ threads_.find(id) };
-    return found != threads_.cend()
-               ? OptionalThread{ const_cast<Thread&>(found->second) }
-               : std::nullopt;
+    const auto found{ threads_.Find(id) };
+    return found ? OptionalThread{ *found } : std::nullopt;
 }
 
-void Process::NewThread(Thread&& thread) noexcept {
-    threads_.insert({ thread.Id(), std::move(thread) });
+void Process::NewThread(Thread&& thread) {
+    const auto id{ thread.Id() };
+    const auto [inserted, _]{ threads_.Insert(id, std::move(thread)) };
+    auto& new_thread{ *threads_.Find(inserted) };
+    for (const auto& [address, slot] : promoted_breakpoints_) {
+        const auto filter{ breakpoint_threads_.find(
+            { BreakpointType::Software, address }) };
+        if (filter == breakpoint_threads_.cend() || filter->second.Contains(id)) {
+            new_thread.SetHardwareBreakpoint(address, slot,
+                                             HardwareBreakpointType::Execute,
+                                             HardwareBreakpointSize::Byte);
+        }
+    }
 }
 
 bool Process::RemoveThread(const std::uint32_t id) noexcept {
-    return threads_.erase(id) != 0;
+    std::erase(frozen_threads_, id);
+    return threads_.Erase(id);
+}
+
+void Process::FreezeThreads(const std::uint32_t id) {
+    if (const auto thread{ threads_.Find(id) }; thread && thread->Frozen()) {
+        // A frozen thread can still report a debug event queued before it was suspended.
+        thread->Thaw();
+        std::erase(frozen_threads_, id);
+    }
+
+    // Only threads created since the last freeze need to be suspended.
+    if (threads_.Size() == frozen_threads_.size() + 1) {
+        return;
+    }
+
+    for (auto& [other_id, thread] : threads_) {
+        if (other_id != id && thread.Freeze()) {
+            frozen_threads_.push_back(other_id);
+        }
+    }
+}
+
+void Process::ThawThreads() {
+    for (const auto id : frozen_threads_) {
+        if (const auto thread{ threads_.Find(id) }) {
+            thread->Thaw();
+        }
+    }
+
+    // The buffer is kept, so later freezes do not allocate.
+    frozen_threads_.clear();
 }
\ No newline at end of file
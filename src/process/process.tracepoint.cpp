@@ -0,0 +1,44 @@
+#include "process.h"
+
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+
+void Process::SetTracepoint(Tracepoint tracepoint) {
+    const auto address{ tracepoint.address };
+    if (const auto found{ tracepoints_.find(address) };
+        found != tracepoints_.cend()) {
+        found->second = std::move(tracepoint);
+        return;
+    }
+
+    if (!ValidMemory(address)) {
+        throw std::runtime_error{ std::format(
+            "{:#010x} is not a valid memory address.", address) };
+    } else if (hardware_breakpoints_.contains(address)) {
+        throw std::runtime_error{ std::format(
+            "A hardware breakpoint is already located at {:#010x}.", address) };
+    }
+
+    AcquireInt3(address);
+    tracepoints_.insert({ address, std::move(tracepoint) });
+}
+
+bool Process::DeleteTracepoint(const std::uintptr_t address) {
+    if (const auto found{ tracepoints_.find(address) };
+        found != tracepoints_.cend()) {
+        ReleaseInt3(address);
+        tracepoints_.erase(found);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+OptionalTracepoint Process::FindTracepoint(
+    const std::uintptr_t address) const noexcept {
+    const auto found{ tracepoints_.find(address) };
+    return found != tracepoints_.cend() ? OptionalTracepoint{ found->second }
+                                        : std::nullopt;
+}
\ No newline at end of file
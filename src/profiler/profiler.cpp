@@ -0,0 +1,128 @@
+#include "profiler.h"
+
+#include <algorithm>
+
+
+namespace {
+
+//! The lowest overhead budget, which limits how far the interval can be stretched.
+constexpr double min_overhead_budget{ 0.001 };
+
+}  // namespace
+
+
+Profiler::Profiler(const std::uint32_t process_id,
+                   const ProfileOptions& options) :
+    process_id_{ process_id },
+    options_{ options },
+    start_time_{ std::chrono::system_clock::now() },
+    start_{ std::chrono::steady_clock::now() },
+    next_sample_{ start_ } {
+    walker_.SetCodeRanges(options.code_ranges);
+}
+
+std::uint32_t Profiler::ProcessId() const noexcept {
+    return process_id_;
+}
+
+bool Profiler::Active() const noexcept {
+    return active_;
+}
+
+void Profiler::Stop() noexcept {
+    if (active_) {
+        active_ = false;
+        stop_ = std::chrono::steady_clock::now();
+    }
+}
+
+bool Profiler::Due() const noexcept {
+    return active_ && std::chrono::steady_clock::now() >= next_sample_;
+}
+
+std::chrono::milliseconds Profiler::Delay() const noexcept {
+    const auto now{ std::chrono::steady_clock::now() };
+    return now < next_sample_ ? std::chrono::ceil<std::chrono::milliseconds>(
+               next_sample_ - now)
+                              : std::chrono::milliseconds::zero();
+}
+
+void Profiler::Sample(const Process& process) {
+    frames_.clear();
+    stack_ends_.clear();
+
+    const auto begin{ std::chrono::steady_clock::now() };
+    suspended_threads_.clear();
+    try {
+        process.Suspend(suspended_threads_);
+        for (const auto& snapshot :
+             process.SnapshotAllThreads(CONTEXT_CONTROL)) {
+            if (snapshot.context_flags != 0) {
+                const auto stack_begin{ frames_.size() };
+                frames_.resize(stack_begin + options_.max_depth);
+                const auto count{ walker_.Walk(
+                    process, snapshot,
+                    std::span{ frames_ }.subspan(stack_begin)) };
+                frames_.resize(stack_begin + count);
+                stack_ends_.push_back(frames_.size());
+            }
+        }
+    } catch (...) {
+        // Only suspended threads are resumed, and a failure to resume them does not hide the error.
+        try {
+            process.Resume(suspended_threads_);
+        } catch (...) {
+        }
+
+        throw;
+    }
+
+    process.Resume(suspended_threads_);
+    const auto end{ std::chrono::steady_clock::now() };
+
+    const auto cost{ end - begin };
+    suspended_ += cost;
+    ++sample_count_;
+
+    // Stretch the interval so the suspended fraction of each period stays within the budget.
+    const auto budget{ std::clamp(options_.overhead_budget,
+                                  min_overhead_budget, 1.0) };
+    const auto min_interval{
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            cost * ((1 - budget) / budget))
+    };
+    next_sample_ =
+        end
+        + std::max<std::chrono::steady_clock::duration>(options_.interval,
+                                                         min_interval);
+
+    std::size_t stack_begin{ 0 };
+    for (const auto stack_end : stack_ends_) {
+        stacks_.Insert(std::span{ frames_ }.subspan(stack_begin,
+                                                    stack_end - stack_begin));
+        stack_begin = stack_end;
+    }
+}
+
+std::uint64_t Profiler::SampleCount() const noexcept {
+    return sample_count_;
+}
+
+std::chrono::nanoseconds Profiler::SuspendedTime() const noexcept {
+    return suspended_;
+}
+
+std::chrono::nanoseconds Profiler::Elapsed() const noexcept {
+    return (active_ ? std::chrono::steady_clock::now() : stop_) - start_;
+}
+
+double Profiler::Overhead() const noexcept {
+    const auto elapsed{ Elapsed() };
+    return elapsed.count() != 0 ? static_cast<double>(suspended_.count())
+                                      / static_cast<double>(elapsed.count())
+                                : 0;
+}
+
+const StackTrie& Profiler::Stacks() const noexcept {
+    return stacks_;
+}
\ No newline at end of file
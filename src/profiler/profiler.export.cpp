@@ -0,0 +1,215 @@
+#include "profiler.h"
+#include "trace.h"
+
+#include <format>
+#include <string_view>
+
+
+namespace {
+
+//! Wire types of protocol buffer fields.
+enum class WireType : std::uint8_t { Varint = 0, LengthDelimited = 2 };
+
+//! Fields of @p perftools.profiles.Profile.
+namespace profile_fields {
+
+inline constexpr std::uint32_t sample_type{ 1 };
+inline constexpr std::uint32_t sample{ 2 };
+inline constexpr std::uint32_t location{ 4 };
+inline constexpr std::uint32_t string_table{ 6 };
+inline constexpr std::uint32_t time_nanos{ 9 };
+inline constexpr std::uint32_t duration_nanos{ 10 };
+inline constexpr std::uint32_t period_type{ 11 };
+inline constexpr std::uint32_t period{ 12 };
+
+}  // namespace profile_fields
+
+//! Fields of @p perftools.profiles.ValueType.
+namespace value_type_fields {
+
+inline constexpr std::uint32_t type{ 1 };
+inline constexpr std::uint32_t unit{ 2 };
+
+}  // namespace value_type_fields
+
+//! Fields of @p perftools.profiles.Sample.
+namespace sample_fields {
+
+inline constexpr std::uint32_t location_id{ 1 };
+inline constexpr std::uint32_t value{ 2 };
+
+}  // namespace sample_fields
+
+//! Fields of @p perftools.profiles.Location.
+namespace location_fields {
+
+inline constexpr std::uint32_t id{ 1 };
+inline constexpr std::uint32_t address{ 3 };
+
+}  // namespace location_fields
+
+//! Strings of a profile, the first one must be empty.
+constexpr std::array<std::string_view, 5> profile_strings{
+    "", "samples", "count", "wall", "nanoseconds"
+};
+
+//! Indexes of @p profile_strings.
+enum class ProfileString : std::uint8_t {
+    Empty,
+    Samples,
+    Count,
+    Wall,
+    Nanoseconds
+};
+
+//! A protocol buffer encoder.
+class ProtoWriter {
+public:
+    //! Append a varint without a tag, such as an element of a packed field.
+    void Varint(const std::uint64_t value) {
+        std::array<std::byte, max_varint_size> buffer{};
+        const auto size{ EncodeVarint(value, buffer.data()) };
+        data_.insert(data_.cend(), buffer.cbegin(), buffer.cbegin() + size);
+    }
+
+    void Uint64(const std::uint32_t field, const std::uint64_t value) {
+        Tag(field, WireType::Varint);
+        Varint(value);
+    }
+
+    void Bytes(const std::uint32_t field,
+               const std::span<const std::byte> value) {
+        Tag(field, WireType::LengthDelimited);
+        Varint(value.size());
+        data_.insert(data_.cend(), value.begin(), value.end());
+    }
+
+    void String(const std::uint32_t field, const std::string_view value) {
+        Bytes(field, std::as_bytes(std::span{ value }));
+    }
+
+    //! Append an embedded message or a packed field.
+    void Message(const std::uint32_t field, const ProtoWriter& message) {
+        Bytes(field, message.Data());
+    }
+
+    std::span<const std::byte> Data() const noexcept {
+        return data_;
+    }
+
+    std::vector<std::byte> Release() noexcept {
+        return std::move(data_);
+    }
+
+    void Clear() noexcept {
+        data_.clear();
+    }
+
+private:
+    void Tag(const std::uint32_t field, const WireType type) {
+        Varint((static_cast<std::uint64_t>(field) << 3)
+               | static_cast<std::uint64_t>(type));
+    }
+
+    std::vector<std::byte> data_{};
+};
+
+//! Encode a @p perftools.profiles.ValueType.
+ProtoWriter ValueType(const ProfileString type, const ProfileString unit) {
+    ProtoWriter message{};
+    message.Uint64(value_type_fields::type, static_cast<std::uint64_t>(type));
+    message.Uint64(value_type_fields::unit, static_cast<std::uint64_t>(unit));
+    return message;
+}
+
+}  // namespace
+
+
+std::string Profiler::FoldedStacks(const Symbolizer& symbolize) const {
+    const auto name{ [&symbolize](const std::uintptr_t address) {
+        return symbolize ? symbolize(address)
+                         : std::format("{:#010x}", address);
+    } };
+
+    std::string folded{};
+    const auto nodes{ stacks_.Nodes() };
+    for (std::uint32_t node{ StackTrie::root + 1 }; node < nodes.size();
+         ++node) {
+        if (nodes[node].count == 0) {
+            continue;
+        }
+
+        const auto stack{ stacks_.Stack(node) };
+        for (auto frame{ stack.crbegin() }; frame != stack.crend(); ++frame) {
+            if (frame != stack.crbegin()) {
+                folded.push_back(';');
+            }
+
+            folded += name(*frame);
+        }
+
+        folded += std::format(" {}\n", nodes[node].count);
+    }
+
+    return folded;
+}
+
+std::vector<std::byte> Profiler::Pprof() const {
+    ProtoWriter profile{};
+    profile.Message(profile_fields::sample_type,
+                    ValueType(ProfileString::Samples, ProfileString::Count));
+
+    // Each distinct address becomes a location, numbered from one.
+    const auto nodes{ stacks_.Nodes() };
+    std::unordered_map<std::uintptr_t, std::uint64_t> locations{};
+    for (std::uint32_t node{ StackTrie::root + 1 }; node < nodes.size();
+         ++node) {
+        locations.try_emplace(nodes[node].address, locations.size() + 1);
+    }
+
+    ProtoWriter message{};
+    ProtoWriter packed{};
+    for (std::uint32_t node{ StackTrie::root + 1 }; node < nodes.size();
+         ++node) {
+        if (nodes[node].count == 0) {
+            continue;
+        }
+
+        message.Clear();
+        packed.Clear();
+        for (auto frame{ node }; frame != StackTrie::root;
+             frame = nodes[frame].parent) {
+            packed.Varint(locations.at(nodes[frame].address));
+        }
+
+        message.Message(sample_fields::location_id, packed);
+        packed.Clear();
+        packed.Varint(nodes[node].count);
+        message.Message(sample_fields::value, packed);
+        profile.Message(profile_fields::sample, message);
+    }
+
+    for (const auto [address, id] : locations) {
+        message.Clear();
+        message.Uint64(location_fields::id, id);
+        message.Uint64(location_fields::address, address);
+        profile.Message(profile_fields::location, message);
+    }
+
+    for (const auto string : profile_strings) {
+        profile.String(profile_fields::string_table, string);
+    }
+
+    profile.Uint64(profile_fields::time_nanos,
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       start_time_.time_since_epoch())
+                       .count());
+    profile.Uint64(profile_fields::duration_nanos, Elapsed().count());
+    profile.Message(profile_fields::period_type,
+                    ValueType(ProfileString::Wall, ProfileString::Nanoseconds));
+    profile.Uint64(profile_fields::period,
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       options_.interval)
+                       .count());
+    return profile.Release();
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "profiler.h"
+
+
+std::size_t StackTrie::ChildKeyHash::operator()(
+    const ChildKey& key) const noexcept {
+    return std::hash<std::uint64_t>{}(
+        (static_cast<std::uint64_t>(key.parent) << 32)
+        ^ static_cast<std::uint64_t>(key.address));
+}
+
+StackTrie::StackTrie() : nodes_{ { 0, root, 0 } } {}
+
+std::uint32_t StackTrie::Insert(const std::span<const std::uintptr_t> frames,
+                                const std::uint64_t count) {
+    auto node{ root };
+    for (auto frame{ frames.rbegin() }; frame != frames.rend(); ++frame) {
+        const auto [child, inserted]{ children_.try_emplace(
+            ChildKey{ node, *frame },
+            static_cast<std::uint32_t>(nodes_.size())) };
+        if (inserted) {
+            nodes_.push_back({ *frame, node, 0 });
+        }
+
+        node = child->second;
+    }
+
+    nodes_[node].count += count;
+    total_ += count;
+    return node;
+}
+
+std::span<const StackTrie::Node> StackTrie::Nodes() const noexcept {
+    return nodes_;
+}
+
+std::vector<std::uintptr_t> StackTrie::Stack(std::uint32_t node) const {
+    std::vector<std::uintptr_t> stack{};
+    while (node != root) {
+        stack.push_back(nodes_[node].address);
+        node = nodes_[node].parent;
+    }
+
+    return stack;
+}
+
+std::uint64_t StackTrie::Total() const noexcept {
+    return total_;
+}
+
+void StackTrie::Clear() noexcept {
+    nodes_.resize(1);
+    nodes_[root].count = 0;
+    children_.clear();
+    total_ = 0;
+}
\ No newline at end of file
@@ -7,183 +7,142 @@
 DebugControlRegister::DebugControlRegister(Registers& registers) noexcept :
     Register{ registers, RegisterIndex::DR7 } {}
 
-void DebugControlRegister::SetL0() noexcept {
-    SetL0(true);
+void DebugControlRegister::SetL0() {
+    SetField(debug_control_fields::L(0), 1);
 }
 
-void DebugControlRegister::SetL1() noexcept {
-    SetL1(true);
+void DebugControlRegister::SetL1() {
+    SetField(debug_control_fields::L(1), 1);
 }
 
-void DebugControlRegister::SetL2() noexcept {
-    SetL2(true);
+void DebugControlRegister::SetL2() {
+    SetField(debug_control_fields::L(2), 1);
 }
 
-void DebugControlRegister::SetL3() noexcept {
-    SetL3(true);
+void DebugControlRegister::SetL3() {
+    SetField(debug_control_fields::L(3), 1);
 }
 
-void DebugControlRegister::ResetL0() noexcept {
-    SetL0(false);
+void DebugControlRegister::ResetL0() {
+    SetField(debug_control_fields::L(0), 0);
 }
 
-void DebugControlRegister::ResetL1() noexcept {
-    SetL1(false);
+void DebugControlRegister::ResetL1() {
+    SetField(debug_control_fields::L(1), 0);
 }
 
-void DebugControlRegister::ResetL2() noexcept {
-    SetL2(false);
+void DebugControlRegister::ResetL2() {
+    SetField(debug_control_fields::L(2), 0);
 }
 
-void DebugControlRegister::ResetL3() noexcept {
-    SetL3(false);
+void DebugControlRegister::ResetL3() {
+    SetField(debug_control_fields::L(3), 0);
 }
 
 
-bool DebugControlRegister::L0() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).L0;
+bool DebugControlRegister::L0() const {
+    return GetField(debug_control_fields::L(0)) != 0;
 }
 
-bool DebugControlRegister::L1() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).L1;
+bool DebugControlRegister::L1() const {
+    return GetField(debug_control_fields::L(1)) != 0;
 }
 
-bool DebugControlRegister::L2() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).L2;
+bool DebugControlRegister::L2() const {
+    return GetField(debug_control_fields::L(2)) != 0;
 }
 
-bool DebugControlRegister::L3() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).L3;
+bool DebugControlRegister::L3() const {
+    return GetField(debug_control_fields::L(3)) != 0;
 }
 
-void DebugControlRegister::SetRW0(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0B11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).RW0 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetRW0(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::RW(0), value);
 }
 
-void DebugControlRegister::SetRW1(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0B11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).RW1 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetRW1(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::RW(1), value);
 }
 
-void DebugControlRegister::SetRW2(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0B11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).RW2 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetRW2(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::RW(2), value);
 }
 
-void DebugControlRegister::SetRW3(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0B11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).RW3 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetRW3(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::RW(3), value);
 }
 
-std::uintptr_t DebugControlRegister::RW0() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).RW0;
+std::uintptr_t DebugControlRegister::RW0() const {
+    return GetField(debug_control_fields::RW(0));
 }
 
-std::uintptr_t DebugControlRegister::RW1() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).RW1;
+std::uintptr_t DebugControlRegister::RW1() const {
+    return GetField(debug_control_fields::RW(1));
 }
 
-std::uintptr_t DebugControlRegister::RW2() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).RW2;
+std::uintptr_t DebugControlRegister::RW2() const {
+    return GetField(debug_control_fields::RW(2));
 }
 
-std::uintptr_t DebugControlRegister::RW3() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).RW3;
+std::uintptr_t DebugControlRegister::RW3() const {
+    return GetField(debug_control_fields::RW(3));
 }
 
-void DebugControlRegister::SetLEN0(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0b11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).LEN0 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetLEN0(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::LEN(0), value);
 }
 
-void DebugControlRegister::SetLEN1(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0b11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).LEN1 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetLEN1(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::LEN(1), value);
 }
 
-void DebugControlRegister::SetLEN2(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0b11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).LEN2 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetLEN2(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::LEN(2), value);
 }
 
-void DebugControlRegister::SetLEN3(const std::uintptr_t value) noexcept {
-    assert(0 <= value && value <= 0b11);
-
-    auto reg_value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(reg_value).LEN3 = value;
-    registers_.Set(index_, reg_value);
+void DebugControlRegister::SetLEN3(const std::uintptr_t value) {
+    assert(value <= 0B11);
+    SetField(debug_control_fields::LEN(3), value);
 }
 
-std::uintptr_t DebugControlRegister::LEN0() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).LEN0;
+std::uintptr_t DebugControlRegister::LEN0() const {
+    return GetField(debug_control_fields::LEN(0));
 }
 
-std::uintptr_t DebugControlRegister::LEN1() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).LEN1;
+std::uintptr_t DebugControlRegister::LEN1() const {
+    return GetField(debug_control_fields::LEN(1));
 }
 
-std::uintptr_t DebugControlRegister::LEN2() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).LEN2;
+std::uintptr_t DebugControlRegister::LEN2() const {
+    return GetField(debug_control_fields::LEN(2));
 }
 
-std::uintptr_t DebugControlRegister::LEN3() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR7&>(value).LEN3;
+std::uintptr_t DebugControlRegister::LEN3() const {
+    return GetField(debug_control_fields::LEN(3));
 }
 
-void DebugControlRegister::SetL0(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(value).L0 = set;
-    registers_.Set(index_, value);
-}
-
-void DebugControlRegister::SetL1(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(value).L1 = set;
-    registers_.Set(index_, value);
-}
+void DebugControlRegister::SetSlot(const std::size_t slot,
+                                   const std::uintptr_t type,
+                                   const std::uintptr_t size) {
+    assert(slot < debug_address_register_count);
+    assert(type <= 0B11 && size <= 0B11);
 
-void DebugControlRegister::SetL2(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(value).L2 = set;
-    registers_.Set(index_, value);
+    using namespace debug_control_fields;
+    auto value{ Get() };
+    value = L(slot).Encode(value, 1);
+    value = RW(slot).Encode(value, type);
+    value = LEN(slot).Encode(value, size);
+    Set(value);
 }
 
-void DebugControlRegister::SetL3(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR7&>(value).L3 = set;
-    registers_.Set(index_, value);
+void DebugControlRegister::ResetSlot(const std::size_t slot) {
+    assert(slot < debug_address_register_count);
+    SetField(debug_control_fields::L(slot), 0);
 }
\ No newline at end of file
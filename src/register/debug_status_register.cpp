@@ -1,82 +1,61 @@
 #include "register.h"
 #include "registers.h"
 
+#include <cassert>
+
 
 DebugStatusRegister::DebugStatusRegister(Registers& registers) noexcept :
     Register{ registers, RegisterIndex::DR6 } {}
 
-void DebugStatusRegister::SetB0() noexcept {
-    SetB0(true);
-}
-
-void DebugStatusRegister::SetB1() noexcept {
-    SetB1(true);
-}
-
-void DebugStatusRegister::SetB2() noexcept {
-    SetB2(true);
-}
-
-void DebugStatusRegister::SetB3() noexcept {
-    SetB3(true);
+void DebugStatusRegister::SetB0() {
+    SetField(debug_status_fields::B(0), 1);
 }
 
-void DebugStatusRegister::ResetB0() noexcept {
-    SetB0(false);
+void DebugStatusRegister::SetB1() {
+    SetField(debug_status_fields::B(1), 1);
 }
 
-void DebugStatusRegister::ResetB1() noexcept {
-    SetB1(false);
+void DebugStatusRegister::SetB2() {
+    SetField(debug_status_fields::B(2), 1);
 }
 
-void DebugStatusRegister::ResetB2() noexcept {
-    SetB2(false);
+void DebugStatusRegister::SetB3() {
+    SetField(debug_status_fields::B(3), 1);
 }
 
-void DebugStatusRegister::ResetB3() noexcept {
-    SetB3(false);
+void DebugStatusRegister::ResetB0() {
+    SetField(debug_status_fields::B(0), 0);
 }
 
-bool DebugStatusRegister::B0() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR6&>(value).B0;
+void DebugStatusRegister::ResetB1() {
+    SetField(debug_status_fields::B(1), 0);
 }
 
-bool DebugStatusRegister::B1() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR6&>(value).B1;
+void DebugStatusRegister::ResetB2() {
+    SetField(debug_status_fields::B(2), 0);
 }
 
-bool DebugStatusRegister::B2() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR6&>(value).B2;
+void DebugStatusRegister::ResetB3() {
+    SetField(debug_status_fields::B(3), 0);
 }
 
-bool DebugStatusRegister::B3() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const DR6&>(value).B3;
+bool DebugStatusRegister::B0() const {
+    return B(0);
 }
 
-void DebugStatusRegister::SetB0(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR6&>(value).B0 = set;
-    registers_.Set(index_, value);
+bool DebugStatusRegister::B1() const {
+    return B(1);
 }
 
-void DebugStatusRegister::SetB1(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR6&>(value).B1 = set;
-    registers_.Set(index_, value);
+bool DebugStatusRegister::B2() const {
+    return B(2);
 }
 
-void DebugStatusRegister::SetB2(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR6&>(value).B2 = set;
-    registers_.Set(index_, value);
+bool DebugStatusRegister::B3() const {
+    return B(3);
 }
 
-void DebugStatusRegister::SetB3(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<DR6&>(value).B3 = set;
-    registers_.Set(index_, value);
+bool DebugStatusRegister::B(const std::size_t slot) const {
+    assert(slot < debug_address_register_count);
+    return GetField(debug_status_fields::B(slot)) != 0;
 }
\ No newline at end of file
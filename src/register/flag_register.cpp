@@ -1,225 +1,138 @@
 #include "register.h"
 #include "registers.h"
 
-#include <cassert>
-#include <functional>
-#include <unordered_map>
-
 
 FlagRegister::FlagRegister(Registers& registers_) noexcept :
     Register{ registers_, RegisterIndex::EFLAGS } {}
 
-void FlagRegister::SetCF() noexcept {
-    SetCF(true);
-}
-
-void FlagRegister::SetPF() noexcept {
-    SetPF(true);
-}
-
-void FlagRegister::SetAF() noexcept {
-    SetAF(true);
+void FlagRegister::SetCF() {
+    Set(Flag::CF);
 }
 
-void FlagRegister::SetZF() noexcept {
-    SetZF(true);
+void FlagRegister::SetPF() {
+    Set(Flag::PF);
 }
 
-void FlagRegister::SetSF() noexcept {
-    SetSF(true);
+void FlagRegister::SetAF() {
+    Set(Flag::AF);
 }
 
-void FlagRegister::SetTF() noexcept {
-    SetTF(true);
+void FlagRegister::SetZF() {
+    Set(Flag::ZF);
 }
 
-void FlagRegister::SetIF() noexcept {
-    SetIF(true);
+void FlagRegister::SetSF() {
+    Set(Flag::SF);
 }
 
-void FlagRegister::SetDF() noexcept {
-    SetDF(true);
+void FlagRegister::SetTF() {
+    Set(Flag::TF);
 }
 
-void FlagRegister::SetOF() noexcept {
-    SetOF(true);
+void FlagRegister::SetIF() {
+    Set(Flag::IF);
 }
 
-void FlagRegister::ResetCF() noexcept {
-    SetCF(false);
+void FlagRegister::SetDF() {
+    Set(Flag::DF);
 }
 
-void FlagRegister::ResetPF() noexcept {
-    SetPF(false);
+void FlagRegister::SetOF() {
+    Set(Flag::OF);
 }
 
-void FlagRegister::ResetAF() noexcept {
-    SetAF(false);
+void FlagRegister::SetRF() {
+    Set(Flag::RF);
 }
 
-void FlagRegister::ResetZF() noexcept {
-    SetZF(false);
+void FlagRegister::ResetCF() {
+    Reset(Flag::CF);
 }
 
-void FlagRegister::ResetSF() noexcept {
-    SetSF(false);
+void FlagRegister::ResetPF() {
+    Reset(Flag::PF);
 }
 
-void FlagRegister::ResetTF() noexcept {
-    SetTF(false);
+void FlagRegister::ResetAF() {
+    Reset(Flag::AF);
 }
 
-void FlagRegister::ResetIF() noexcept {
-    SetIF(false);
+void FlagRegister::ResetZF() {
+    Reset(Flag::ZF);
 }
 
-void FlagRegister::ResetDF() noexcept {
-    SetDF(false);
+void FlagRegister::ResetSF() {
+    Reset(Flag::SF);
 }
 
-void FlagRegister::ResetOF() noexcept {
-    SetOF(false);
+void FlagRegister::ResetTF() {
+    Reset(Flag::TF);
 }
 
-bool FlagRegister::CF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).CF;
+void FlagRegister::ResetIF() {
+    Reset(Flag::IF);
 }
 
-bool FlagRegister::PF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).PF;
+void FlagRegister::ResetDF() {
+    Reset(Flag::DF);
 }
 
-bool FlagRegister::AF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).AF;
+void FlagRegister::ResetOF() {
+    Reset(Flag::OF);
 }
 
-bool FlagRegister::ZF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).ZF;
+void FlagRegister::ResetRF() {
+    Reset(Flag::RF);
 }
 
-bool FlagRegister::SF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).SF;
+bool FlagRegister::CF() const {
+    return Get(Flag::CF);
 }
 
-bool FlagRegister::TF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).TF;
+bool FlagRegister::PF() const {
+    return Get(Flag::PF);
 }
 
-bool FlagRegister::IF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).IF;
+bool FlagRegister::AF() const {
+    return Get(Flag::AF);
 }
 
-bool FlagRegister::DF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).DF;
+bool FlagRegister::ZF() const {
+    return Get(Flag::ZF);
 }
 
-bool FlagRegister::OF() const noexcept {
-    const auto value{ registers_.Get(index_) };
-    return reinterpret_cast<const Flags&>(value).OF;
+bool FlagRegister::SF() const {
+    return Get(Flag::SF);
 }
 
-void FlagRegister::SetCF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).CF = set;
-    registers_.Set(index_, value);
+bool FlagRegister::TF() const {
+    return Get(Flag::TF);
 }
 
-void FlagRegister::SetPF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).PF = set;
-    registers_.Set(index_, value);
+bool FlagRegister::IF() const {
+    return Get(Flag::IF);
 }
 
-void FlagRegister::SetAF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).AF = set;
-    registers_.Set(index_, value);
+bool FlagRegister::DF() const {
+    return Get(Flag::DF);
 }
 
-void FlagRegister::SetZF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).ZF = set;
-    registers_.Set(index_, value);
+bool FlagRegister::OF() const {
+    return Get(Flag::OF);
 }
 
-void FlagRegister::SetSF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).SF = set;
-    registers_.Set(index_, value);
+bool FlagRegister::RF() const {
+    return Get(Flag::RF);
 }
 
-void FlagRegister::SetTF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).TF = set;
-    registers_.Set(index_, value);
+void FlagRegister::Set(const Flag flag) {
+    SetField(FlagField(flag), 1);
 }
 
-void FlagRegister::SetIF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).IF = set;
-    registers_.Set(index_, value);
+void FlagRegister::Reset(const Flag flag) {
+    SetField(FlagField(flag), 0);
 }
 
-void FlagRegister::SetDF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).DF = set;
-    registers_.Set(index_, value);
-}
-
-void FlagRegister::SetOF(const bool set) noexcept {
-    auto value{ registers_.Get(index_) };
-    reinterpret_cast<Flags&>(value).OF = set;
-    registers_.Set(index_, value);
-}
-
-void FlagRegister::Set(const Flag flag) noexcept {
-    Set(flag, true);
-}
-
-void FlagRegister::Reset(const Flag flag) noexcept {
-    Set(flag, false);
-}
-
-void FlagRegister::Set(const Flag flag, const bool set) noexcept {
-    static const std::unordered_map<Flag, std::function<void(FlagRegister&, bool)>> handlers{
-        { Flag::AF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetAF) },
-        { Flag::CF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetCF) },
-        { Flag::DF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetDF) },
-        { Flag::IF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetIF) },
-        { Flag::OF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetOF) },
-        { Flag::SF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetSF) },
-        { Flag::PF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetPF) },
-        { Flag::TF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetTF) },
-        { Flag::ZF, static_cast<void (FlagRegister::*)(bool)>(&FlagRegister::SetZF) }
-    };
-
-    assert(handlers.contains(flag));
-
-    return handlers.at(flag)(*this, set);
-}
-
-bool FlagRegister::Get(const Flag flag) const noexcept {
-    static const std::unordered_map<Flag, std::function<bool(const FlagRegister&)>> handlers{
-        { Flag::AF, &FlagRegister::AF },
-        { Flag::CF, &FlagRegister::CF },
-        { Flag::DF, &FlagRegister::DF },
-        { Flag::IF, &FlagRegister::IF },
-        { Flag::OF, &FlagRegister::OF },
-        { Flag::SF, &FlagRegister::SF },
-        { Flag::PF, &FlagRegister::PF },
-        { Flag::TF, &FlagRegister::TF },
-        { Flag::ZF, &FlagRegister::ZF }
-    };
-
-    assert(handlers.contains(flag));
-
-    return handlers.at(flag)(*this);
+bool FlagRegister::Get(const Flag flag) const {
+    return GetField(FlagField(flag)) != 0;
 }
\ No newline at end of file
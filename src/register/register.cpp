@@ -6,59 +6,68 @@ Register::Register(Registers& registers, const RegisterIndex index) noexcept :
     registers_{ registers }, index_{ index } {}
 
 
-Register& Register::operator=(const std::uintptr_t value) noexcept {
+Register& Register::operator=(const std::uintptr_t value) {
     Set(value);
     return *this;
 }
 
-Register& Register::operator++() noexcept {
+Register& Register::operator++() {
     this->operator+=(1);
     return *this;
 }
 
-Register Register::operator++(int) noexcept {
+Register Register::operator++(int) {
     const Register ret{ *this };
     this->operator+=(1);
     return ret;
 }
 
-Register& Register::operator--() noexcept {
+Register& Register::operator--() {
     this->operator-=(1);
     return *this;
 }
 
-Register Register::operator--(int) noexcept {
+Register Register::operator--(int) {
     const Register ret{ *this };
     this->operator-=(1);
     return ret;
 }
 
-Register& Register::operator+=(const std::uintptr_t value) noexcept {
+Register& Register::operator+=(const std::uintptr_t value) {
     registers_.Set(index_, registers_.Get(index_) + value);
     return *this;
 }
 
-Register& Register::operator-=(const std::uintptr_t value) noexcept {
+Register& Register::operator-=(const std::uintptr_t value) {
     registers_.Set(index_, registers_.Get(index_) - value);
     return *this;
 }
 
-bool operator==(const Register& register1, const Register& register2) noexcept {
+bool operator==(const Register& register1, const Register& register2) {
     return register1.Get() == register2.Get();
 }
 
-bool operator!=(const Register& register1, const Register& register2) noexcept {
+bool operator!=(const Register& register1, const Register& register2) {
     return !(register1 == register2);
 }
 
-void Register::Set(const std::uintptr_t value) noexcept {
+void Register::Set(const std::uintptr_t value) {
     registers_.Set(index_, value);
 }
 
-void Register::Reset() noexcept {
+void Register::Reset() {
     Set(0);
 }
 
-std::uintptr_t Register::Get() const noexcept {
+std::uintptr_t Register::Get() const {
     return registers_.Get(index_);
+}
+
+std::uintptr_t Register::GetField(const RegisterField field) const {
+    return field.Decode(Get());
+}
+
+void Register::SetField(const RegisterField field,
+                        const std::uintptr_t value) {
+    Set(field.Encode(Get(), value));
 }
\ No newline at end of file
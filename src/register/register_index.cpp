@@ -0,0 +1,39 @@
+#include "register.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <utility>
+
+
+std::optional<RegisterIndex> ParseRegisterIndex(
+    const std::string_view name) noexcept {
+    static constexpr std::array<std::pair<std::string_view, RegisterIndex>, 16>
+        names{ { { "eax", RegisterIndex::EAX },
+                 { "ebx", RegisterIndex::EBX },
+                 { "ecx", RegisterIndex::ECX },
+                 { "edx", RegisterIndex::EDX },
+                 { "esp", RegisterIndex::ESP },
+                 { "ebp", RegisterIndex::EBP },
+                 { "esi", RegisterIndex::ESI },
+                 { "edi", RegisterIndex::EDI },
+                 { "eip", RegisterIndex::EIP },
+                 { "dr0", RegisterIndex::DR0 },
+                 { "dr1", RegisterIndex::DR1 },
+                 { "dr2", RegisterIndex::DR2 },
+                 { "dr3", RegisterIndex::DR3 },
+                 { "dr6", RegisterIndex::DR6 },
+                 { "dr7", RegisterIndex::DR7 },
+                 { "eflags", RegisterIndex::EFLAGS } } };
+
+    const auto found{ std::ranges::find_if(names, [name](const auto& pair) {
+        return std::ranges::equal(
+            pair.first, name, [](const char lhs, const char rhs) {
+                return lhs
+                       == std::tolower(static_cast<unsigned char>(rhs));
+            });
+    }) };
+
+    return found != names.cend() ? std::make_optional(found->second)
+                                 : std::nullopt;
+}
\ No newline at end of file
@@ -5,6 +5,20 @@
 #include <cstring>
 
 
+namespace {
+
+//! The offset of @p MXCSR in the @p FXSAVE area.
+constexpr std::size_t mxcsr_offset{ 24 };
+
+//! The offset of @p XMM0 in the @p FXSAVE area.
+constexpr std::size_t xmm_offset{ 160 };
+
+//! The top-of-stack field of the x87 status word.
+constexpr RegisterField x87_top_field{ 11, 3 };
+
+}  // namespace
+
+
 Registers::Registers(const HANDLE thread, const std::uint32_t context_flags) :
     EAX{ *this, RegisterIndex::EAX },
     EBX{ *this, RegisterIndex::EBX },
@@ -23,17 +37,15 @@ Registers::Registers(const HANDLE thread, const std::uint32_t context_flags) :
     DR6{ *this },
     DR7{ *this },
     thread_{ thread } {
-    context_.ContextFlags = context_flags;
-    if (GetThreadContext(thread, &context_)) {
-        original_context_ = context_;
-    } else {
-        ThrowLastError();
+    if (context_flags != 0) {
+        Load(context_flags);
     }
 }
 
 Registers::~Registers() {
-    if (thread_
-        && std::memcmp(&context_, &original_context_, sizeof(CONTEXT)) != 0) {
+    // Only modified groups are written back, so less data is moved.
+    if (thread_ && dirty_ != 0) {
+        context_.ContextFlags = dirty_;
         SetThreadContext(thread_, &context_);
     }
 }
@@ -42,136 +54,113 @@ HANDLE Registers::Thread() const noexcept {
     return thread_;
 }
 
-void Registers::Set(const RegisterIndex index,
-                    const std::uintptr_t value) noexcept {
-    switch (index) {
-        case RegisterIndex::EAX: {
-            context_.Eax = value;
-            break;
-        }
-        case RegisterIndex::EBX: {
-            context_.Ebx = value;
-            break;
-        }
-        case RegisterIndex::ECX: {
-            context_.Ecx = value;
-            break;
-        }
-        case RegisterIndex::EDX: {
-            context_.Edx = value;
-            break;
-        }
-        case RegisterIndex::EIP: {
-            context_.Eip = value;
-            break;
-        }
-        case RegisterIndex::ESP: {
-            context_.Esp = value;
-            break;
-        }
-        case RegisterIndex::EBP: {
-            context_.Ebp = value;
-            break;
-        }
-        case RegisterIndex::ESI: {
-            context_.Esi = value;
-            break;
-        }
-        case RegisterIndex::EDI: {
-            context_.Edi = value;
-            break;
-        }
-        case RegisterIndex::EFLAGS: {
-            context_.EFlags = value;
-            break;
-        }
-        case RegisterIndex::DR0: {
-            context_.Dr0 = value;
-            break;
-        }
-        case RegisterIndex::DR1: {
-            context_.Dr1 = value;
-            break;
-        }
-        case RegisterIndex::DR2: {
-            context_.Dr2 = value;
-            break;
-        }
-        case RegisterIndex::DR3: {
-            context_.Dr3 = value;
-            break;
-        }
-        case RegisterIndex::DR6: {
-            context_.Dr6 = value;
-            break;
-        }
-        case RegisterIndex::DR7: {
-            context_.Dr7 = value;
-            break;
-        }
-        default: {
-            assert(false);
-        }
+void Registers::Set(const RegisterIndex index, const std::uintptr_t value) {
+    assert(index <= RegisterIndex::EFLAGS);
+    const auto group{ Group(index) };
+    Load(group);
+    if (auto& member{ context_.*ContextMember(index) }; member != value) {
+        member = value;
+        dirty_ |= group;
     }
 }
 
-void Registers::Reset(const RegisterIndex index) noexcept {
+void Registers::Reset(const RegisterIndex index) {
     Set(index, 0);
 }
 
-std::uint32_t Registers::Get(const RegisterIndex index) const noexcept {
-    switch (index) {
-        case RegisterIndex::EAX: {
-            return context_.Eax;
-        }
-        case RegisterIndex::EBX: {
-            return context_.Ebx;
-        }
-        case RegisterIndex::ECX: {
-            return context_.Ecx;
-        }
-        case RegisterIndex::EDX: {
-            return context_.Edx;
-        }
-        case RegisterIndex::EIP: {
-            return context_.Eip;
-        }
-        case RegisterIndex::ESP: {
-            return context_.Esp;
-        }
-        case RegisterIndex::EBP: {
-            return context_.Ebp;
-        }
-        case RegisterIndex::ESI: {
-            return context_.Esi;
-        }
-        case RegisterIndex::EDI: {
-            return context_.Edi;
-        }
-        case RegisterIndex::EFLAGS: {
-            return context_.EFlags;
-        }
-        case RegisterIndex::DR0: {
-            return context_.Dr0;
-        }
-        case RegisterIndex::DR1: {
-            return context_.Dr1;
-        }
-        case RegisterIndex::DR2: {
-            return context_.Dr2;
-        }
-        case RegisterIndex::DR3: {
-            return context_.Dr3;
-        }
-        case RegisterIndex::DR6: {
-            return context_.Dr6;
-        }
-        case RegisterIndex::DR7: {
-            return context_.Dr7;
-        }
-        default: {
-            assert(false);
-            return 0;
-        }
+std::uintptr_t Registers::Get(const RegisterIndex index) const {
+    assert(index <= RegisterIndex::EFLAGS);
+    Load(Group(index));
+    return context_.*ContextMember(index);
+}
+
+void Registers::Fetch(const std::uint32_t groups) const {
+    // Groups that have been fetched or modified are not overwritten.
+    context_.ContextFlags = groups;
+    if (!GetThreadContext(thread_, &context_)) {
+        ThrowLastError();
+    }
+
+    loaded_ |= groups;
+}
+
+X87Register Registers::ST(const std::size_t index) const {
+    assert(index < x87_register_count);
+    X87Register value{};
+    ReadBytes(CONTEXT_FLOATING_POINT,
+              context_.FloatSave.RegisterArea + index * value.size(), value);
+    return value;
+}
+
+void Registers::SetST(const std::size_t index, const X87Register& value) {
+    assert(index < x87_register_count);
+    WriteBytes(CONTEXT_FLOATING_POINT,
+               context_.FloatSave.RegisterArea + index * value.size(), value);
+}
+
+std::uint64_t Registers::MM(const std::size_t index) const {
+    assert(index < x87_register_count);
+    const auto value{ ST(X87StackIndex(index)) };
+    std::uint64_t mantissa{ 0 };
+    std::memcpy(&mantissa, value.data(), sizeof(mantissa));
+    return mantissa;
+}
+
+void Registers::SetMM(const std::size_t index, const std::uint64_t value) {
+    assert(index < x87_register_count);
+    X87Register x87{};
+    std::memcpy(x87.data(), &value, sizeof(value));
+    x87[8] = x87[9] = std::byte{ 0xFF };
+    SetST(X87StackIndex(index), x87);
+}
+
+XmmRegister Registers::XMM(const std::size_t index) const {
+    assert(index < xmm_register_count);
+    XmmRegister value{};
+    ReadBytes(CONTEXT_EXTENDED_REGISTERS,
+              context_.ExtendedRegisters + xmm_offset + index * value.size(),
+              value);
+    return value;
+}
+
+void Registers::SetXMM(const std::size_t index, const XmmRegister& value) {
+    assert(index < xmm_register_count);
+    WriteBytes(CONTEXT_EXTENDED_REGISTERS,
+               context_.ExtendedRegisters + xmm_offset + index * value.size(),
+               value);
+}
+
+std::uint32_t Registers::MXCSR() const {
+    std::uint32_t value{ 0 };
+    ReadBytes(CONTEXT_EXTENDED_REGISTERS,
+              context_.ExtendedRegisters + mxcsr_offset,
+              std::as_writable_bytes(std::span{ &value, 1 }));
+    return value;
+}
+
+void Registers::SetMXCSR(const std::uint32_t value) {
+    WriteBytes(CONTEXT_EXTENDED_REGISTERS,
+               context_.ExtendedRegisters + mxcsr_offset,
+               std::as_bytes(std::span{ &value, 1 }));
+}
+
+void Registers::ReadBytes(const std::uint32_t group, const void* const source,
+                          const std::span<std::byte> target) const {
+    Load(group);
+    std::memcpy(target.data(), source, target.size());
+}
+
+void Registers::WriteBytes(const std::uint32_t group, void* const target,
+                           const std::span<const std::byte> source) {
+    Load(group);
+    if (std::memcmp(target, source.data(), source.size()) != 0) {
+        std::memcpy(target, source.data(), source.size());
+        dirty_ |= group;
     }
+}
+
+std::size_t Registers::X87StackIndex(const std::size_t index) const {
+    Load(CONTEXT_FLOATING_POINT);
+    const auto top{ x87_top_field.Decode(context_.FloatSave.StatusWord) };
+    return (index - top) % x87_register_count;
 }
\ No newline at end of file
@@ -14,10 +14,10 @@ Thread::Thread(Thread&& thread) noexcept :
     id_{ thread.id_ },
     entry_{ thread.entry_ },
     local_base_{ thread.local_base_ },
-    single_step_callbacks_{ std::move(thread.single_step_callbacks_) },
-    single_stepping_{ thread.single_stepping_ },
-    internal_stepping_{ thread.internal_stepping_ },
-    internal_step_callback_{ std::move(thread.internal_step_callback_) } {
+    suspensions_{ thread.suspensions_ },
+    frozen_{ thread.frozen_ },
+    step_{ std::move(thread.step_) },
+    history_{ std::move(thread.history_) } {
     thread.handle_ = nullptr;
     thread.id_ = 0;
 }
@@ -42,10 +42,45 @@ void Thread::Suspend() const {
     if (SuspendThread(handle_) == -1) {
         ThrowLastError();
     }
+
+    ++suspensions_;
 }
 
 void Thread::Resume() const {
     if (ResumeThread(handle_) == -1) {
         ThrowLastError();
     }
+
+    if (suspensions_ != 0) {
+        --suspensions_;
+    }
+}
+
+bool Thread::Freeze() {
+    if (frozen_ || suspensions_ != 0) {
+        return false;
+    }
+
+    if (SuspendThread(handle_) == -1) {
+        ThrowLastError();
+    }
+
+    frozen_ = true;
+    return true;
+}
+
+void Thread::Thaw() {
+    if (!frozen_) {
+        return;
+    }
+
+    if (ResumeThread(handle_) == -1) {
+        ThrowLastError();
+    }
+
+    frozen_ = false;
+}
+
+bool Thread::Frozen() const noexcept {
+    return frozen_;
 }
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "thread.h"
+#include "register/registers.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <memory>
+
+
+namespace {
+
+//! The number of values compared together before locating a match.
+constexpr std::size_t scan_block_size{ 16 };
+
+}  // namespace
+
+
+RegisterHistory::RegisterHistory(const std::size_t capacity) :
+    capacity_{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) } {
+    for (auto& column : columns_) {
+        column.resize(capacity_);
+    }
+}
+
+void RegisterHistory::Push(const Registers& registers) {
+    Push({ static_cast<std::uint32_t>(registers.Get<RegisterIndex::EAX>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::EBX>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::ECX>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::EDX>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::ESP>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::EBP>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::ESI>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::EDI>()),
+           static_cast<std::uint32_t>(registers.Get<RegisterIndex::EIP>()),
+           static_cast<std::uint32_t>(
+               registers.Get<RegisterIndex::EFLAGS>()) });
+}
+
+void RegisterHistory::Push(
+    const std::array<std::uint32_t, history_register_count>& values) {
+    const auto position{ count_ & (capacity_ - 1) };
+    for (std::size_t i{ 0 }; i != values.size(); ++i) {
+        columns_[i][position] = values[i];
+    }
+
+    ++count_;
+}
+
+std::size_t RegisterHistory::Size() const noexcept {
+    return count_ < capacity_ ? count_ : capacity_;
+}
+
+std::size_t RegisterHistory::Capacity() const noexcept {
+    return capacity_;
+}
+
+std::uint64_t RegisterHistory::First() const noexcept {
+    return count_ - Size();
+}
+
+std::uint64_t RegisterHistory::Count() const noexcept {
+    return count_;
+}
+
+std::uint32_t RegisterHistory::Get(const HistoryRegister reg,
+                                   const std::uint64_t record) const noexcept {
+    assert(First() <= record && record < count_);
+    return columns_[static_cast<std::size_t>(reg)][record & (capacity_ - 1)];
+}
+
+std::optional<std::uint64_t> RegisterHistory::FindLastBelow(
+    const HistoryRegister reg, const std::uint32_t value) const noexcept {
+    const auto segments{ Segments(reg) };
+    auto end{ count_ };
+    for (auto segment{ segments.crbegin() }; segment != segments.crend();
+         ++segment) {
+        const auto values{ *segment };
+        auto i{ values.size() };
+        while (i != 0) {
+            const auto begin{ i >= scan_block_size ? i - scan_block_size : 0 };
+            // Comparing a whole block without branches lets it be vectorized.
+            auto found{ false };
+            for (auto j{ begin }; j != i; ++j) {
+                found |= values[j] < value;
+            }
+
+            if (found) {
+                for (auto j{ i }; j-- != begin;) {
+                    if (values[j] < value) {
+                        return end - (values.size() - j);
+                    }
+                }
+            }
+
+            i = begin;
+        }
+
+        end -= values.size();
+    }
+
+    return std::nullopt;
+}
+
+std::vector<std::uint64_t> RegisterHistory::FindChanges(
+    const HistoryRegister reg) const {
+    std::vector<std::uint64_t> changes{};
+    auto record{ First() };
+    std::optional<std::uint32_t> previous{};
+    std::vector<std::uint8_t> changed{};
+    for (const auto values : Segments(reg)) {
+        if (values.empty()) {
+            continue;
+        }
+
+        // Differences are computed in a separate pass, so it can be vectorized.
+        changed.resize(values.size());
+        changed[0] = previous && *previous != values[0];
+        for (std::size_t i{ 1 }; i != values.size(); ++i) {
+            changed[i] = values[i] != values[i - 1];
+        }
+
+        for (std::size_t i{ 0 }; i != values.size(); ++i) {
+            if (changed[i]) {
+                changes.push_back(record + i);
+            }
+        }
+
+        record += values.size();
+        previous = values.back();
+    }
+
+    return changes;
+}
+
+void RegisterHistory::Clear() noexcept {
+    count_ = 0;
+}
+
+std::array<std::span<const std::uint32_t>, 2> RegisterHistory::Segments(
+    const HistoryRegister reg) const noexcept {
+    const std::span<const std::uint32_t> column{
+        columns_[static_cast<std::size_t>(reg)]
+    };
+
+    const auto size{ Size() };
+    const auto begin{ static_cast<std::size_t>(First() & (capacity_ - 1)) };
+    if (begin + size <= capacity_) {
+        return { column.subspan(begin, size), {} };
+    } else {
+        return { column.subspan(begin),
+                 column.first(begin + size - capacity_) };
+    }
+}
+
+
+void Thread::EnableRegisterHistory(const std::size_t capacity) {
+    history_ = std::make_unique<RegisterHistory>(capacity);
+}
+
+void Thread::DisableRegisterHistory() noexcept {
+    history_.reset();
+}
+
+const RegisterHistory* Thread::History() const noexcept {
+    return history_.get();
+}
+
+void Thread::RecordHistory(const Registers& registers) {
+    if (history_) {
+        history_->Push(registers);
+    }
+}
\ No newline at end of file
@@ -1,51 +1,157 @@
 #include "thread.h"
 #include "register/registers.h"
 
-#include <algorithm>
+#include <memory>
 #include <utility>
 
 
+Thread::StepState& Thread::Step() {
+    if (!step_) {
+        step_ = std::make_unique<StepState>();
+    }
+
+    return *step_;
+}
+
 void Thread::StepInto() {
+    auto& step{ Step() };
     Registers{ handle_ }.EFLAGS.SetTF();
-    single_stepping_ = true;
+    step.single_stepping = true;
 }
 
 void Thread::StepInto(StepCallback callback) {
     StepInto();
-    single_step_callbacks_.push_back(std::move(callback));
+    step_->single_step_callbacks.Push(std::move(callback));
 }
 
-void Thread::InternalStep(StepCallback callback) {
-    Registers{ handle_ }.EFLAGS.SetTF();
-    internal_step_callback_ = std::move(callback);
-    internal_stepping_ = true;
+void Thread::InternalStep(InternalStepCallback callback) {
+    Registers registers{ handle_ };
+    InternalStep(registers, std::move(callback));
+}
+
+void Thread::InternalStep(Registers& registers,
+                          InternalStepCallback callback) {
+    auto& step{ Step() };
+    registers.EFLAGS.SetTF();
+    step.internal_step_callback = std::move(callback);
+    step.internal_stepping = true;
 }
 
 bool Thread::SingleStepping() const noexcept {
-    return single_stepping_;
+    return step_ && step_->single_stepping;
 }
 
 void Thread::ResetSingleStepping() noexcept {
-    single_stepping_ = false;
+    if (step_) {
+        step_->single_stepping = false;
+    }
 }
 
 bool Thread::InternalStepping() const noexcept {
-    return internal_stepping_;
+    return step_ && step_->internal_stepping;
 }
 
 void Thread::ResetInternalStepping() noexcept {
-    internal_stepping_ = false;
+    if (step_) {
+        step_->internal_stepping = false;
+    }
 }
 
 void Thread::ExecuteInternalStepCallback() {
-    if (internal_step_callback_) {
-        internal_step_callback_();
-        internal_step_callback_ = nullptr;
+    if (step_ && step_->internal_step_callback) {
+        // The callback is moved out, so it can set another internal step.
+        const auto callback{ std::move(step_->internal_step_callback) };
+        callback();
     }
 }
 
 void Thread::ExecuteSingleStepCallbacks() {
-    std::ranges::for_each(single_step_callbacks_,
-                          [](auto& callback) { callback(); });
-    single_step_callbacks_.clear();
+    if (step_) {
+        step_->single_step_callbacks.Execute();
+    }
+}
+
+void Thread::StepOver(StepCallback callback) {
+    auto& step{ Step() };
+    step.pending_return_step = ReturnStep::Over;
+    step.return_step_callback = std::move(callback);
+}
+
+void Thread::StepOut(StepCallback callback) {
+    auto& step{ Step() };
+    step.pending_return_step = ReturnStep::Out;
+    step.return_step_callback = std::move(callback);
+}
+
+ReturnStep Thread::PendingReturnStep() const noexcept {
+    return step_ ? step_->pending_return_step : ReturnStep::None;
+}
+
+void Thread::ArmReturnStep(const std::uintptr_t address,
+                           const std::uintptr_t frame) noexcept {
+    if (!step_) {
+        return;
+    }
+
+    step_->pending_return_step = ReturnStep::None;
+    step_->return_stepping = true;
+    step_->return_step_address = address;
+    step_->return_step_frame = frame;
+}
+
+void Thread::DowngradeReturnStep() {
+    if (!step_) {
+        return;
+    }
+
+    step_->pending_return_step = ReturnStep::None;
+    step_->return_stepping = false;
+    step_->return_step_address = 0;
+    step_->return_step_frame = 0;
+    if (step_->return_step_callback) {
+        StepInto(std::move(step_->return_step_callback));
+        step_->return_step_callback = nullptr;
+    } else {
+        StepInto();
+    }
+}
+
+bool Thread::ReturnStepping() const noexcept {
+    return step_ && step_->return_stepping;
+}
+
+std::uintptr_t Thread::ReturnStepAddress() const noexcept {
+    return step_ ? step_->return_step_address : 0;
+}
+
+bool Thread::ReachedReturnStep(const std::uintptr_t address,
+                               const std::uintptr_t stack) const noexcept {
+    return ReturnStepping() && address == step_->return_step_address
+           && stack >= step_->return_step_frame;
+}
+
+bool Thread::LeftReturnStep(const std::uintptr_t stack) const noexcept {
+    return ReturnStepping() && stack > step_->return_step_frame;
+}
+
+void Thread::ResetReturnStepping() noexcept {
+    if (step_) {
+        step_->pending_return_step = ReturnStep::None;
+        step_->return_stepping = false;
+        step_->return_step_address = 0;
+        step_->return_step_frame = 0;
+        step_->return_step_callback = nullptr;
+    }
+}
+
+void Thread::ExecuteReturnStepCallback() {
+    if (!step_) {
+        return;
+    }
+
+    auto callback{ std::move(step_->return_step_callback) };
+    ResetReturnStepping();
+    if (callback) {
+        callback();
+    }
 }
\ No newline at end of file
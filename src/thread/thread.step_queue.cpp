@@ -0,0 +1,71 @@
+#include "step_callback_queue.h"
+
+#include <utility>
+
+
+StepCallbackQueue::StepCallbackQueue(StepCallbackQueue&& queue) noexcept :
+    callbacks_{ std::move(queue.callbacks_) },
+    size_{ std::exchange(queue.size_, 0) },
+    overflow_{ std::move(queue.overflow_) } {}
+
+StepCallbackQueue& StepCallbackQueue::operator=(
+    StepCallbackQueue&& queue) noexcept {
+    if (this != &queue) {
+        callbacks_ = std::move(queue.callbacks_);
+        size_ = std::exchange(queue.size_, 0);
+        overflow_ = std::move(queue.overflow_);
+    }
+
+    return *this;
+}
+
+void StepCallbackQueue::Push(StepCallback callback) {
+    if (size_ < callbacks_.size()) {
+        callbacks_[size_++] = std::move(callback);
+    } else {
+        overflow_.push_back(std::move(callback));
+    }
+}
+
+bool StepCallbackQueue::Empty() const noexcept {
+    return size_ == 0;
+}
+
+std::size_t StepCallbackQueue::Size() const noexcept {
+    return size_ + overflow_.size();
+}
+
+void StepCallbackQueue::Execute() {
+    // Callbacks are moved out, so new ones can be pushed while they are running.
+    std::array<StepCallback, inline_step_callback_count> executed{};
+    const auto size{ std::exchange(size_, 0) };
+    for (std::size_t i{ 0 }; i != size; ++i) {
+        executed[i] = std::move(callbacks_[i]);
+    }
+
+    auto overflow{ std::move(overflow_) };
+    overflow_.clear();
+
+    for (std::size_t i{ 0 }; i != size; ++i) {
+        executed[i]();
+    }
+
+    for (const auto& callback : overflow) {
+        callback();
+    }
+
+    // Keep the overflow buffer to avoid allocating it again.
+    if (overflow_.empty()) {
+        overflow.clear();
+        overflow_.swap(overflow);
+    }
+}
+
+void StepCallbackQueue::Clear() noexcept {
+    for (std::size_t i{ 0 }; i != size_; ++i) {
+        callbacks_[i] = nullptr;
+    }
+
+    size_ = 0;
+    overflow_.clear();
+}
\ No newline at end of file
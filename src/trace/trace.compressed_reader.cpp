@@ -0,0 +1,316 @@
+#include "error.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+//! Load a little-endian integer.
+template <typename T>
+T Load(const std::span<const std::byte> data,
+       const std::size_t offset) noexcept {
+    T value{};
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+[[noreturn]] void ThrowCorrupted() {
+    throw std::runtime_error{ "The trace file is corrupted." };
+}
+
+//! Decode a varint, throwing an exception if it is invalid.
+std::uint64_t ReadVarint(std::span<const std::byte>& data) {
+    const auto value{ DecodeVarint(data) };
+    if (!value) {
+        ThrowCorrupted();
+    }
+
+    return *value;
+}
+
+}  // namespace
+
+
+CompressedTraceReader::CompressedTraceReader(const std::wstring_view file_path) {
+    file_ = CreateFileW(file_path.data(), GENERIC_READ, FILE_SHARE_READ,
+                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        ThrowLastError();
+    }
+
+    try {
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file_, &file_size)) {
+            ThrowLastError();
+        }
+
+        if (static_cast<std::uint64_t>(file_size.QuadPart) > SIZE_MAX) {
+            ThrowCorrupted();
+        }
+
+        const auto size{ static_cast<std::size_t>(file_size.QuadPart) };
+        if (size < trace_header_size + compressed_trace_footer_size) {
+            ThrowCorrupted();
+        }
+
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0,
+                                      nullptr);
+        if (!mapping_) {
+            ThrowLastError();
+        }
+
+        const auto view{ MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) };
+        if (!view) {
+            ThrowLastError();
+        }
+
+        view_ = { static_cast<const std::byte*>(view), size };
+
+        if (Load<std::uint32_t>(view_, 0) != compressed_trace_magic
+            || Load<std::uint16_t>(view_, 4) != trace_version) {
+            ThrowCorrupted();
+        }
+
+        const auto footer{ view_.last(compressed_trace_footer_size) };
+        const auto blocks_offset{ Load<std::uint64_t>(footer, 0) };
+        const auto sequences_offset{ Load<std::uint64_t>(footer, 8) };
+        const auto index_offset{ Load<std::uint64_t>(footer, 16) };
+        size_ = Load<std::uint64_t>(footer, 24);
+        const auto block_count{ Load<std::uint32_t>(footer, 32) };
+        const auto sequence_count{ Load<std::uint32_t>(footer, 36) };
+        chunk_count_ = Load<std::uint32_t>(footer, 40);
+
+        // The count is bounded before multiplying, so the index size cannot wrap in a 32-bit `std::size_t`.
+        const std::uint64_t index_end{ size - compressed_trace_footer_size };
+        if (Load<std::uint32_t>(footer, 44) != compressed_trace_magic
+            || blocks_offset < trace_header_size
+            || sequences_offset < blocks_offset
+            || index_offset < sequences_offset || index_offset > index_end
+            || chunk_count_ > (index_end - index_offset)
+                                  / compressed_trace_index_entry_size
+            || index_offset
+                       + std::uint64_t{ chunk_count_ }
+                             * compressed_trace_index_entry_size
+                   != index_end) {
+            ThrowCorrupted();
+        }
+
+        index_ = view_.subspan(static_cast<std::size_t>(index_offset),
+                               chunk_count_
+                                   * compressed_trace_index_entry_size);
+
+        for (std::size_t i{ 0 }; i != chunk_count_; ++i) {
+            const auto entry{ index_.subspan(
+                i * compressed_trace_index_entry_size,
+                compressed_trace_index_entry_size) };
+            const auto offset{ Load<std::uint64_t>(entry, 0) };
+            const auto chunk_size{ Load<std::uint32_t>(entry, 8) };
+            if (offset < trace_header_size || offset > blocks_offset
+                || chunk_size > blocks_offset - offset
+                || ChunkFirst(i) >= size_
+                || (i != 0 && ChunkFirst(i) <= ChunkFirst(i - 1))) {
+                ThrowCorrupted();
+            }
+        }
+
+        LoadDictionaries(
+            view_.subspan(blocks_offset, sequences_offset - blocks_offset),
+            view_.subspan(sequences_offset, index_offset - sequences_offset),
+            block_count, sequence_count);
+    } catch (...) {
+        Close();
+        throw;
+    }
+}
+
+CompressedTraceReader::~CompressedTraceReader() noexcept {
+    Close();
+}
+
+CompressedTraceReader::CompressedTraceReader(
+    CompressedTraceReader&& reader) noexcept :
+    file_{ std::exchange(reader.file_, INVALID_HANDLE_VALUE) },
+    mapping_{ std::exchange(reader.mapping_, nullptr) },
+    view_{ std::exchange(reader.view_, {}) },
+    index_{ reader.index_ },
+    size_{ reader.size_ },
+    chunk_count_{ reader.chunk_count_ },
+    sequences_{ std::move(reader.sequences_) },
+    addresses_{ std::move(reader.addresses_) } {}
+
+std::uint64_t CompressedTraceReader::Size() const noexcept {
+    return size_;
+}
+
+std::size_t CompressedTraceReader::ChunkCount() const noexcept {
+    return chunk_count_;
+}
+
+std::size_t CompressedTraceReader::Read(
+    const std::uint64_t index, const std::span<std::uintptr_t> addresses) const {
+    if (index >= size_ || addresses.empty()) {
+        return 0;
+    }
+
+    // Find the last chunk starting at or before the index.
+    std::size_t low{ 0 };
+    std::size_t high{ chunk_count_ };
+    while (high - low > 1) {
+        const auto middle{ low + (high - low) / 2 };
+        if (ChunkFirst(middle) <= index) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    auto position{ ChunkFirst(low) };
+    std::size_t read{ 0 };
+    for (auto chunk{ low }; chunk != chunk_count_ && read != addresses.size();
+         ++chunk) {
+        auto data{ ChunkData(chunk) };
+        while (!data.empty() && read != addresses.size()) {
+            const auto id{ ReadVarint(data) };
+            const auto count{ ReadVarint(data) };
+            if (id >= sequences_.size()) {
+                ThrowCorrupted();
+            }
+
+            const auto& sequence{ sequences_[id] };
+            const auto total{ sequence.length * count };
+            if (position + total <= index) {
+                position += total;
+                continue;
+            }
+
+            // Skip the records before the index.
+            const auto skip{ index > position ? index - position : 0 };
+            const auto offset{ static_cast<std::size_t>(skip % sequence.length) };
+            const auto length{ static_cast<std::size_t>(std::min<std::uint64_t>(
+                total - skip, addresses.size() - read)) };
+
+            // Copy the first repetition, then double the copied records.
+            const auto period{ sequence.length };
+            const auto* const source{ addresses_.data() + sequence.begin };
+            auto* const target{ addresses.data() + read };
+            const auto first{ std::min(period, length) };
+            const auto head{ std::min(period - offset, first) };
+            std::copy_n(source + offset, head, target);
+            std::copy_n(source, first - head, target + head);
+
+            auto copied{ first };
+            while (copied != length) {
+                const auto repeated{ copied - copied % period };
+                const auto size{ std::min(repeated, length - copied) };
+                std::copy_n(target + copied - repeated, size, target + copied);
+                copied += size;
+            }
+
+            read += length;
+            position += total;
+        }
+    }
+
+    return read;
+}
+
+std::uintptr_t CompressedTraceReader::At(const std::uint64_t index) const {
+    std::uintptr_t address{ 0 };
+    if (Read(index, { &address, 1 }) != 1) {
+        throw std::runtime_error{ std::format(
+            "The trace record {} is out of range.", index) };
+    }
+
+    return address;
+}
+
+void CompressedTraceReader::LoadDictionaries(
+    std::span<const std::byte> blocks, std::span<const std::byte> sequences,
+    const std::uint32_t block_count, const std::uint32_t sequence_count) {
+    // Each entry takes at least two bytes, so larger counts are corrupted and must not be reserved.
+    if (block_count > blocks.size() / 2
+        || sequence_count > sequences.size() / 2) {
+        ThrowCorrupted();
+    }
+
+    // Blocks are only needed to expand sequences.
+    std::vector<std::uintptr_t> block_addresses{};
+    std::vector<std::pair<std::size_t, std::size_t>> block_ranges{};
+    block_ranges.reserve(block_count);
+
+    std::uintptr_t start{ 0 };
+    for (std::uint32_t i{ 0 }; i != block_count; ++i) {
+        start = static_cast<std::uint32_t>(start
+                                           + ZigZagDecode(ReadVarint(blocks)));
+        const auto length{ ReadVarint(blocks) };
+        if (length == 0 || length > CompressedTraceWriter::max_block_length) {
+            ThrowCorrupted();
+        }
+
+        block_ranges.emplace_back(block_addresses.size(), length);
+        auto address{ start };
+        block_addresses.push_back(address);
+        for (std::size_t j{ 1 }; j != length; ++j) {
+            address += ReadVarint(blocks);
+            block_addresses.push_back(address);
+        }
+    }
+
+    sequences_.reserve(sequence_count);
+    for (std::uint32_t i{ 0 }; i != sequence_count; ++i) {
+        const auto length{ ReadVarint(sequences) };
+        if (length == 0 || length > CompressedTraceWriter::max_loop_period) {
+            ThrowCorrupted();
+        }
+
+        const auto begin{ addresses_.size() };
+        for (std::size_t j{ 0 }; j != length; ++j) {
+            const auto block{ ReadVarint(sequences) };
+            if (block >= block_count) {
+                ThrowCorrupted();
+            }
+
+            const auto [block_begin, block_length]{ block_ranges[block] };
+            addresses_.insert(addresses_.cend(),
+                              block_addresses.cbegin() + block_begin,
+                              block_addresses.cbegin() + block_begin
+                                  + block_length);
+        }
+
+        sequences_.push_back({ begin, addresses_.size() - begin });
+    }
+}
+
+std::span<const std::byte> CompressedTraceReader::ChunkData(
+    const std::size_t chunk) const noexcept {
+    const auto entry{ index_.subspan(chunk * compressed_trace_index_entry_size,
+                                     compressed_trace_index_entry_size) };
+    return view_.subspan(static_cast<std::size_t>(Load<std::uint64_t>(entry, 0)),
+                         Load<std::uint32_t>(entry, 8));
+}
+
+std::uint64_t CompressedTraceReader::ChunkFirst(
+    const std::size_t chunk) const noexcept {
+    return Load<std::uint64_t>(index_,
+                               chunk * compressed_trace_index_entry_size + 16);
+}
+
+void CompressedTraceReader::Close() noexcept {
+    if (!view_.empty()) {
+        UnmapViewOfFile(view_.data());
+        view_ = {};
+    }
+
+    if (mapping_) {
+        CloseHandle(std::exchange(mapping_, nullptr));
+    }
+
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(std::exchange(file_, INVALID_HANDLE_VALUE));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+#include "error.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+//! The maximum size of an encoded token.
+constexpr std::size_t max_token_size{ max_varint_size * 2 };
+
+//! Store a little-endian integer.
+template <typename T>
+void Store(std::byte* const buffer, const T value) noexcept {
+    std::memcpy(buffer, &value, sizeof(value));
+}
+
+//! Mix a value into a hash.
+constexpr std::uint64_t Mix(const std::uint64_t hash,
+                            const std::uint64_t value) noexcept {
+    return (hash ^ value) * 0x100000001B3;
+}
+
+//! The initial hash value.
+constexpr std::uint64_t hash_basis{ 0xCBF29CE484222325 };
+
+//! Append a varint to a buffer.
+void AppendVarint(std::vector<std::byte>& buffer, const std::uint64_t value) {
+    std::array<std::byte, max_varint_size> varint{};
+    const auto size{ EncodeVarint(value, varint.data()) };
+    buffer.insert(buffer.cend(), varint.cbegin(), varint.cbegin() + size);
+}
+
+}  // namespace
+
+
+CompressedTraceWriter::CompressedTraceWriter(const std::wstring_view file_path,
+                                             const std::uint32_t chunk_size) :
+    file_{ INVALID_HANDLE_VALUE }, chunk_size_{ chunk_size } {
+    if (chunk_size_ == 0 || chunk_size_ > max_trace_chunk_size) {
+        throw std::runtime_error{ std::format(
+            "The chunk size of a trace must be between 1 and {}.",
+            max_trace_chunk_size) };
+    }
+
+    buffer_.resize(chunk_size_ * max_token_size);
+    pending_.reserve(fold_window_size + max_loop_period);
+
+    file_ = CreateFileW(file_path.data(), GENERIC_WRITE, FILE_SHARE_READ,
+                        nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        ThrowLastError();
+    }
+
+    std::array<std::byte, trace_header_size> header{};
+    Store(header.data(), compressed_trace_magic);
+    Store(header.data() + 4, trace_version);
+    Store(header.data() + 8, chunk_size_);
+    Append(header);
+}
+
+CompressedTraceWriter::~CompressedTraceWriter() noexcept {
+    try {
+        Close();
+    } catch (...) {
+    }
+}
+
+CompressedTraceWriter::CompressedTraceWriter(
+    CompressedTraceWriter&& writer) noexcept :
+    file_{ std::exchange(writer.file_, INVALID_HANDLE_VALUE) },
+    chunk_size_{ writer.chunk_size_ },
+    buffer_{ std::move(writer.buffer_) },
+    buffer_size_{ writer.buffer_size_ },
+    chunk_count_{ writer.chunk_count_ },
+    chunk_first_{ writer.chunk_first_ },
+    emitted_{ writer.emitted_ },
+    offset_{ writer.offset_ },
+    size_{ writer.size_ },
+    chunks_{ std::move(writer.chunks_) },
+    block_start_{ writer.block_start_ },
+    address_{ writer.address_ },
+    block_length_{ writer.block_length_ },
+    block_hash_{ writer.block_hash_ },
+    current_offsets_{ writer.current_offsets_ },
+    blocks_{ std::move(writer.blocks_) },
+    block_offsets_{ std::move(writer.block_offsets_) },
+    block_ids_{ std::move(writer.block_ids_) },
+    sequences_{ std::move(writer.sequences_) },
+    sequence_blocks_{ std::move(writer.sequence_blocks_) },
+    sequence_ids_{ std::move(writer.sequence_ids_) },
+    pending_{ std::move(writer.pending_) },
+    in_run_{ writer.in_run_ },
+    run_sequence_{ writer.run_sequence_ },
+    run_count_{ writer.run_count_ },
+    run_position_{ writer.run_position_ } {}
+
+std::uint64_t CompressedTraceWriter::Size() const noexcept {
+    return size_;
+}
+
+void CompressedTraceWriter::Write(const std::uintptr_t address) {
+    const auto delta{ address - address_ };
+    const auto sequential{ block_length_ != 0
+                           && block_length_ != max_block_length && 0 < delta
+                           && delta <= max_instruction_length };
+    if (!sequential) {
+        if (block_length_ != 0) {
+            EndBlock();
+        }
+
+        block_start_ = address;
+        block_hash_ = Mix(hash_basis, address);
+    }
+
+    const auto offset{ static_cast<std::uint16_t>(address - block_start_) };
+    current_offsets_[block_length_++] = offset;
+    block_hash_ = Mix(block_hash_, offset);
+    address_ = address;
+    ++size_;
+}
+
+void CompressedTraceWriter::Close() {
+    if (file_ == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    if (block_length_ != 0) {
+        EndBlock();
+    }
+
+    EmitRun();
+    while (!pending_.empty()) {
+        ParsePending();
+        EmitRun();
+    }
+
+    FlushChunk();
+
+    std::vector<std::byte> data{};
+
+    const auto blocks_offset{ offset_ };
+    std::uintptr_t previous_start{ 0 };
+    for (const auto& block : blocks_) {
+        AppendVarint(data, ZigZagEncode(static_cast<std::int32_t>(
+                               block.start - previous_start)));
+        AppendVarint(data, block.length);
+        for (std::uint32_t i{ 1 }; i < block.length; ++i) {
+            AppendVarint(data, block_offsets_[block.begin + i]
+                                   - block_offsets_[block.begin + i - 1]);
+        }
+
+        previous_start = block.start;
+    }
+
+    Append(data);
+    data.clear();
+
+    const auto sequences_offset{ offset_ };
+    for (const auto& sequence : sequences_) {
+        AppendVarint(data, sequence.length);
+        for (std::uint32_t i{ 0 }; i != sequence.length; ++i) {
+            AppendVarint(data, sequence_blocks_[sequence.begin + i]);
+        }
+    }
+
+    Append(data);
+
+    const auto index_offset{ offset_ };
+    std::array<std::byte, compressed_trace_index_entry_size> entry{};
+    for (const auto& chunk : chunks_) {
+        Store(entry.data(), chunk.offset);
+        Store(entry.data() + 8, chunk.size);
+        Store(entry.data() + 12, chunk.count);
+        Store(entry.data() + 16, chunk.first);
+        Append(entry);
+    }
+
+    std::array<std::byte, compressed_trace_footer_size> footer{};
+    Store(footer.data(), blocks_offset);
+    Store(footer.data() + 8, sequences_offset);
+    Store(footer.data() + 16, index_offset);
+    Store(footer.data() + 24, size_);
+    Store(footer.data() + 32, static_cast<std::uint32_t>(blocks_.size()));
+    Store(footer.data() + 36, static_cast<std::uint32_t>(sequences_.size()));
+    Store(footer.data() + 40, static_cast<std::uint32_t>(chunks_.size()));
+    Store(footer.data() + 44, compressed_trace_magic);
+    Append(footer);
+
+    CloseHandle(std::exchange(file_, INVALID_HANDLE_VALUE));
+}
+
+void CompressedTraceWriter::EndBlock() {
+    Fold(InternBlock());
+    block_length_ = 0;
+}
+
+std::uint32_t CompressedTraceWriter::InternBlock() {
+    const std::span current{ current_offsets_.data(), block_length_ };
+
+    const auto [begin, end]{ block_ids_.equal_range(block_hash_) };
+    for (auto i{ begin }; i != end; ++i) {
+        const auto& block{ blocks_[i->second] };
+        if (block.start == block_start_ && block.length == block_length_
+            && std::ranges::equal(
+                current, std::span{ block_offsets_.data() + block.begin,
+                                    block.length })) {
+            return i->second;
+        }
+    }
+
+    const auto id{ static_cast<std::uint32_t>(blocks_.size()) };
+    blocks_.push_back({ block_start_,
+                        static_cast<std::uint32_t>(block_offsets_.size()),
+                        block_length_ });
+    block_offsets_.insert(block_offsets_.cend(), current.begin(),
+                          current.end());
+    block_ids_.insert({ block_hash_, id });
+    return id;
+}
+
+std::uint32_t CompressedTraceWriter::InternSequence(
+    const std::span<const std::uint32_t> blocks) {
+    auto hash{ hash_basis };
+    for (const auto block : blocks) {
+        hash = Mix(hash, block);
+    }
+
+    const auto [begin, end]{ sequence_ids_.equal_range(hash) };
+    for (auto i{ begin }; i != end; ++i) {
+        const auto& sequence{ sequences_[i->second] };
+        if (std::ranges::equal(
+                blocks, std::span{ sequence_blocks_.data() + sequence.begin,
+                                   sequence.length })) {
+            return i->second;
+        }
+    }
+
+    std::uint64_t instruction_count{ 0 };
+    for (const auto block : blocks) {
+        instruction_count += blocks_[block].length;
+    }
+
+    const auto id{ static_cast<std::uint32_t>(sequences_.size()) };
+    sequences_.push_back({ static_cast<std::uint32_t>(sequence_blocks_.size()),
+                           static_cast<std::uint32_t>(blocks.size()),
+                           instruction_count });
+    sequence_blocks_.insert(sequence_blocks_.cend(), blocks.begin(),
+                            blocks.end());
+    sequence_ids_.insert({ hash, id });
+    return id;
+}
+
+void CompressedTraceWriter::Fold(const std::uint32_t block) {
+    if (in_run_) {
+        const auto& sequence{ sequences_[run_sequence_] };
+        if (sequence_blocks_[sequence.begin + run_position_] == block) {
+            if (++run_position_ == sequence.length) {
+                ++run_count_;
+                run_position_ = 0;
+            }
+
+            return;
+        }
+
+        EmitRun();
+    }
+
+    pending_.push_back(block);
+    while (pending_.size() >= fold_window_size && !in_run_) {
+        ParsePending();
+    }
+}
+
+void CompressedTraceWriter::ParsePending() {
+    // Find the sequence at the front covering the most blocks when repeated.
+    const auto size{ pending_.size() };
+    std::size_t best_period{ 0 };
+    std::size_t best_count{ 0 };
+    std::size_t best_partial{ 0 };
+    for (std::size_t period{ 1 };
+         period <= max_loop_period && period * 2 <= size; ++period) {
+        std::size_t matched{ period };
+        while (matched != size && pending_[matched] == pending_[matched % period]) {
+            ++matched;
+        }
+
+        const auto count{ matched / period };
+        if (count >= 2 && count * period > best_count * best_period) {
+            best_period = period;
+            best_count = count;
+            best_partial = matched % period;
+        }
+    }
+
+    if (best_count == 0) {
+        EmitPending(1);
+        return;
+    }
+
+    const auto sequence{ InternSequence({ pending_.data(), best_period }) };
+    if (best_count * best_period + best_partial == size) {
+        // The repetition may continue with later blocks.
+        run_sequence_ = sequence;
+        run_count_ = best_count;
+        run_position_ = static_cast<std::uint32_t>(best_partial);
+        in_run_ = true;
+        pending_.clear();
+    } else {
+        EmitToken(sequence, best_count);
+        pending_.erase(pending_.cbegin(),
+                       pending_.cbegin() + best_count * best_period);
+    }
+}
+
+void CompressedTraceWriter::EmitPending(const std::size_t count) {
+    for (std::size_t i{ 0 }; i != count; ++i) {
+        EmitToken(InternSequence({ &pending_[i], 1 }), 1);
+    }
+
+    pending_.erase(pending_.cbegin(), pending_.cbegin() + count);
+}
+
+void CompressedTraceWriter::EmitRun() {
+    if (!in_run_) {
+        return;
+    }
+
+    in_run_ = false;
+    EmitToken(run_sequence_, run_count_);
+
+    // The incomplete repetition is parsed again with later blocks.
+    const auto& sequence{ sequences_[run_sequence_] };
+    pending_.insert(pending_.cend(), sequence_blocks_.cbegin() + sequence.begin,
+                    sequence_blocks_.cbegin() + sequence.begin + run_position_);
+}
+
+void CompressedTraceWriter::EmitToken(const std::uint32_t sequence,
+                                      const std::uint64_t count) {
+    if (chunk_count_ == 0) {
+        chunk_first_ = emitted_;
+    }
+
+    auto* const buffer{ buffer_.data() + buffer_size_ };
+    auto size{ EncodeVarint(sequence, buffer) };
+    size += EncodeVarint(count, buffer + size);
+    buffer_size_ += size;
+
+    emitted_ += sequences_[sequence].instruction_count * count;
+
+    if (++chunk_count_ == chunk_size_) {
+        FlushChunk();
+    }
+}
+
+void CompressedTraceWriter::FlushChunk() {
+    if (chunk_count_ == 0) {
+        return;
+    }
+
+    chunks_.push_back({ offset_, static_cast<std::uint32_t>(buffer_size_),
+                        chunk_count_, chunk_first_ });
+    Append({ buffer_.data(), buffer_size_ });
+
+    buffer_size_ = 0;
+    chunk_count_ = 0;
+}
+
+void CompressedTraceWriter::Append(const std::span<const std::byte> data) {
+    DWORD written{ 0 };
+    if (!WriteFile(file_, data.data(), static_cast<DWORD>(data.size()),
+                   &written, nullptr)) {
+        ThrowLastError();
+    }
+
+    offset_ += written;
+}
\ No newline at end of file
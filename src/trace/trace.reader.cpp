@@ -0,0 +1,269 @@
+#include "error.h"
+#include "trace.h"
+
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+//! Load a little-endian integer.
+template <typename T>
+T Load(const std::span<const std::byte> data,
+       const std::size_t offset) noexcept {
+    T value{};
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+[[noreturn]] void ThrowCorrupted() {
+    throw std::runtime_error{ "The trace file is corrupted." };
+}
+
+//! Decode a varint, throwing an exception if it is invalid.
+std::uint64_t ReadVarint(std::span<const std::byte>& data) {
+    const auto value{ DecodeVarint(data) };
+    if (!value) {
+        ThrowCorrupted();
+    }
+
+    return *value;
+}
+
+}  // namespace
+
+
+TraceReader::TraceReader(const std::wstring_view file_path) {
+    file_ = CreateFileW(file_path.data(), GENERIC_READ, FILE_SHARE_READ,
+                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        ThrowLastError();
+    }
+
+    try {
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file_, &file_size)) {
+            ThrowLastError();
+        }
+
+        if (static_cast<std::uint64_t>(file_size.QuadPart) > SIZE_MAX) {
+            ThrowCorrupted();
+        }
+
+        const auto size{ static_cast<std::size_t>(file_size.QuadPart) };
+        if (size < trace_header_size + trace_footer_size) {
+            ThrowCorrupted();
+        }
+
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0,
+                                      nullptr);
+        if (!mapping_) {
+            ThrowLastError();
+        }
+
+        const auto view{ MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) };
+        if (!view) {
+            ThrowLastError();
+        }
+
+        view_ = { static_cast<const std::byte*>(view), size };
+
+        if (Load<std::uint32_t>(view_, 0) != trace_magic
+            || Load<std::uint16_t>(view_, 4) != trace_version) {
+            ThrowCorrupted();
+        }
+
+        content_ = Load<std::uint16_t>(view_, 6);
+        chunk_size_ = Load<std::uint32_t>(view_, 8);
+
+        const auto footer{ view_.last(trace_footer_size) };
+        const auto index_offset{ Load<std::uint64_t>(footer, 0) };
+        size_ = Load<std::uint64_t>(footer, 8);
+        chunk_count_ = Load<std::uint32_t>(footer, 16);
+
+        // The count is bounded before multiplying, so the index size cannot wrap in a 32-bit `std::size_t`.
+        const std::uint64_t index_end{ size - trace_footer_size };
+        if (Load<std::uint32_t>(footer, 20) != trace_magic || chunk_size_ == 0
+            || chunk_size_ > max_trace_chunk_size
+            || index_offset < trace_header_size || index_offset > index_end
+            || chunk_count_ > (index_end - index_offset) / trace_index_entry_size
+            || index_offset + std::uint64_t{ chunk_count_ } * trace_index_entry_size
+                   != index_end) {
+            ThrowCorrupted();
+        }
+
+        index_ = view_.subspan(static_cast<std::size_t>(index_offset),
+                               chunk_count_ * trace_index_entry_size);
+
+        // Every chunk except the last one is full, so records can be located without searching.
+        for (std::size_t i{ 0 }; i != chunk_count_; ++i) {
+            const auto offset{ Load<std::uint64_t>(
+                index_, i * trace_index_entry_size) };
+            const auto chunk_size{ Load<std::uint32_t>(
+                index_, i * trace_index_entry_size + 8) };
+            const auto count{ ChunkRecordCount(i) };
+            if (offset < trace_header_size || offset > index_offset
+                || chunk_size > index_offset - offset
+                || (i + 1 != chunk_count_ && count != chunk_size_)
+                || count > chunk_size_) {
+                ThrowCorrupted();
+            }
+        }
+
+        // The record count must match the chunks, otherwise seeking could run past the last record.
+        const auto expected_size{
+            chunk_count_ != 0
+                ? static_cast<std::uint64_t>(chunk_count_ - 1) * chunk_size_
+                      + ChunkRecordCount(chunk_count_ - 1)
+                : 0
+        };
+        if (size_ != expected_size) {
+            ThrowCorrupted();
+        }
+    } catch (...) {
+        Close();
+        throw;
+    }
+}
+
+TraceReader::~TraceReader() noexcept {
+    Close();
+}
+
+TraceReader::TraceReader(TraceReader&& reader) noexcept :
+    file_{ std::exchange(reader.file_, INVALID_HANDLE_VALUE) },
+    mapping_{ std::exchange(reader.mapping_, nullptr) },
+    view_{ std::exchange(reader.view_, {}) },
+    index_{ reader.index_ },
+    content_{ reader.content_ },
+    chunk_size_{ reader.chunk_size_ },
+    size_{ reader.size_ },
+    chunk_count_{ reader.chunk_count_ } {}
+
+std::uint16_t TraceReader::Content() const noexcept {
+    return content_;
+}
+
+std::uint64_t TraceReader::Size() const noexcept {
+    return size_;
+}
+
+std::size_t TraceReader::ChunkCount() const noexcept {
+    return chunk_count_;
+}
+
+TraceReader::Cursor TraceReader::Seek(const std::uint64_t index) const {
+    if (index >= size_) {
+        throw std::runtime_error{ std::format(
+            "The trace record {} is out of range.", index) };
+    }
+
+    Cursor cursor{ *this, static_cast<std::size_t>(index / chunk_size_) };
+    for (auto skip{ index % chunk_size_ }; skip != 0; --skip) {
+        cursor.Next();
+    }
+
+    return cursor;
+}
+
+TraceRecord TraceReader::At(const std::uint64_t index) const {
+    const auto record{ Seek(index).Next() };
+    if (!record) {
+        ThrowCorrupted();
+    }
+
+    return *record;
+}
+
+std::span<const std::byte> TraceReader::ChunkData(
+    const std::size_t chunk) const noexcept {
+    const auto offset{ Load<std::uint64_t>(index_,
+                                           chunk * trace_index_entry_size) };
+    const auto size{ Load<std::uint32_t>(index_,
+                                         chunk * trace_index_entry_size + 8) };
+    return view_.subspan(static_cast<std::size_t>(offset), size);
+}
+
+std::uint32_t TraceReader::ChunkRecordCount(
+    const std::size_t chunk) const noexcept {
+    return Load<std::uint32_t>(index_, chunk * trace_index_entry_size + 12);
+}
+
+void TraceReader::Close() noexcept {
+    if (!view_.empty()) {
+        UnmapViewOfFile(view_.data());
+        view_ = {};
+    }
+
+    if (mapping_) {
+        CloseHandle(std::exchange(mapping_, nullptr));
+    }
+
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(std::exchange(file_, INVALID_HANDLE_VALUE));
+    }
+}
+
+
+TraceReader::Cursor::Cursor(const TraceReader& reader,
+                            const std::size_t chunk) noexcept :
+    reader_{ &reader }, chunk_{ chunk } {
+    if (chunk_ < reader_->ChunkCount()) {
+        LoadChunk(chunk_);
+    }
+}
+
+std::optional<TraceRecord> TraceReader::Cursor::Next() {
+    while (remaining_ == 0) {
+        if (chunk_ + 1 >= reader_->ChunkCount()) {
+            return std::nullopt;
+        }
+
+        LoadChunk(chunk_ + 1);
+    }
+
+    --remaining_;
+    record_.index = index_++;
+
+    record_.address = static_cast<std::uint32_t>(
+        record_.address + ZigZagDecode(ReadVarint(data_)));
+
+    const auto content{ reader_->Content() };
+    if ((content & static_cast<std::uint16_t>(TraceContent::Registers)) != 0) {
+        const auto changed{ ReadVarint(data_) };
+        if (changed >> trace_register_count != 0) {
+            ThrowCorrupted();
+        }
+
+        record_.changed = static_cast<std::uint16_t>(changed);
+        for (std::size_t i{ 0 }; i != trace_register_count; ++i) {
+            if ((changed & (1 << i)) != 0) {
+                record_.registers[i] = static_cast<std::uint32_t>(
+                    record_.registers[i] + ZigZagDecode(ReadVarint(data_)));
+            }
+        }
+    }
+
+    if ((content & static_cast<std::uint16_t>(TraceContent::Memory)) != 0) {
+        if (const auto delta{ ReadVarint(data_) }; delta != 0) {
+            memory_ = static_cast<std::uint32_t>(memory_
+                                                 + ZigZagDecode(delta - 1));
+            record_.memory = memory_;
+        } else {
+            record_.memory = std::nullopt;
+        }
+    }
+
+    return record_;
+}
+
+void TraceReader::Cursor::LoadChunk(const std::size_t chunk) noexcept {
+    chunk_ = chunk;
+    remaining_ = reader_->ChunkRecordCount(chunk);
+    data_ = reader_->ChunkData(chunk);
+    index_ = static_cast<std::uint64_t>(chunk) * reader_->chunk_size_;
+    record_ = {};
+    memory_ = 0;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "trace.h"
+
+#include <limits>
+#include <stdexcept>
+
+
+namespace {
+
+/**
+ * @brief Create a trace file writer.
+ *
+ * @param file_path The trace file path.
+ * @param options Trace options.
+ */
+std::variant<TraceWriter, CompressedTraceWriter> CreateWriter(
+    const std::wstring_view file_path, const TraceOptions& options) {
+    if (!options.compress) {
+        return std::variant<TraceWriter, CompressedTraceWriter>{
+            std::in_place_type<TraceWriter>, file_path, options.content,
+            options.chunk_size
+        };
+    }
+
+    if (options.content != static_cast<std::uint16_t>(TraceContent::None)) {
+        throw std::runtime_error{
+            "Only instruction addresses can be recorded in a compressed trace."
+        };
+    }
+
+    return std::variant<TraceWriter, CompressedTraceWriter>{
+        std::in_place_type<CompressedTraceWriter>, file_path, options.chunk_size
+    };
+}
+
+}  // namespace
+
+
+Tracer::Tracer(const std::uint32_t process_id,
+               const std::wstring_view file_path, const TraceOptions& options) :
+    process_id_{ process_id },
+    options_{ options },
+    writer_{ CreateWriter(file_path, options) },
+    instructions_(instruction_cache_size) {}
+
+std::uint32_t Tracer::ProcessId() const noexcept {
+    return process_id_;
+}
+
+const TraceOptions& Tracer::Options() const noexcept {
+    return options_;
+}
+
+void Tracer::Write(const std::uintptr_t address,
+                   const TraceRegisters& registers,
+                   const std::optional<std::uintptr_t> memory) {
+    if (auto* const writer{ std::get_if<TraceWriter>(&writer_) }) {
+        writer->Write(address, registers, memory);
+    } else {
+        std::get<CompressedTraceWriter>(writer_).Write(address);
+    }
+}
+
+void Tracer::Close() {
+    std::visit([](auto& writer) { writer.Close(); }, writer_);
+}
+
+bool Tracer::InRange(const std::uintptr_t address) const noexcept {
+    return options_.begin <= address && address < options_.end;
+}
+
+bool Tracer::DecodesInstructions() const noexcept {
+    return (options_.content & static_cast<std::uint16_t>(TraceContent::Memory))
+               != 0
+           || options_.begin != 0
+           || options_.end != std::numeric_limits<std::uintptr_t>::max();
+}
+
+const Instruction* Tracer::FindInstruction(
+    const std::uintptr_t address) const noexcept {
+    const auto& instruction{
+        instructions_[address % instruction_cache_size]
+    };
+    return instruction.length != 0 && instruction.address == address
+               ? &instruction
+               : nullptr;
+}
+
+const Instruction& Tracer::CacheInstruction(
+    const Instruction& instruction) noexcept {
+    auto& entry{ instructions_[instruction.address % instruction_cache_size] };
+    entry = instruction;
+    return entry;
+}
+
+void Tracer::SetCall(const std::uintptr_t address,
+                     const std::uintptr_t frame) noexcept {
+    has_call_ = true;
+    call_address_ = address;
+    call_frame_ = frame;
+}
+
+bool Tracer::HasCall() const noexcept {
+    return has_call_;
+}
+
+std::uintptr_t Tracer::CallReturnAddress() const noexcept {
+    return call_address_;
+}
+
+void Tracer::ResetCall() noexcept {
+    has_call_ = false;
+}
+
+void Tracer::SkipCall() noexcept {
+    has_call_ = false;
+    skipping_ = true;
+}
+
+bool Tracer::Skipping() const noexcept {
+    return skipping_;
+}
+
+bool Tracer::ReachedSkip(const std::uintptr_t address,
+                         const std::uintptr_t stack) const noexcept {
+    return skipping_ && address == call_address_ && stack >= call_frame_;
+}
+
+void Tracer::ResetSkip() noexcept {
+    skipping_ = false;
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "error.h"
+#include "trace.h"
+
+#include <array>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+//! Store a little-endian integer.
+template <typename T>
+void Store(std::byte* const buffer, const T value) noexcept {
+    std::memcpy(buffer, &value, sizeof(value));
+}
+
+//! Whether the content of a trace contains a type.
+constexpr bool HasContent(const std::uint16_t content,
+                          const TraceContent type) noexcept {
+    return (content & static_cast<std::uint16_t>(type)) != 0;
+}
+
+}  // namespace
+
+
+TraceWriter::TraceWriter(const std::wstring_view file_path,
+                         const std::uint16_t content,
+                         const std::uint32_t chunk_size) :
+    file_{ INVALID_HANDLE_VALUE },
+    content_{ content },
+    chunk_size_{ chunk_size } {
+    if (chunk_size_ == 0 || chunk_size_ > max_trace_chunk_size) {
+        throw std::runtime_error{ std::format(
+            "The chunk size of a trace must be between 1 and {}.",
+            max_trace_chunk_size) };
+    }
+
+    buffer_.resize(chunk_size_ * max_trace_record_size);
+
+    file_ = CreateFileW(file_path.data(), GENERIC_WRITE, FILE_SHARE_READ,
+                        nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        ThrowLastError();
+    }
+
+    std::array<std::byte, trace_header_size> header{};
+    Store(header.data(), trace_magic);
+    Store(header.data() + 4, trace_version);
+    Store(header.data() + 6, content_);
+    Store(header.data() + 8, chunk_size_);
+    Append(header);
+}
+
+TraceWriter::~TraceWriter() noexcept {
+    try {
+        Close();
+    } catch (...) {
+    }
+}
+
+TraceWriter::TraceWriter(TraceWriter&& writer) noexcept :
+    file_{ std::exchange(writer.file_, INVALID_HANDLE_VALUE) },
+    content_{ writer.content_ },
+    chunk_size_{ writer.chunk_size_ },
+    buffer_{ std::move(writer.buffer_) },
+    buffer_size_{ writer.buffer_size_ },
+    chunk_count_{ writer.chunk_count_ },
+    offset_{ writer.offset_ },
+    size_{ writer.size_ },
+    chunks_{ std::move(writer.chunks_) },
+    address_{ writer.address_ },
+    registers_{ writer.registers_ },
+    memory_{ writer.memory_ } {}
+
+std::uint16_t TraceWriter::Content() const noexcept {
+    return content_;
+}
+
+std::uint64_t TraceWriter::Size() const noexcept {
+    return size_;
+}
+
+void TraceWriter::Write(const std::uintptr_t address,
+                        const TraceRegisters& registers,
+                        const std::optional<std::uintptr_t> memory) {
+    auto* const begin{ buffer_.data() + buffer_size_ };
+    auto* buffer{ begin };
+
+    const auto eip{ static_cast<std::uint32_t>(address) };
+    buffer += EncodeVarint(
+        ZigZagEncode(static_cast<std::int32_t>(eip - address_)), buffer);
+    address_ = eip;
+
+    if (HasContent(content_, TraceContent::Registers)) {
+        std::uint16_t changed{ 0 };
+        for (std::size_t i{ 0 }; i != trace_register_count; ++i) {
+            if (registers[i] != registers_[i]) {
+                changed |= 1 << i;
+            }
+        }
+
+        buffer += EncodeVarint(changed, buffer);
+        for (std::size_t i{ 0 }; i != trace_register_count; ++i) {
+            if ((changed & (1 << i)) != 0) {
+                buffer += EncodeVarint(
+                    ZigZagEncode(
+                        static_cast<std::int32_t>(registers[i] - registers_[i])),
+                    buffer);
+            }
+        }
+
+        registers_ = registers;
+    }
+
+    if (HasContent(content_, TraceContent::Memory)) {
+        if (memory) {
+            const auto operand{ static_cast<std::uint32_t>(*memory) };
+            buffer += EncodeVarint(
+                ZigZagEncode(static_cast<std::int32_t>(operand - memory_)) + 1,
+                buffer);
+            memory_ = operand;
+        } else {
+            buffer += EncodeVarint(0, buffer);
+        }
+    }
+
+    buffer_size_ += buffer - begin;
+    ++size_;
+
+    if (++chunk_count_ == chunk_size_) {
+        FlushChunk();
+    }
+}
+
+void TraceWriter::Close() {
+    if (file_ == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    FlushChunk();
+
+    const auto index_offset{ offset_ };
+    std::array<std::byte, trace_index_entry_size> entry{};
+    for (const auto& chunk : chunks_) {
+        Store(entry.data(), chunk.offset);
+        Store(entry.data() + 8, chunk.size);
+        Store(entry.data() + 12, chunk.count);
+        Append(entry);
+    }
+
+    std::array<std::byte, trace_footer_size> footer{};
+    Store(footer.data(), index_offset);
+    Store(footer.data() + 8, size_);
+    Store(footer.data() + 16, static_cast<std::uint32_t>(chunks_.size()));
+    Store(footer.data() + 20, trace_magic);
+    Append(footer);
+
+    CloseHandle(std::exchange(file_, INVALID_HANDLE_VALUE));
+}
+
+void TraceWriter::FlushChunk() {
+    if (chunk_count_ == 0) {
+        return;
+    }
+
+    chunks_.push_back({ offset_, static_cast<std::uint32_t>(buffer_size_),
+                        chunk_count_ });
+    Append({ buffer_.data(), buffer_size_ });
+
+    buffer_size_ = 0;
+    chunk_count_ = 0;
+    address_ = 0;
+    registers_ = {};
+    memory_ = 0;
+}
+
+void TraceWriter::Append(const std::span<const std::byte> data) {
+    DWORD written{ 0 };
+    if (!WriteFile(file_, data.data(), static_cast<DWORD>(data.size()),
+                   &written, nullptr)) {
+        ThrowLastError();
+    }
+
+    offset_ += written;
+}
\ No newline at end of file
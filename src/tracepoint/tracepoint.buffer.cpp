@@ -0,0 +1,48 @@
+#include "tracepoint.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+
+TracepointBuffer::TracepointBuffer(const std::size_t capacity) :
+    records_(capacity) {
+    if (capacity == 0) {
+        throw std::runtime_error{
+            "The capacity of a tracepoint buffer cannot be zero."
+        };
+    }
+}
+
+TracepointRecord& TracepointBuffer::Push() noexcept {
+    auto& record{ records_[count_ % records_.size()] };
+    record.sequence = count_++;
+    return record;
+}
+
+const TracepointRecord& TracepointBuffer::operator[](
+    const std::size_t index) const noexcept {
+    assert(index < Size());
+    return records_[(Overwritten() + index) % records_.size()];
+}
+
+std::size_t TracepointBuffer::Capacity() const noexcept {
+    return records_.size();
+}
+
+std::size_t TracepointBuffer::Size() const noexcept {
+    return static_cast<std::size_t>(
+        std::min<std::uint64_t>(count_, records_.size()));
+}
+
+std::uint64_t TracepointBuffer::Count() const noexcept {
+    return count_;
+}
+
+std::uint64_t TracepointBuffer::Overwritten() const noexcept {
+    return count_ - Size();
+}
+
+void TracepointBuffer::Clear() noexcept {
+    count_ = 0;
+}
\ No newline at end of file
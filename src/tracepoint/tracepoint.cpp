@@ -0,0 +1,31 @@
+#include "tracepoint.h"
+
+
+std::size_t Tracepoint::PayloadSize() const noexcept {
+    return memory.empty()
+               ? std::popcount(registers) * sizeof(std::uint32_t)
+               : memory.back().offset + memory.back().size;
+}
+
+std::optional<std::uint32_t> Tracepoint::Register(
+    const TracepointRecord& record, const RegisterIndex index) const noexcept {
+    if (!Captures(index)) {
+        return std::nullopt;
+    }
+
+    const auto offset{ std::popcount(registers & (RegisterBit(index) - 1))
+                       * sizeof(std::uint32_t) };
+    std::uint32_t value{ 0 };
+    std::memcpy(&value, record.payload.data() + offset, sizeof(value));
+    return value;
+}
+
+std::span<const std::byte> Tracepoint::Memory(
+    const TracepointRecord& record, const std::size_t index) const noexcept {
+    if (index >= memory.size()) {
+        return {};
+    }
+
+    const auto& slice{ memory[index] };
+    return std::span{ record.payload }.subspan(slice.offset, slice.size);
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "tracepoint.h"
+
+#include <charconv>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+
+namespace {
+
+//! Remove leading and trailing whitespace.
+std::string_view Trim(const std::string_view text) noexcept {
+    const auto begin{ text.find_first_not_of(" \t") };
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+
+    const auto end{ text.find_last_not_of(" \t") };
+    return text.substr(begin, end - begin + 1);
+}
+
+//! Parse a decimal or hexadecimal number prefixed with `0x`.
+std::optional<std::uint32_t> ParseNumber(std::string_view text) noexcept {
+    auto base{ 10 };
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        text.remove_prefix(2);
+        base = 16;
+    }
+
+    std::uint32_t value{ 0 };
+    const auto end{ text.data() + text.size() };
+    const auto [last, error]{ std::from_chars(text.data(), end, value, base) };
+    return !text.empty() && error == std::errc{} && last == end
+               ? std::make_optional(value)
+               : std::nullopt;
+}
+
+/**
+ * @brief Throw an exception for an invalid memory expression.
+ *
+ * @param expression The expression.
+ * @param reason The reason.
+ */
+[[noreturn]] void ThrowInvalidMemory(const std::string_view expression,
+                                     const std::string_view reason) {
+    throw std::runtime_error{ std::format(
+        "Invalid tracepoint memory expression '{}': {}.", expression, reason) };
+}
+
+/**
+ * @brief Add a term of a memory expression to an operand.
+ *
+ * @param operand The memory operand.
+ * @param term A displacement, a register or a scaled register such as `esi*4`.
+ * @param negative Whether the term is subtracted.
+ * @param expression The whole expression, used in error messages.
+ */
+void AddMemoryTerm(MemoryOperand& operand, const std::string_view term,
+                   const bool negative, const std::string_view expression) {
+    if (const auto number{ ParseNumber(term) }) {
+        const auto displacement{ static_cast<std::uint32_t>(
+            operand.displacement) };
+        operand.displacement = static_cast<std::int32_t>(
+            negative ? displacement - *number : displacement + *number);
+        return;
+    }
+
+    if (negative) {
+        ThrowInvalidMemory(expression, "registers cannot be subtracted");
+    }
+
+    std::string_view name{ term };
+    std::uint32_t scale{ 1 };
+    if (const auto star{ term.find('*') }; star != std::string_view::npos) {
+        auto left{ Trim(term.substr(0, star)) };
+        auto right{ Trim(term.substr(star + 1)) };
+        if (ParseNumber(left)) {
+            std::swap(left, right);
+        }
+
+        const auto factor{ ParseNumber(right) };
+        if (!factor
+            || (*factor != 1 && *factor != 2 && *factor != 4 && *factor != 8)) {
+            ThrowInvalidMemory(expression, "the scale must be 1, 2, 4 or 8");
+        }
+
+        name = left;
+        scale = *factor;
+    }
+
+    const auto index{ ParseRegisterIndex(name) };
+    if (!index || !IsGeneralRegister(*index) || *index == RegisterIndex::EIP) {
+        ThrowInvalidMemory(expression,
+                           std::format("'{}' is not a general register", name));
+    }
+
+    if (scale == 1 && !operand.base) {
+        operand.base = index;
+    } else if (!operand.index) {
+        operand.index = index;
+        operand.scale = static_cast<std::uint8_t>(scale);
+    } else {
+        ThrowInvalidMemory(expression, "too many registers");
+    }
+}
+
+}  // namespace
+
+
+TracepointMemory ParseTracepointMemory(const std::string_view expression) {
+    const auto text{ Trim(expression) };
+    const auto close{ text.find(']') };
+    if (!text.starts_with('[') || close == std::string_view::npos) {
+        ThrowInvalidMemory(expression, "it must be enclosed in brackets");
+    }
+
+    TracepointMemory memory{};
+    if (const auto suffix{ Trim(text.substr(close + 1)) }; !suffix.empty()) {
+        if (!suffix.starts_with(':')) {
+            ThrowInvalidMemory(expression,
+                               std::format("unexpected '{}'", suffix));
+        }
+
+        const auto size{ ParseNumber(Trim(suffix.substr(1))) };
+        if (!size || *size == 0 || *size > tracepoint_payload_size) {
+            ThrowInvalidMemory(
+                expression,
+                std::format("the size must be between 1 and {}",
+                            tracepoint_payload_size));
+        }
+
+        memory.size = static_cast<std::uint16_t>(*size);
+    }
+
+    auto body{ text.substr(1, close - 1) };
+    auto negative{ false };
+    while (true) {
+        const auto next{ body.find_first_of("+-") };
+        const auto term{ Trim(body.substr(0, next)) };
+        if (term.empty()) {
+            ThrowInvalidMemory(expression, "a term is missing");
+        }
+
+        AddMemoryTerm(memory.operand, term, negative, expression);
+        if (next == std::string_view::npos) {
+            break;
+        }
+
+        negative = body[next] == '-';
+        body.remove_prefix(next + 1);
+    }
+
+    return memory;
+}
+
+Tracepoint ParseTracepoint(const std::uintptr_t address,
+                           const std::string_view declaration) {
+    Tracepoint tracepoint{ .address = address };
+
+    auto rest{ declaration };
+    while (true) {
+        const auto comma{ rest.find(',') };
+        const auto item{ Trim(rest.substr(0, comma)) };
+        if (item.empty()) {
+            throw std::runtime_error{ std::format(
+                "The tracepoint declaration '{}' has an empty item.",
+                declaration) };
+        }
+
+        if (item.starts_with('[')) {
+            if (tracepoint.memory.size() == max_tracepoint_memory_count) {
+                throw std::runtime_error{ std::format(
+                    "A tracepoint can capture at most {} memory slices.",
+                    max_tracepoint_memory_count) };
+            }
+
+            tracepoint.memory.push_back(ParseTracepointMemory(item));
+
+        } else if (const auto index{ ParseRegisterIndex(item) };
+                   index && IsGeneralRegister(*index)) {
+            tracepoint.registers |= Tracepoint::RegisterBit(*index);
+
+        } else {
+            throw std::runtime_error{ std::format(
+                "'{}' is not a register that tracepoints can capture.", item) };
+        }
+
+        if (comma == std::string_view::npos) {
+            break;
+        }
+
+        rest.remove_prefix(comma + 1);
+    }
+
+    std::size_t offset{ std::popcount(tracepoint.registers)
+                        * sizeof(std::uint32_t) };
+    for (auto& memory : tracepoint.memory) {
+        memory.offset = static_cast<std::uint16_t>(offset);
+        offset += memory.size;
+    }
+
+    if (offset > tracepoint_payload_size) {
+        throw std::runtime_error{ std::format(
+            "The tracepoint captures {} bytes, more than the limit of {}.",
+            offset, tracepoint_payload_size) };
+    }
+
+    return tracepoint;
+}
\ No newline at end of file
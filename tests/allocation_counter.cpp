@@ -0,0 +1,51 @@
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+namespace {
+
+std::atomic<bool> counting{ false };
+
+std::atomic<std::size_t> allocations{ 0 };
+
+std::atomic<std::size_t> bytes{ 0 };
+
+}  // namespace
+
+
+void CountAllocations(const bool enabled) noexcept {
+    counting = enabled;
+}
+
+std::size_t CountedAllocations() noexcept {
+    return allocations;
+}
+
+std::size_t CountedBytes() noexcept {
+    return bytes;
+}
+
+
+void* operator new(const std::size_t size) {
+    if (counting) {
+        ++allocations;
+        bytes += size;
+    }
+
+    if (const auto memory{ std::malloc(size != 0 ? size : 1) }) {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* const memory, std::size_t) noexcept {
+    std::free(memory);
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+/**
+ * @file allocation_counter.h
+ * @brief A global allocation counter, replacing global @p operator new.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <cstddef>
+
+
+//! Start or stop counting allocations.
+void CountAllocations(bool enabled) noexcept;
+
+//! Get the number of allocations counted so far.
+std::size_t CountedAllocations() noexcept;
+
+//! Get the number of bytes allocated so far.
+std::size_t CountedBytes() noexcept;
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "attach_debugger.h"
+#include "allocation_counter.h"
+#include "error.h"
+
+#include <filesystem>
+#include <format>
+#include <string>
+
+
+AttachDebugger::AttachDebugger(const std::size_t threads,
+                               const bool fast) noexcept :
+    threads_{ threads }, fast_{ fast } {}
+
+void AttachDebugger::Run() {
+    // The debuggee signals the inherited event when its idle threads have been created.
+    SECURITY_ATTRIBUTES attributes{ .nLength = sizeof(attributes),
+                                    .bInheritHandle = true };
+    const auto ready{ CreateEventW(&attributes, true, false, nullptr) };
+    if (!ready) {
+        ThrowLastError();
+    }
+
+    std::wstring cmd_line{ std::format(L"\"{}\" 0 {} {}", debuggee_path,
+                                       threads_,
+                                       reinterpret_cast<std::uintptr_t>(ready)) };
+    STARTUPINFOW startup{ .cb = sizeof(startup) };
+    PROCESS_INFORMATION process{};
+    const auto created{ CreateProcessW(
+        debuggee_path, cmd_line.data(), nullptr, nullptr, true,
+        CREATE_NEW_CONSOLE, nullptr,
+        std::filesystem::current_path().wstring().c_str(), &startup,
+        &process) };
+    if (!created) {
+        CloseHandle(ready);
+        ThrowLastError();
+    }
+
+    const auto started{ WaitForSingleObject(ready, INFINITE) == WAIT_OBJECT_0 };
+    CloseHandle(ready);
+    CloseHandle(process.hThread);
+    if (!started) {
+        TerminateProcess(process.hProcess, EXIT_FAILURE);
+        CloseHandle(process.hProcess);
+        ThrowLastError();
+    }
+
+    CountAllocations(true);
+    attach_bytes_ = CountedBytes();
+    attach_time_ = std::chrono::steady_clock::now();
+    try {
+        Attach(process.dwProcessId, fast_);
+        Start();
+    } catch (...) {
+        CountAllocations(false);
+        TerminateProcess(process.hProcess, EXIT_FAILURE);
+        CloseHandle(process.hProcess);
+        throw;
+    }
+
+    CountAllocations(false);
+    CloseHandle(process.hProcess);
+}
+
+std::chrono::steady_clock::duration AttachDebugger::TimeToFirstCommand()
+    const noexcept {
+    return first_command_time_;
+}
+
+std::size_t AttachDebugger::BytesToFirstCommand() const noexcept {
+    return first_command_bytes_;
+}
+
+std::size_t AttachDebugger::CreatedThreads() const noexcept {
+    return created_threads_;
+}
+
+const std::vector<std::string>& AttachDebugger::Errors() const noexcept {
+    return errors_;
+}
+
+void AttachDebugger::cbCreateThread(const CREATE_THREAD_DEBUG_INFO& details,
+                                    const Thread& thread) {
+    if (!stopped_) {
+        ++created_threads_;
+    }
+}
+
+void AttachDebugger::cbSystemBreakpoint(const Process& process) {
+    if (stopped_) {
+        return;
+    }
+
+    first_command_time_ = std::chrono::steady_clock::now() - attach_time_;
+    first_command_bytes_ = CountedBytes() - attach_bytes_;
+    stopped_ = true;
+    Stop();
+}
+
+void AttachDebugger::cbInternalLoopError(const std::exception& error) {
+    errors_.emplace_back(error.what());
+}
\ No newline at end of file
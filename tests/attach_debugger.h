@@ -0,0 +1,81 @@
+/**
+ * @file attach_debugger.h
+ * @brief A debugger measuring how long attaching to the test debuggee takes.
+ *
+ * @details
+ * The debuggee is started with idle threads and waits to be attached.
+ * The first command can be issued at its system breakpoint,
+ * where the process is terminated.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "debuggee.h"
+#include "debugger.h"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+
+class AttachDebugger : public Debugger {
+public:
+    /**
+     * @param threads The number of idle threads in the debuggee.
+     * @param fast Whether to attach in fast-attach mode.
+     */
+    AttachDebugger(std::size_t threads, bool fast) noexcept;
+
+    //! Start the debuggee, attach to it and run the debug loop until it is terminated.
+    void Run();
+
+    //! Get the time from attaching to the system breakpoint.
+    std::chrono::steady_clock::duration TimeToFirstCommand() const noexcept;
+
+    //! Get the bytes allocated from attaching to the system breakpoint.
+    std::size_t BytesToFirstCommand() const noexcept;
+
+    //! Get the number of create-thread callbacks before the system breakpoint.
+    std::size_t CreatedThreads() const noexcept;
+
+    //! Get the errors reported by the debug loop.
+    const std::vector<std::string>& Errors() const noexcept;
+
+protected:
+    void cbCreateThread(const CREATE_THREAD_DEBUG_INFO& details,
+                        const Thread& thread) override;
+
+    void cbSystemBreakpoint(const Process& process) override;
+
+    void cbInternalLoopError(const std::exception& error) override;
+
+private:
+    std::size_t threads_;
+
+    bool fast_;
+
+    bool stopped_{ false };
+
+    std::chrono::steady_clock::time_point attach_time_{};
+
+    std::chrono::steady_clock::duration first_command_time_{};
+
+    std::size_t attach_bytes_{ 0 };
+
+    std::size_t first_command_bytes_{ 0 };
+
+    std::size_t created_threads_{ 0 };
+
+    std::vector<std::string> errors_{};
+};
\ No newline at end of file
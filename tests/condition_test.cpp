@@ -0,0 +1,147 @@
+#include "condition.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+//! A thread state with 256 bytes of memory at address zero.
+class FakeContext : public ConditionContext {
+public:
+    std::uint32_t ReadRegister(const RegisterIndex index) const noexcept override {
+        return registers[static_cast<std::size_t>(index)];
+    }
+
+    bool ReadMemory(const std::uintptr_t address,
+                    const std::span<std::byte> buffer) noexcept override {
+        if (address > memory.size() || buffer.size() > memory.size() - address) {
+            return false;
+        }
+
+        std::memcpy(buffer.data(), memory.data() + address, buffer.size());
+        return true;
+    }
+
+    std::array<std::uint32_t, static_cast<std::size_t>(RegisterIndex::EFLAGS) + 1>
+        registers{};
+
+    std::array<std::byte, 0x100> memory{};
+};
+
+class ConditionTest : public testing::Test {
+protected:
+    void SetUp() override {
+        context_.registers[static_cast<std::size_t>(RegisterIndex::EAX)] = 5;
+        context_.registers[static_cast<std::size_t>(RegisterIndex::ESP)] = 0x10;
+        const std::uint32_t value{ 0x2000 };
+        std::memcpy(context_.memory.data() + 0x18, &value, sizeof(value));
+    }
+
+    std::optional<std::uint32_t> Evaluate(const std::string_view expression) {
+        return Condition{ expression }.Evaluate(context_);
+    }
+
+    FakeContext context_{};
+};
+
+}  // namespace
+
+
+TEST_F(ConditionTest, Arithmetic) {
+    EXPECT_EQ(Evaluate("2 * 3 + 4 * 5 == 26"), 1);
+    EXPECT_EQ(Evaluate("-1"), 0xFFFFFFFF);
+    EXPECT_EQ(Evaluate("~0 == 0xFFFFFFFF"), 1);
+    EXPECT_EQ(Evaluate("0xFFFFFFFF + 1"), 0);
+    EXPECT_EQ(Evaluate("7 / 2 + 7 % 2"), 4);
+    EXPECT_EQ(Evaluate("1 << 40"), 0);
+
+    // Values are unsigned.
+    EXPECT_EQ(Evaluate("3 - 5 < 0"), 0);
+
+    // `==` binds tighter than `&`.
+    EXPECT_EQ(Evaluate("eax & 4 == 4"), 1);
+    EXPECT_EQ(Evaluate("(eax & 4) == 4"), 1);
+}
+
+TEST_F(ConditionTest, Registers) {
+    EXPECT_EQ(Evaluate("eax"), 5);
+    EXPECT_EQ(Evaluate("EAX == 5"), 1);
+    EXPECT_EQ(Evaluate("!eax"), 0);
+    EXPECT_EQ(Evaluate("!!eax"), 1);
+    EXPECT_EQ(Evaluate("eflags"), 0);
+}
+
+TEST_F(ConditionTest, Memory) {
+    EXPECT_EQ(Evaluate("[esp + 8]"), 0x2000);
+    EXPECT_EQ(Evaluate("dword[esp + 8] > 0x1000"), 1);
+    EXPECT_EQ(Evaluate("WORD[esp + 9]"), 0x20);
+    EXPECT_EQ(Evaluate("byte[esp + 8]"), 0);
+
+    // Memory that cannot be read fails the evaluation.
+    EXPECT_FALSE(Evaluate("[[esp + 8]]"));
+    EXPECT_FALSE(Evaluate("[0xFF]"));
+}
+
+TEST_F(ConditionTest, ShortCircuit) {
+    EXPECT_EQ(Evaluate("eax == 5 || 1 / 0"), 1);
+    EXPECT_EQ(Evaluate("ecx && [0x1000]"), 0);
+    EXPECT_EQ(Evaluate("eax || [0x1000]"), 1);
+    EXPECT_FALSE(Evaluate("ecx || [0x1000]"));
+    EXPECT_EQ(Evaluate("eax && ecx || eax"), 1);
+
+    // Logical results are booleans.
+    EXPECT_EQ(Evaluate("0 || eax"), 1);
+}
+
+TEST_F(ConditionTest, ConstantFolding) {
+    // A constant is a single instruction with a 32-bit immediate.
+    EXPECT_EQ(Condition{ "2 * 3 + 4 * 5 == 26" }.Bytecode().size(), 5);
+    EXPECT_EQ(Condition{ "1 || [0x1000]" }.Bytecode().size(), 5);
+    EXPECT_EQ(Condition{ "0 && eax" }.Bytecode().size(), 5);
+}
+
+TEST_F(ConditionTest, Errors) {
+    EXPECT_FALSE(Evaluate("1 / 0"));
+    EXPECT_FALSE(Evaluate("1 % 0"));
+
+    const Condition failed{ "[0x1000] == 0" };
+    EXPECT_TRUE(failed.Matches(context_));
+    EXPECT_FALSE(Condition{ "eax == 4" }.Matches(context_));
+}
+
+TEST_F(ConditionTest, InvalidExpressions) {
+    for (const auto expression :
+         { "", "eax =", "eax = 5", "eax ==", "(eax", "[eax", "0x", "12abc",
+           "4294967296", "dr7", "a && b", "byte", "eax $ 1" }) {
+        EXPECT_THROW(Condition{ expression }, std::runtime_error) << expression;
+    }
+}
+
+TEST_F(ConditionTest, Nesting) {
+    const std::size_t depth{ max_condition_nesting_depth - 1 };
+    const auto nested{ std::string(depth, '(') + "eax" + std::string(depth, ')') };
+    EXPECT_EQ(Evaluate(nested), 5);
+
+    const auto deep{ std::string(100000, '(') + "1" + std::string(100000, ')') };
+    EXPECT_THROW(Condition{ deep }, std::runtime_error);
+
+    EXPECT_THROW(Condition{ std::string(100000, '!') + "1" }, std::runtime_error);
+}
+
+TEST_F(ConditionTest, StackDepth) {
+    // Each nested right operand keeps its left operand on the stack.
+    std::string expression{ "1" };
+    for (std::size_t i{ 0 }; i != max_condition_stack_depth; ++i) {
+        expression = "eax + (" + expression + ")";
+    }
+
+    EXPECT_THROW(Condition{ expression }, std::runtime_error);
+}
\ No newline at end of file
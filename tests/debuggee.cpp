@@ -0,0 +1,74 @@
+/*
+ * A process debugged by tests.
+ * It calls an exported function through nested calls, so stack walks cross several frames.
+ * Its arguments are:
+ *   1. The number of calls to an exported function.
+ *   2. The number of idle threads, which are created before the calls. (optional)
+ *   3. The handle of an inherited event.
+ *      If it is given, the event is signaled after creating idle threads,
+ *      and the process waits to be attached instead of making calls. (optional)
+ */
+
+#include <Windows.h>
+
+#include <cstdlib>
+
+
+extern "C" __declspec(dllexport) __declspec(noinline) int Work(const int value) {
+    return value * 3 + 1;
+}
+
+namespace {
+
+//! The stack reserved for each idle thread, so a 32-bit process can hold thousands of them.
+constexpr SIZE_T idle_stack_size{ 0x10000 };
+
+//! The number of nested calls above each call to `Work`.
+constexpr int call_depth{ 16 };
+
+// The call cannot be inlined through a volatile pointer.
+int (*volatile const work)(int){ &Work };
+
+DWORD WINAPI Idle(LPVOID) {
+    Sleep(INFINITE);
+    return 0;
+}
+
+__declspec(noinline) int Nest(const int depth, const int value) {
+    // Reading a volatile local after the call keeps it from becoming a jump or a loop.
+    volatile auto frame{ depth };
+    return (depth == 0 ? work(value) : Nest(depth - 1, value)) + frame;
+}
+
+}  // namespace
+
+
+int main(const int argc, const char* const argv[]) {
+    const auto count{ argc > 1 ? std::atoi(argv[1]) : 0 };
+    const auto threads{ argc > 2 ? std::atoi(argv[2]) : 0 };
+    for (auto i{ 0 }; i != threads; ++i) {
+        const auto thread{ CreateThread(nullptr, idle_stack_size, &Idle, nullptr,
+                                        STACK_SIZE_PARAM_IS_A_RESERVATION,
+                                        nullptr) };
+        if (!thread) {
+            return EXIT_FAILURE;
+        }
+
+        CloseHandle(thread);
+    }
+
+    if (argc > 3) {
+        const auto ready{ reinterpret_cast<HANDLE>(
+            std::strtoull(argv[3], nullptr, 10)) };
+        SetEvent(ready);
+        CloseHandle(ready);
+        Sleep(INFINITE);
+    }
+
+    volatile auto value{ 0 };
+    for (auto i{ 0 }; i != count; ++i) {
+        value = Nest(call_depth, value);
+    }
+
+    return 0;
+}
\ No newline at end of file
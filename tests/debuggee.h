@@ -0,0 +1,19 @@
+/**
+ * @file debuggee.h
+ * @brief The test debuggee, built from `debuggee.cpp`.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+
+//! The path of the test debuggee.
+inline constexpr const wchar_t* debuggee_path{ DEBUGGEE_PATH };
\ No newline at end of file
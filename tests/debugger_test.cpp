@@ -0,0 +1,70 @@
+#include "attach_debugger.h"
+#include "hit_debugger.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+
+namespace {
+
+//! The number of calls made by the debuggee.
+constexpr std::size_t call_count{ 1000 };
+
+//! Hits before the debug loop reaches a steady state.
+constexpr std::size_t warmup_hits{ 10 };
+
+//! Get the allocations made by the debug loop after the warmup hits.
+std::size_t SteadyAllocations(const HitDebugger& debugger) noexcept {
+    const auto& samples{ debugger.Samples() };
+    return samples.size() > warmup_hits
+               ? samples.back().allocations - samples[warmup_hits].allocations
+               : 0;
+}
+
+}  // namespace
+
+
+TEST(DebuggerTest, BreakpointHitsDoNotAllocate) {
+    HitDebugger debugger{ call_count, false };
+    debugger.Run();
+
+    EXPECT_TRUE(debugger.Errors().empty());
+    EXPECT_EQ(debugger.Samples().size(), call_count - 1);
+    EXPECT_EQ(debugger.Callbacks(), call_count);
+    EXPECT_EQ(SteadyAllocations(debugger), 0);
+}
+
+TEST(DebuggerTest, FilteredBreakpointHitsDoNotAllocate) {
+    HitDebugger debugger{ call_count, true };
+    debugger.Run();
+
+    // Only the first hit calls the callback, which excludes every thread.
+    EXPECT_TRUE(debugger.Errors().empty());
+    EXPECT_EQ(debugger.Samples().size(), call_count - 1);
+    EXPECT_EQ(debugger.Callbacks(), 1);
+    EXPECT_EQ(SteadyAllocations(debugger), 0);
+}
+
+TEST(DebuggerTest, FastAttachReportsThreadsAtFirstCommand) {
+    constexpr std::size_t thread_count{ 16 };
+    AttachDebugger debugger{ thread_count, true };
+    debugger.Run();
+
+    // Deferred create-thread callbacks are made before the system breakpoint.
+    EXPECT_TRUE(debugger.Errors().empty());
+    EXPECT_GE(debugger.CreatedThreads(), thread_count);
+    EXPECT_GT(debugger.TimeToFirstCommand().count(), 0);
+}
+
+TEST(DebuggerTest, FrozenBreakpointHitsDoNotAllocate) {
+    constexpr std::size_t thread_count{ 16 };
+    HitDebugger debugger{ call_count, false, thread_count, true };
+    debugger.Run();
+
+    // Freezing and thawing other threads reuses its bookkeeping.
+    EXPECT_TRUE(debugger.Errors().empty());
+    EXPECT_EQ(debugger.Samples().size(), call_count - 1);
+    EXPECT_EQ(debugger.Callbacks(), call_count);
+    EXPECT_EQ(SteadyAllocations(debugger), 0);
+}
\ No newline at end of file
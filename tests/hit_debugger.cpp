@@ -0,0 +1,66 @@
+#include "hit_debugger.h"
+#include "allocation_counter.h"
+
+#include <array>
+#include <filesystem>
+#include <format>
+
+
+HitDebugger::HitDebugger(const std::size_t calls, const bool filtered,
+                         const std::size_t threads, const bool freeze_others) :
+    calls_{ calls }, filtered_{ filtered }, threads_{ threads } {
+    // Samples are reserved, so taking them does not allocate.
+    samples_.reserve(calls_);
+    SetFreezeOthers(freeze_others);
+
+    SetModuleBreakpoint(
+        { .module = std::filesystem::path{ debuggee_path }.filename().wstring(),
+          .function = "Work",
+          .callback = [this](const Breakpoint& breakpoint) {
+              ++callbacks_;
+              target_ = breakpoint.address;
+              if (filtered_) {
+                  // No thread has the ID zero.
+                  constexpr std::array<std::uint32_t, 1> nobody{ 0 };
+                  DebuggedProcess().SetBreakpointThreads(
+                      { BreakpointType::Software, breakpoint.address }, nobody);
+              }
+          } });
+}
+
+void HitDebugger::Run() {
+    const auto cmd_line{ std::format(L"\"{}\" {} {}", debuggee_path, calls_,
+                                     threads_) };
+    Create(debuggee_path, cmd_line, std::filesystem::current_path().wstring(),
+           false);
+
+    CountAllocations(true);
+    Start();
+    CountAllocations(false);
+}
+
+const std::vector<HitDebugger::Sample>& HitDebugger::Samples() const noexcept {
+    return samples_;
+}
+
+std::size_t HitDebugger::Callbacks() const noexcept {
+    return callbacks_;
+}
+
+const std::vector<std::string>& HitDebugger::Errors() const noexcept {
+    return errors_;
+}
+
+void HitDebugger::cbPreException(const EXCEPTION_RECORD& record,
+                                 const bool first_chance) {
+    if (record.ExceptionCode == STATUS_BREAKPOINT
+        && reinterpret_cast<std::uintptr_t>(record.ExceptionAddress) == target_
+        && samples_.size() != samples_.capacity()) {
+        samples_.push_back(
+            { CountedAllocations(), std::chrono::steady_clock::now() });
+    }
+}
+
+void HitDebugger::cbInternalLoopError(const std::exception& error) {
+    errors_.emplace_back(error.what());
+}
\ No newline at end of file
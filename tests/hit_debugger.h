@@ -0,0 +1,87 @@
+/**
+ * @file hit_debugger.h
+ * @brief A debugger sampling the breakpoint hits of the test debuggee.
+ *
+ * @details
+ * The debuggee calls its exported function `Work` in a loop,
+ * where a module breakpoint is set.
+ * Hits are sampled after the first one, which reports the breakpoint address.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include "debuggee.h"
+#include "debugger.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+
+class HitDebugger : public Debugger {
+public:
+    //! A sample taken when the breakpoint is hit.
+    struct Sample {
+        //! The number of allocations so far.
+        std::size_t allocations;
+
+        std::chrono::steady_clock::time_point time;
+    };
+
+    /**
+     * @param calls The number of calls made by the debuggee.
+     * @param filtered
+     * Whether to exclude every thread from the breakpoint after the first hit,
+     * so later hits are stepped over without calling callbacks.
+     * @param threads The number of idle threads in the debuggee.
+     * @param freeze_others Whether to freeze other threads during internal steps.
+     */
+    HitDebugger(std::size_t calls, bool filtered, std::size_t threads = 0,
+                bool freeze_others = false);
+
+    //! Run the debuggee to its exit, counting allocations.
+    void Run();
+
+    //! Get the samples of hits, excluding the first one.
+    const std::vector<Sample>& Samples() const noexcept;
+
+    //! Get the number of breakpoint callbacks.
+    std::size_t Callbacks() const noexcept;
+
+    //! Get the errors reported by the debug loop.
+    const std::vector<std::string>& Errors() const noexcept;
+
+protected:
+    void cbPreException(const EXCEPTION_RECORD& record,
+                        bool first_chance) override;
+
+    void cbInternalLoopError(const std::exception& error) override;
+
+private:
+    std::size_t calls_;
+
+    bool filtered_;
+
+    std::size_t threads_;
+
+    //! The breakpoint address, reported by the first hit.
+    std::uintptr_t target_{ 0 };
+
+    std::size_t callbacks_{ 0 };
+
+    std::vector<Sample> samples_{};
+
+    std::vector<std::string> errors_{};
+};
\ No newline at end of file
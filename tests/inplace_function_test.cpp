@@ -0,0 +1,124 @@
+#include "inplace_function.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+
+
+namespace {
+
+//! A callable counting its live instances.
+class Counted {
+public:
+    explicit Counted(int& live) noexcept : live_{ &live } {
+        ++*live_;
+    }
+
+    Counted(Counted&& other) noexcept : live_{ other.live_ } {
+        ++*live_;
+    }
+
+    ~Counted() noexcept {
+        --*live_;
+    }
+
+    int operator()(const int value) const noexcept {
+        return value + 1;
+    }
+
+private:
+    int* live_;
+};
+
+int Twice(const int value) noexcept {
+    return value * 2;
+}
+
+}  // namespace
+
+
+TEST(InplaceFunctionTest, Empty) {
+    const InplaceFunction<void()> empty{};
+    EXPECT_FALSE(empty);
+
+    const InplaceFunction<void()> null{ nullptr };
+    EXPECT_FALSE(null);
+}
+
+TEST(InplaceFunctionTest, Invoke) {
+    const InplaceFunction<int(int)> pointer{ &Twice };
+    EXPECT_TRUE(pointer);
+    EXPECT_EQ(pointer(4), 8);
+
+    const auto base{ 10 };
+    const InplaceFunction<int(int)> lambda{ [base](const int value) {
+        return base + value;
+    } };
+    EXPECT_EQ(lambda(5), 15);
+
+    // Mutable state is kept between calls.
+    const InplaceFunction<int()> counter{ [count = 0]() mutable {
+        return ++count;
+    } };
+    EXPECT_EQ(counter(), 1);
+    EXPECT_EQ(counter(), 2);
+}
+
+TEST(InplaceFunctionTest, MoveOnlyArguments) {
+    const InplaceFunction<int(std::unique_ptr<int>)> take{
+        [](std::unique_ptr<int> value) { return *value; }
+    };
+    EXPECT_EQ(take(std::make_unique<int>(7)), 7);
+}
+
+TEST(InplaceFunctionTest, Move) {
+    auto value{ 3 };
+    InplaceFunction<int()> source{ [&value]() { return value; } };
+    auto target{ std::move(source) };
+    EXPECT_FALSE(source);
+    ASSERT_TRUE(target);
+
+    value = 4;
+    EXPECT_EQ(target(), 4);
+
+    InplaceFunction<int()> assigned{};
+    assigned = std::move(target);
+    EXPECT_FALSE(target);
+    EXPECT_EQ(assigned(), 4);
+}
+
+TEST(InplaceFunctionTest, Lifetime) {
+    auto live{ 0 };
+    {
+        InplaceFunction<int(int)> function{ Counted{ live } };
+        EXPECT_EQ(live, 1);
+        EXPECT_EQ(function(1), 2);
+
+        auto moved{ std::move(function) };
+        EXPECT_EQ(live, 1);
+        EXPECT_EQ(moved(2), 3);
+
+        // Assignments destroy the previous callable.
+        moved = InplaceFunction<int(int)>{ Counted{ live } };
+        EXPECT_EQ(live, 1);
+
+        moved = nullptr;
+        EXPECT_EQ(live, 0);
+        EXPECT_FALSE(moved);
+
+        moved = Counted{ live };
+        EXPECT_EQ(live, 1);
+    }
+
+    EXPECT_EQ(live, 0);
+}
+
+TEST(InplaceFunctionTest, SelfMove) {
+    auto live{ 0 };
+    InplaceFunction<int(int)> function{ Counted{ live } };
+    auto& alias{ function };
+    function = std::move(alias);
+    EXPECT_EQ(live, 1);
+    EXPECT_EQ(function(0), 1);
+}
\ No newline at end of file
@@ -0,0 +1,873 @@
+/**
+ * @file instruction_corpus.h
+ * @brief A reference corpus of IA-32 instructions.
+ *
+ * @details
+ * Single instructions were assembled by GNU `as --32`.
+ * Code streams are text sections of C functions compiled by GCC with `-m32`.
+ * Instruction boundaries were taken from `objdump -d --insn-width=16`.
+ * Bytes are hexadecimal, and instructions in a stream are separated by `|`.
+ *
+ * @author Chen Zhenshuo (chenzs108@outlook.com)
+ * @author Liu Guowen (liu.guowen@outlook.com)
+ * @version 1.0
+ * @date 2026-10-18
+ * @par GitHub
+ * https://github.com/czs108
+ * @par
+ * https://github.com/lgw1995
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+
+//! A single instruction.
+struct ReferenceInstruction {
+    std::string_view code;
+
+    //! The disassembly by `objdump`.
+    std::string_view text;
+};
+
+//! A stream of compiled code.
+struct ReferenceCode {
+    //! The compiler options.
+    std::string_view options;
+
+    std::string_view code;
+};
+
+//! Machine code parsed from a reference string.
+struct ParsedCode {
+    std::vector<std::byte> bytes;
+
+    //! The length of each instruction.
+    std::vector<std::size_t> lengths;
+};
+
+//! Parse hexadecimal bytes separated by spaces, and instructions separated by `|`.
+inline ParsedCode ParseReferenceCode(const std::string_view code) {
+    constexpr auto digit{ [](const char c) {
+        return c <= '9' ? c - '0' : c - 'a' + 10;
+    } };
+
+    ParsedCode parsed{};
+    std::size_t length{ 0 };
+    for (std::size_t i{ 0 }; i < code.size(); ++i) {
+        if (code[i] == '|') {
+            parsed.lengths.push_back(length);
+            length = 0;
+        } else if (code[i] != ' ') {
+            parsed.bytes.push_back(
+                static_cast<std::byte>(digit(code[i]) * 16 + digit(code[i + 1])));
+            ++length;
+            ++i;
+        }
+    }
+
+    parsed.lengths.push_back(length);
+    return parsed;
+}
+
+//! Instructions covering prefixes, opcode maps, `ModRM` and `SIB` forms, displacements and immediates.
+inline constexpr std::array<ReferenceInstruction, 265> reference_instructions{ {
+    { "90", "nop" },
+    { "c3", "ret" },
+    { "c2 08 00", "ret $0x8" },
+    { "cb", "lret" },
+    { "ca 04 00", "lret $0x4" },
+    { "cf", "iret" },
+    { "cc", "int3" },
+    { "cd 2e", "int $0x2e" },
+    { "ce", "into" },
+    { "f1", "int1" },
+    { "f4", "hlt" },
+    { "c9", "leave" },
+    { "c8 10 00 01", "enter $0x10,$0x1" },
+    { "50", "push %eax" },
+    { "06", "push %es" },
+    { "1f", "pop %ds" },
+    { "60", "pusha" },
+    { "61", "popa" },
+    { "9c", "pushf" },
+    { "9d", "popf" },
+    { "6a 12", "push $0x12" },
+    { "68 78 56 34 12", "push $0x12345678" },
+    { "66 68 34 12", "pushw $0x1234" },
+    { "00 c3", "add %al,%bl" },
+    { "04 7f", "add $0x7f,%al" },
+    { "05 78 56 34 12", "add $0x12345678,%eax" },
+    { "66 05 34 12", "add $0x1234,%ax" },
+    { "13 08", "adc (%eax),%ecx" },
+    { "19 53 04", "sbb %edx,0x4(%ebx)" },
+    { "83 e1 01", "and $0x1,%ecx" },
+    { "81 ca 00 01 00 00", "or $0x100,%edx" },
+    { "81 76 10 78 56 34 12", "xorl $0x12345678,0x10(%esi)" },
+    { "80 3f 05", "cmpb $0x5,(%edi)" },
+    { "66 81 3f 34 12", "cmpw $0x1234,(%edi)" },
+    { "6b c8 03", "imul $0x3,%eax,%ecx" },
+    { "69 d3 00 10 00 00", "imul $0x1000,%ebx,%edx" },
+    { "66 69 d3 00 10", "imul $0x1000,%bx,%dx" },
+    { "a8 80", "test $0x80,%al" },
+    { "f7 45 08 00 00 00 80", "testl $0x80000000,0x8(%ebp)" },
+    { "f6 00 01", "testb $0x1,(%eax)" },
+    { "66 f7 00 01 00", "testw $0x1,(%eax)" },
+    { "f7 10", "notl (%eax)" },
+    { "f6 d9", "neg %cl" },
+    { "f7 e3", "mul %ebx" },
+    { "f7 74 24 04", "divl 0x4(%esp)" },
+    { "b0 12", "mov $0x12,%al" },
+    { "bf 78 56 34 12", "mov $0x12345678,%edi" },
+    { "66 be 34 12", "mov $0x1234,%si" },
+    { "c6 01 01", "movb $0x1,(%ecx)" },
+    { "c7 05 78 56 34 12 01 00 00 00", "movl $0x1,0x12345678" },
+    { "66 c7 01 01 00", "movw $0x1,(%ecx)" },
+    { "a1 78 56 34 12", "mov 0x12345678,%eax" },
+    { "a2 78 56 34 12", "mov %al,0x12345678" },
+    { "66 a1 34 12 00 00", "mov 0x1234,%ax" },
+    { "67 a1 34 12", "addr16 mov 0x1234,%eax" },
+    { "89 c3", "mov %eax,%ebx" },
+    { "8b 18", "mov (%eax),%ebx" },
+    { "8b 58 7f", "mov 0x7f(%eax),%ebx" },
+    { "8b 58 80", "mov -0x80(%eax),%ebx" },
+    { "8b 98 78 56 34 12", "mov 0x12345678(%eax),%ebx" },
+    { "8b 04 24", "mov (%esp),%eax" },
+    { "8b 44 24 04", "mov 0x4(%esp),%eax" },
+    { "8b 84 24 00 01 00 00", "mov 0x100(%esp),%eax" },
+    { "8b 45 00", "mov 0x0(%ebp),%eax" },
+    { "8b 14 08", "mov (%eax,%ecx,1),%edx" },
+    { "8b 14 48", "mov (%eax,%ecx,2),%edx" },
+    { "8b 54 88 08", "mov 0x8(%eax,%ecx,4),%edx" },
+    { "8b 94 c8 00 10 00 00", "mov 0x1000(%eax,%ecx,8),%edx" },
+    { "8b 14 cd 00 10 00 00", "mov 0x1000(,%ecx,8),%edx" },
+    { "8b 14 0d 00 00 00 00", "mov 0x0(,%ecx,1),%edx" },
+    { "26 8b 10", "mov %es:(%eax),%edx" },
+    { "64 a1 18 00 00 00", "mov %fs:0x18,%eax" },
+    { "65 8b 0b", "mov %gs:(%ebx),%ecx" },
+    { "67 66 8b 00", "mov (%bx,%si),%ax" },
+    { "67 8b 43 02", "mov 0x2(%bp,%di),%eax" },
+    { "67 8b 87 34 12", "mov 0x1234(%bx),%eax" },
+    { "67 8b 46 00", "mov 0x0(%bp),%eax" },
+    { "8d 6c 24 04", "lea 0x4(%esp),%ebp" },
+    { "8d 04 40", "lea (%eax,%eax,2),%eax" },
+    { "91", "xchg %eax,%ecx" },
+    { "87 18", "xchg %ebx,(%eax)" },
+    { "98", "cwtl" },
+    { "99", "cltd" },
+    { "9e", "sahf" },
+    { "9f", "lahf" },
+    { "c1 c0 03", "rol $0x3,%eax" },
+    { "d3 ea", "shr %cl,%edx" },
+    { "d1 fb", "sar %ebx" },
+    { "c1 20 04", "shll $0x4,(%eax)" },
+    { "0f a4 c3 03", "shld $0x3,%eax,%ebx" },
+    { "0f ad 18", "shrd %cl,%ebx,(%eax)" },
+    { "a4", "movsb %ds:(%esi),%es:(%edi)" },
+    { "a5", "movsl %ds:(%esi),%es:(%edi)" },
+    { "f3 a5", "rep movsl %ds:(%esi),%es:(%edi)" },
+    { "f3 aa", "rep stos %al,%es:(%edi)" },
+    { "f2 ae", "repnz scas %es:(%edi),%al" },
+    { "66 a7", "cmpsw %es:(%edi),%ds:(%esi)" },
+    { "ad", "lods %ds:(%esi),%eax" },
+    { "d7", "xlat %ds:(%ebx)" },
+    { "e4 60", "in $0x60,%al" },
+    { "e6 80", "out %al,$0x80" },
+    { "ed", "in (%dx),%eax" },
+    { "c4 18", "les (%eax),%ebx" },
+    { "c5 4b 04", "lds 0x4(%ebx),%ecx" },
+    { "62 01", "bound %eax,(%ecx)" },
+    { "63 03", "arpl %ax,(%ebx)" },
+    { "d4 0a", "aam $0xa" },
+    { "d5 0a", "aad $0xa" },
+    { "27", "daa" },
+    { "f5", "cmc" },
+    { "f8", "clc" },
+    { "fd", "std" },
+    { "fc", "cld" },
+    { "fb", "sti" },
+    { "fa", "cli" },
+    { "f0 ff 00", "lock incl (%eax)" },
+    { "f0 0f b1 0b", "lock cmpxchg %ecx,(%ebx)" },
+    { "f0 0f c1 41 04", "lock xadd %eax,0x4(%ecx)" },
+    { "eb 00", "jmp 0x15a" },
+    { "e9 fb 0f 00 00", "jmp 0x115a" },
+    { "74 00", "je 0x161" },
+    { "0f 85 fa 0f 00 00", "jne 0x1161" },
+    { "e3 00", "jecxz 0x169" },
+    { "e2 00", "loop 0x16b" },
+    { "e0 00", "loopne 0x16d" },
+    { "e8 00 00 00 00", "call 0x172" },
+    { "e8 fb ff 0f 00", "call 0x100172" },
+    { "ff d0", "call *%eax" },
+    { "ff 10", "call *(%eax)" },
+    { "ff 15 78 56 34 12", "call *0x12345678" },
+    { "ff 54 8c 04", "call *0x4(%esp,%ecx,4)" },
+    { "ff e0", "jmp *%eax" },
+    { "ff 63 10", "jmp *0x10(%ebx)" },
+    { "9a 78 56 34 12 23 00", "lcall $0x23,$0x12345678" },
+    { "ea 78 56 34 12 33 00", "ljmp $0x33,$0x12345678" },
+    { "ff 18", "lcall *(%eax)" },
+    { "ff 28", "ljmp *(%eax)" },
+    { "f2 ff e0", "bnd jmp *%eax" },
+    { "d9 e8", "fld1" },
+    { "d9 ee", "fldz" },
+    { "d9 c1", "fld %st(1)" },
+    { "d9 00", "flds (%eax)" },
+    { "dd 44 24 08", "fldl 0x8(%esp)" },
+    { "db 2b", "fldt (%ebx)" },
+    { "dd 18", "fstpl (%eax)" },
+    { "db 5d fc", "fistpl -0x4(%ebp)" },
+    { "d8 c2", "fadd %st(2),%st" },
+    { "de c1", "faddp %st,%st(1)" },
+    { "de c9", "fmulp %st,%st(1)" },
+    { "df f1", "fcomip %st(1),%st" },
+    { "df e0", "fnstsw %ax" },
+    { "d9 3c 24", "fnstcw (%esp)" },
+    { "d9 6c 24 02", "fldcw 0x2(%esp)" },
+    { "d9 cb", "fxch %st(3)" },
+    { "d9 fa", "fsqrt" },
+    { "9b", "fwait" },
+    { "0f 31", "rdtsc" },
+    { "0f a2", "cpuid" },
+    { "0f 34", "sysenter" },
+    { "0f 35", "sysexit" },
+    { "0f 05", "syscall" },
+    { "0f 0b", "ud2" },
+    { "f3 90", "pause" },
+    { "0f b6 08", "movzbl (%eax),%ecx" },
+    { "0f b7 c8", "movzwl %ax,%ecx" },
+    { "0f be d8", "movsbl %al,%ebx" },
+    { "0f bf 58 02", "movswl 0x2(%eax),%ebx" },
+    { "0f bc c8", "bsf %eax,%ecx" },
+    { "0f bd 08", "bsr (%eax),%ecx" },
+    { "0f ba e0 03", "bt $0x3,%eax" },
+    { "0f ab 08", "bts %ecx,(%eax)" },
+    { "0f ba 70 04 1f", "btrl $0x1f,0x4(%eax)" },
+    { "0f bb d0", "btc %edx,%eax" },
+    { "0f c8", "bswap %eax" },
+    { "0f 94 c0", "sete %al" },
+    { "0f 95 00", "setne (%eax)" },
+    { "0f 44 d8", "cmove %eax,%ebx" },
+    { "0f 4c 4c 24 04", "cmovl 0x4(%esp),%ecx" },
+    { "0f 18 08", "prefetcht0 (%eax)" },
+    { "0f 18 46 40", "prefetchnta 0x40(%esi)" },
+    { "0f 1f 00", "nopl (%eax)" },
+    { "66 0f 1f 04 00", "nopw (%eax,%eax,1)" },
+    { "0f 1f 00", "nopl (%eax)" },
+    { "0f 1f 04 00", "nopl (%eax,%eax,1)" },
+    { "0f 20 c0", "mov %cr0,%eax" },
+    { "0f 22 d8", "mov %eax,%cr3" },
+    { "0f 21 f8", "mov %db7,%eax" },
+    { "0f 23 c0", "mov %eax,%db0" },
+    { "0f a0", "push %fs" },
+    { "0f a9", "pop %gs" },
+    { "0f 32", "rdmsr" },
+    { "0f 30", "wrmsr" },
+    { "0f ae e8", "lfence" },
+    { "0f ae f0", "mfence" },
+    { "0f ae f8", "sfence" },
+    { "0f ae 38", "clflush (%eax)" },
+    { "0f c7 0e", "cmpxchg8b (%esi)" },
+    { "0f 01 d0", "xgetbv" },
+    { "0f 77", "emms" },
+    { "0f 6e c0", "movd %eax,%mm0" },
+    { "0f 6f 08", "movq (%eax),%mm1" },
+    { "0f fc c1", "paddb %mm1,%mm0" },
+    { "0f 73 f0 03", "psllq $0x3,%mm0" },
+    { "0f 28 c1", "movaps %xmm1,%xmm0" },
+    { "0f 10 00", "movups (%eax),%xmm0" },
+    { "f3 0f 10 4c 24 04", "movss 0x4(%esp),%xmm1" },
+    { "f2 0f 11 10", "movsd %xmm2,(%eax)" },
+    { "66 0f 6f 18", "movdqa (%eax),%xmm3" },
+    { "f3 0f 7f 5c 24 10", "movdqu %xmm3,0x10(%esp)" },
+    { "0f 58 d1", "addps %xmm1,%xmm2" },
+    { "f2 0f 59 00", "mulsd (%eax),%xmm0" },
+    { "0f 57 c0", "xorps %xmm0,%xmm0" },
+    { "66 0f ef c9", "pxor %xmm1,%xmm1" },
+    { "f2 0f 2a c0", "cvtsi2sd %eax,%xmm0" },
+    { "f2 0f 2c c0", "cvttsd2si %xmm0,%eax" },
+    { "0f c6 c1 1b", "shufps $0x1b,%xmm1,%xmm0" },
+    { "66 0f 70 08 4e", "pshufd $0x4e,(%eax),%xmm1" },
+    { "0f c2 c1 01", "cmpltps %xmm1,%xmm0" },
+    { "f2 0f c2 00 02", "cmplesd (%eax),%xmm0" },
+    { "66 0f c4 c0 02", "pinsrw $0x2,%eax,%xmm0" },
+    { "66 0f c5 c0 01", "pextrw $0x1,%xmm0,%eax" },
+    { "66 0f 73 d8 04", "psrldq $0x4,%xmm0" },
+    { "66 0f 72 f1 02", "pslld $0x2,%xmm1" },
+    { "66 0f 2e c1", "ucomisd %xmm1,%xmm0" },
+    { "66 0f 38 00 c1", "pshufb %xmm1,%xmm0" },
+    { "0f 38 00 00", "pshufb (%eax),%mm0" },
+    { "66 0f 38 40 c1", "pmulld %xmm1,%xmm0" },
+    { "66 0f 38 17 08", "ptest (%eax),%xmm1" },
+    { "66 0f 38 3b 54 24 10", "pminud 0x10(%esp),%xmm2" },
+    { "f2 0f 38 f0 c8", "crc32 %al,%ecx" },
+    { "f2 0f 38 f1 08", "crc32l (%eax),%ecx" },
+    { "0f 38 f0 08", "movbe (%eax),%ecx" },
+    { "66 0f 38 dc c1", "aesenc %xmm1,%xmm0" },
+    { "66 0f 38 30 00", "pmovzxbw (%eax),%xmm0" },
+    { "66 0f 3a 0f c1 04", "palignr $0x4,%xmm1,%xmm0" },
+    { "66 0f 3a 16 c0 01", "pextrd $0x1,%xmm0,%eax" },
+    { "66 0f 3a 22 08 02", "pinsrd $0x2,(%eax),%xmm1" },
+    { "66 0f 3a 0b c1 03", "roundsd $0x3,%xmm1,%xmm0" },
+    { "66 0f 3a 0c 4c 24 20 05", "blendps $0x5,0x20(%esp),%xmm1" },
+    { "66 0f 3a 63 00 0c", "pcmpistri $0xc,(%eax),%xmm0" },
+    { "66 0f 3a 44 c1 11", "pclmulhqhqdq %xmm1,%xmm0" },
+    { "66 0f 3a 40 c1 ff", "dpps $0xff,%xmm1,%xmm0" },
+    { "c5 f8 77", "vzeroupper" },
+    { "c5 fc 77", "vzeroall" },
+    { "c5 fc 28 c1", "vmovaps %ymm1,%ymm0" },
+    { "c5 f4 58 10", "vaddps (%eax),%ymm1,%ymm2" },
+    { "c5 fe 6f 5c 24 20", "vmovdqu 0x20(%esp),%ymm3" },
+    { "c5 e9 ef d9", "vpxor %xmm1,%xmm2,%xmm3" },
+    { "c4 e2 6d b8 d9", "vfmadd231ps %ymm1,%ymm2,%ymm3" },
+    { "c4 e3 fd 00 c1 4e", "vpermq $0x4e,%ymm1,%ymm0" },
+    { "c4 e2 7d 58 00", "vpbroadcastd (%eax),%ymm0" },
+    { "c4 e3 7d 18 c1 01", "vinsertf128 $0x1,%xmm1,%ymm0,%ymm0" },
+    { "c4 e2 60 f2 c8", "andn %eax,%ebx,%ecx" },
+    { "c4 e2 79 f7 0b", "shlx %eax,(%ebx),%ecx" },
+    { "c4 e3 7b f0 d8 03", "rorx $0x3,%eax,%ebx" },
+    { "c5 f9 7e c0", "vmovd %xmm0,%eax" },
+    { "66 40", "inc %ax" },
+    { "66 49", "dec %cx" },
+    { "66 50", "push %ax" },
+    { "66 5b", "pop %bx" },
+    { "66 0f b6 c0", "movzbw %al,%ax" },
+    { "66 01 03", "add %ax,(%ebx)" },
+    { "66 83 f8 12", "cmp $0x12,%ax" },
+    { "66 c3", "retw" },
+    { "66 90", "xchg %ax,%ax" },
+} };
+
+//! Code streams compiled with different options.
+inline constexpr std::array<ReferenceCode, 5> reference_code{ {
+    { "-O2",
+      "e8 fc ff ff ff|05 01 00 00 00|8b 54 24 04|83 fa 07|"
+      "0f 87 fc ff ff ff|03 84 90 00 00 00 00|ff e0|8b 44 24 08|"
+      "23 44 24 0c|c3|8d b4 26 00 00 00 00|8b 44 24 08|0b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|03 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|2b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|0f af 44 24 0c|c3|"
+      "8d b6 00 00 00 00|8b 54 24 0c|31 c0|85 d2|74 2e|8b 44 24 08|99|"
+      "f7 7c 24 0c|c3|8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 e0|c3|"
+      "8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 f8|c3|8d 74 26 00|c3|"
+      "8d b4 26 00 00 00 00|56|53|8b 74 24 10|8b 5c 24 0c|85 f6|74 38|"
+      "01 de|b8 ff ff ff ff|8d 76 00|0f b6 13|83 c3 01|31 d0|"
+      "ba 08 00 00 00|8d 76 00|89 c1|83 e0 01|f7 d8|d1 e9|25 20 83 b8 ed|"
+      "31 c8|83 ea 01|75 eb|39 f3|75 d7|f7 d0|5b|5e|c3|31 c0|5b|5e|c3|"
+      "8d 74 26 00|90|e8 fc ff ff ff|05 01 00 00 00|55|57|56|53|83 ec 1c|"
+      "8b 6c 24 34|8b 54 24 44|89 44 24 0c|8b 74 24 38|8b 7c 24 30|"
+      "89 54 24 04|89 ea|8b 44 24 40|0f af d6|8b 5c 24 04|89 04 24|89 f8|"
+      "89 d1|8b 54 24 3c|0f af d7|01 d1|f7 e6|83 e6 3f|01 ca|8b 0c 24|53|"
+      "83 c9 01|51|52|50|8b 5c 24 1c|e8 fc ff ff ff|89 f1|31 db|0f a5 fd|"
+      "d3 e7|f6 c1 20|8b 4c 24 10|0f 45 ef|0f 45 fb|8b 5c 24 14|01 f8|"
+      "11 ea|0f ac d9 07|c1 eb 07|29 c8|19 da|83 c4 2c|5b|5e|5f|5d|c3|"
+      "8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|90|dd 44 24 0c|"
+      "8b 44 24 08|8b 54 24 04|d9 ee|83 e8 01|78 15|8d 74 26 00|90|d8 c9|"
+      "dc 04 c2|83 e8 01|73 f6|dd d9|c3|8d 76 00|dd d9|c3|8d 74 26 00|90|"
+      "53|8b 4c 24 10|85 c9|7e 2f|8b 44 24 08|8b 54 24 0c|d9 ee|8d 0c 88|"
+      "8d b4 26 00 00 00 00|8d 76 00|d9 00|d8 0a|83 c0 04|83 c2 04|de c1|"
+      "39 c8|75 f0|5b|c3|8d b6 00 00 00 00|d9 ee|5b|c3|8d 74 26 00|53|"
+      "83 ec 28|8b 5c 24 38|85 db|7e 70|8b 44 24 30|c1 e3 04|8b 54 24 34|"
+      "01 c3|8d b4 26 00 00 00 00|d9 40 0c|d9 40 08|83 c0 10|83 c2 10|"
+      "d9 40 f4|d9 40 f0|d9 42 f0|d8 c9|de c1|d9 1c 24|d9 42 f4|8b 0c 24|"
+      "d8 c9|de c1|d9 5c 24 04|d9 42 f8|d8 c9|de c1|d9 5c 24 08|d9 42 fc|"
+      "d8 c9|de c1|d9 5c 24 0c|89 48 f0|8b 4c 24 04|89 48 f4|8b 4c 24 08|"
+      "89 48 f8|8b 4c 24 0c|89 48 fc|39 d8|75 a4|83 c4 28|5b|c3|"
+      "8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|90|55|89 e5|57|56|53|"
+      "83 e4 e0|83 ec 40|8b 7d 10|85 ff|0f 8e be 00 00 00|8b 45 08|"
+      "c1 e7 05|8b 55 0c|01 c7|8d b6 00 00 00 00|8b 1a|8b 08|39 cb|"
+      "0f 4c d9|89 1c 24|8b 72 04|8b 48 04|39 f1|0f 4c ce|89 4c 24 04|"
+      "8b 72 08|39 70 08|0f 4d 70 08|89 74 24 08|8b 72 0c|39 70 0c|"
+      "0f 4d 70 0c|89 74 24 0c|8b 72 10|39 70 10|0f 4d 70 10|89 74 24 10|"
+      "8b 72 14|39 70 14|0f 4d 70 14|89 74 24 14|8b 72 18|39 70 18|"
+      "0f 4d 70 18|89 74 24 18|8b 72 1c|39 70 1c|0f 4d 70 1c|83 c0 20|"
+      "83 c2 20|89 74 24 1c|89 58 e0|89 48 e4|8b 4c 24 08|89 48 e8|"
+      "8b 4c 24 0c|89 48 ec|8b 4c 24 10|89 48 f0|8b 4c 24 14|89 48 f4|"
+      "8b 4c 24 18|89 48 f8|8b 4c 24 1c|89 48 fc|39 f8|0f 85 53 ff ff ff|"
+      "8d 65 f4|5b|5e|5f|5d|c3|8d 76 00|8b 44 24 04|8b 54 24 08|85 c0|"
+      "75 0a|eb 15|66 90|8b 00|85 c0|74 0a|39 50 04|75 f5|c3|8d 74 26 00|"
+      "31 c0|c3|c3|8d b4 26 00 00 00 00|8d 74 26 00|90|57|56|8b 44 24 14|"
+      "8b 7c 24 0c|8b 74 24 10|85 c0|74 0b|01 f8|8d 74 26 00|a4|39 c7|"
+      "75 fb|5e|5f|c3|0f b7 44 24 04|66 c1 c0 08|c3|8d b6 00 00 00 00|56|"
+      "53|e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 10|8b 74 24 1c|56|"
+      "83 ce 01|e8 fc ff ff ff|31 c9|f3 0f bc ce|0f bd d6|83 c4 14|"
+      "83 f2 1f|01 c8|5b|5e|01 d0|c3|8d b4 26 00 00 00 00|"
+      "8d b6 00 00 00 00|8b 4c 24 04|8b 54 24 0c|8b 44 24 08|39 d1|"
+      "0f 4e d1|39 c1|0f 4d c2|c3|8d b4 26 00 00 00 00|66 90|53|"
+      "e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 18|8d 44 24 08|83 ec 0c|50|"
+      "ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|e8 fc ff ff ff|"
+      "03 44 24 28|13 54 24 2c|83 c4 38|5b|c3|8d b4 26 00 00 00 00|"
+      "e8 fc ff ff ff|81 c1 02 00 00 00|53|8b 5c 24 08|85 db|7e 21|31 c0|"
+      "8d b4 26 00 00 00 00|8d 76 00|8b 91 00 00 00 00|01 c2|83 c0 01|"
+      "89 91 00 00 00 00|39 c3|75 eb|5b|c3|8d b4 26 00 00 00 00|66 90|55|"
+      "57|56|be 01 00 00 00|53|83 ec 6c|8b 94 24 80 00 00 00|83 fa 01|"
+      "0f 8e 05 03 00 00|8d 5a ff|89 d7|31 ed|89 d8|83 e0 fe|29 c7|89 d8|"
+      "89 7c 24 48|39 54 24 48|0f 84 e2 02 00 00|8d 72 fe|89 df|31 db|"
+      "89 6c 24 28|89 f2|89 dd|89 f3|83 e2 fe|29 d7|89 7c 24 4c|8d 48 ff|"
+      "39 44 24 4c|0f 84 92 02 00 00|83 e8 02|89 cf|89 c2|89 44 24 2c|"
+      "83 e2 fe|29 d7|89 7c 24 50|31 ff|8d 41 ff|39 4c 24 50|"
+      "0f 84 4c 02 00 00|8d 51 fe|89 c6|89 6c 24 30|89 d1|89 7c 24 34|"
+      "83 e1 fe|89 5c 24 38|89 54 24 3c|29 ce|89 74 24 54|31 f6|"
+      "8b 4c 24 54|8d 78 ff|39 c8|0f 84 03 02 00 00|8d 58 fe|89 f9|31 d2|"
+      "89 74 24 40|89 d8|89 5c 24 44|89 fd|89 d6|83 e0 fe|29 c1|"
+      "89 4c 24 10|8b 44 24 10|8d 7d ff|39 c5|0f 84 c4 01 00 00|83 ed 02|"
+      "89 f9|89 e8|89 ea|83 e0 fe|29 c1|31 c0|89 4c 24 0c|89 f9|89 c3|"
+      "89 f7|89 ce|8b 44 24 0c|8d 4e ff|39 c6|0f 84 53 01 00 00|8d 46 fd|"
+      "31 ed|89 44 24 04|8d 46 fe|89 c6|89 44 24 08|89 c8|83 e6 fe|29 f0|"
+      "89 ce|89 44 24 20|8b 44 24 20|39 c6|0f 84 38 01 00 00|8d 46 fd|"
+      "8d 4e fc|89 54 24 1c|83 e0 fe|89 5c 24 14|29 c1|8b 44 24 04|"
+      "89 6c 24 18|89 f5|89 4c 24 24|31 c9|89 c3|89 de|83 fb 01|"
+      "0f 84 28 01 00 00|31 d2|89 54 24 5c|8d 46 ff|83 ec 0c|83 ee 02|"
+      "89 4c 24 64|50|e8 fc ff ff ff|8b 54 24 6c|83 c4 10|8b 4c 24 58|"
+      "01 c2|83 fe 01|7f d7|8d 4c 11 01|83 eb 02|39 5c 24 24|75 bd|89 ee|"
+      "8b 5c 24 14|8b 6c 24 18|8b 54 24 1c|83 ee 02|83 6c 24 04 02|"
+      "8d 6c 0d 01|83 fe 01|0f 8f 69 ff ff ff|8b 74 24 08|8d 5c 2b 01|"
+      "83 fe 01|0f 8f 2a ff ff ff|89 fe|89 d8|89 d5|8d 74 06 01|83 fd 01|"
+      "0f 8f ec fe ff ff|89 f2|8b 5c 24 44|8b 74 24 40|89 d8|8d 74 16 01|"
+      "83 fb 01|0f 8f a6 fe ff ff|8b 6c 24 30|8b 7c 24 34|8b 5c 24 38|"
+      "8b 54 24 3c|89 d1|8d 7c 37 01|83 fa 01|0f 8f 58 fe ff ff|"
+      "8b 44 24 2c|89 fa|8d 6c 15 01|83 f8 01|0f 8f 22 fe ff ff|89 de|"
+      "89 eb|8b 6c 24 28|89 f2|8d 6c 1d 01|83 fe 01|0f 8f c4 00 00 00|"
+      "89 ee|83 c4 6c|83 c6 01|5b|89 f0|5e|5f|5d|c3|8d b4 26 00 00 00 00|"
+      "90|89 d8|89 fe|89 d5|83 c0 01|e9 6c ff ff ff|66 90|8b 74 24 08|"
+      "83 c5 01|8d 5c 2b 01|83 fe 01|0f 8f 7a fe ff ff|e9 4b ff ff ff|"
+      "8d b4 26 00 00 00 00|89 ee|8b 5c 24 14|8b 6c 24 18|83 c1 01|"
+      "8b 54 24 1c|e9 08 ff ff ff|89 f2|8b 5c 24 44|8b 74 24 40|83 c2 01|"
+      "e9 39 ff ff ff|8b 6c 24 30|8b 7c 24 34|83 c6 01|8b 5c 24 38|"
+      "8b 54 24 3c|e9 40 ff ff ff|89 fa|8b 44 24 2c|83 c2 01|8d 6c 15 01|"
+      "83 f8 01|0f 8e 4c ff ff ff|8d 48 ff|39 44 24 4c|0f 85 6e fd ff ff|"
+      "89 de|89 eb|8b 6c 24 28|83 c3 01|89 f2|8d 6c 1d 01|83 fe 01|"
+      "0f 8e 3c ff ff ff|8d 5e ff|89 d8|39 54 24 48|0f 85 1e fd ff ff|"
+      "89 ee|83 c6 02|83 c4 6c|89 f0|5b|5e|5f|5d|c3|8d 74 26 00|90|"
+      "e8 fc ff ff ff|81 c2 02 00 00 00|83 ec 10|8b 44 24 14|6a 03|"
+      "ff 74 24 1c|50|89 c1|83 e1 03|ff 94 8a 00 00 00 00|83 c4 1c|c3|"
+      "8d b4 26 00 00 00 00|db 44 24 04|d8 4c 24 08|df 6c 24 0c|de c1|c3|"
+      "90|dd 44 24 04|dd 44 24 0c|b8 ff ff ff ff|db f1|77 0f|d9 c9|31 c0|"
+      "df f1|dd d8|0f 97 c0|eb 06|66 90|dd d8|dd d8|c3|83 c8 ff|c3|"
+      "8b 04 24|c3|8b 14 24|c3|8b 0c 24|c3|8b 1c 24|c3" },
+    { "-Os",
+      "e8 fc ff ff ff|81 c2 02 00 00 00|55|89 e5|53|8b 5d 08|8b 45 0c|"
+      "8b 4d 10|83 fb 07|77 31|03 94 9a 00 00 00 00|ff e2|01 c1|eb 27|"
+      "29 c8|eb 0c|0f af c8|eb 1e|85 c9|74 1a|99|f7 f9|89 c1|eb 13|d3 e0|"
+      "eb f8|d3 f8|eb f4|21 c1|eb 07|09 c1|eb 03|83 c9 ff|89 c8|5b|5d|c3|"
+      "55|83 c8 ff|89 e5|56|53|8b 55 08|8b 5d 0c|01 d3|39 da|74 20|"
+      "0f b6 0a|42|31 c8|b9 08 00 00 00|89 c6|83 e0 01|f7 d8|d1 ee|"
+      "25 20 83 b8 ed|31 f0|49|75 ed|eb dc|5b|f7 d0|5e|5d|c3|"
+      "e8 fc ff ff ff|05 01 00 00 00|55|89 e5|57|56|53|83 ec 1c|8b 75 08|"
+      "8b 7d 0c|89 45 e0|8b 45 10|8b 55 1c|89 45 e4|8b 45 18|8b 4d e4|"
+      "89 55 dc|89 45 d8|8b 45 14|0f af cf|8b 5d dc|0f af c6|01 c1|"
+      "8b 45 e4|f7 e6|01 ca|8b 4d d8|53|83 c9 01|51|52|50|8b 5d e0|"
+      "e8 fc ff ff ff|8b 4d e4|31 db|83 c4 10|83 e1 3f|0f a5 f7|d3 e6|"
+      "f6 c1 20|8b 4d d8|0f 45 fe|0f 45 f3|8b 5d dc|01 f0|11 fa|"
+      "0f ac d9 07|c1 eb 07|29 c8|19 da|8d 65 f4|5b|5e|5f|5d|c3|55|89 e5|"
+      "dd 45 10|8b 45 0c|8b 55 08|48|d9 ee|85 c0|78 08|d8 c9|dc 04 c2|48|"
+      "eb f4|dd d9|5d|c3|55|31 c0|d9 ee|89 e5|53|8b 4d 08|8b 55 10|39 d0|"
+      "7d 0e|8b 5d 0c|d9 04 81|d8 0c 83|40|de c1|eb ee|5b|5d|c3|55|31 d2|"
+      "89 e5|57|56|83 ec 20|8b 45 08|3b 55 10|7d 52|89 d1|d9 40 08|"
+      "d9 40 04|89 c7|c1 e1 04|03 4d 0c|d9 00|8d 75 d8|d9 40 0c|d9 01|42|"
+      "83 c0 10|d8 ca|de c2|d9 c9|d9 5d d8|d9 41 04|d8 ca|de c2|d9 c9|"
+      "d9 5d dc|d9 41 08|d8 ca|de c2|d9 c9|d9 5d e0|d9 41 0c|"
+      "b9 04 00 00 00|d8 c9|de c1|d9 5d e4|f3 a5|eb a9|83 c4 20|5e|5f|5d|"
+      "c3|55|31 d2|89 e5|57|56|83 e4 e0|83 ec 40|8b 45 08|3b 55 10|"
+      "0f 8d 91 00 00 00|89 d1|8b 30|c1 e1 05|03 4d 0c|8b 39|39 fe|"
+      "0f 4c f7|89 34 24|8b 79 04|8b 70 04|39 fe|0f 4c f7|89 74 24 04|"
+      "8b 79 08|8b 70 08|39 fe|0f 4c f7|89 74 24 08|8b 79 0c|8b 70 0c|"
+      "39 fe|0f 4c f7|89 74 24 0c|8b 79 10|8b 70 10|39 fe|0f 4c f7|"
+      "89 74 24 10|8b 79 14|8b 70 14|39 fe|0f 4c f7|89 74 24 14|8b 79 18|"
+      "8b 70 18|39 fe|0f 4c f7|89 c7|89 74 24 18|8b 70 1c|8b 49 1c|39 ce|"
+      "0f 4c f1|b9 08 00 00 00|42|83 c0 20|89 74 24 1c|89 e6|f3 a5|"
+      "e9 66 ff ff ff|8d 65 f8|5e|5f|5d|c3|55|89 e5|8b 55 0c|8b 45 08|"
+      "85 c0|74 09|39 50 04|74 04|8b 00|eb f3|5d|c3|55|89 e5|57|56|"
+      "8b 7d 08|8b 45 10|8b 75 0c|01 f8|39 c7|74 03|a4|eb f9|5e|5f|5d|c3|"
+      "55|89 e5|8b 45 08|5d|86 e0|c3|55|89 e5|56|53|8b 75 08|"
+      "e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 0c|56|83 ce 01|"
+      "e8 fc ff ff ff|0f bc ce|83 c4 10|0f bd d6|83 f2 1f|8d 65 f8|01 c8|"
+      "5b|01 d0|5e|5d|c3|55|89 e5|8b 55 08|8b 45 0c|8b 4d 10|39 c2|7c 07|"
+      "39 ca|89 c8|0f 4e c2|5d|c3|55|89 e5|53|e8 fc ff ff ff|"
+      "81 c3 02 00 00 00|8d 45 f0|83 ec 20|50|ff 75 14|ff 75 10|ff 75 0c|"
+      "ff 75 08|e8 fc ff ff ff|83 c4 20|8b 5d fc|03 45 f0|13 55 f4|c9|c3|"
+      "e8 fc ff ff ff|81 c1 02 00 00 00|55|31 c0|89 e5|3b 45 08|7d 11|"
+      "8b 91 00 00 00 00|01 c2|40|89 91 00 00 00 00|eb ea|5d|c3|55|89 e5|"
+      "56|53|8b 75 08|31 db|83 fe 01|7e 16|83 ec 0c|8d 46 ff|83 ee 02|50|"
+      "e8 fc ff ff ff|83 c4 10|01 c3|eb e5|8d 65 f8|8d 43 01|5b|5e|5d|c3|"
+      "e8 fc ff ff ff|81 c2 02 00 00 00|55|89 e5|83 ec 0c|8b 45 08|6a 03|"
+      "ff 75 0c|89 c1|50|83 e1 03|ff 94 8a 00 00 00 00|c9|c3|55|89 e5|"
+      "d9 45 0c|da 4d 08|df 6d 10|5d|de c1|c3|55|83 c8 ff|89 e5|dd 45 08|"
+      "dd 45 10|db f1|77 0d|d9 c9|31 c0|df f1|dd d8|0f 97 c0|eb 04|dd d8|"
+      "dd d8|5d|c3|8b 04 24|c3|8b 14 24|c3|8b 0c 24|c3|8b 1c 24|c3" },
+    { "-O3 -msse4.2",
+      "e8 fc ff ff ff|05 01 00 00 00|8b 54 24 04|83 fa 07|"
+      "0f 87 fc ff ff ff|03 84 90 00 00 00 00|ff e0|8b 44 24 08|"
+      "23 44 24 0c|c3|8d b4 26 00 00 00 00|8b 44 24 08|0b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|03 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|2b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|0f af 44 24 0c|c3|"
+      "8d b6 00 00 00 00|8b 54 24 0c|31 c0|85 d2|74 2e|8b 44 24 08|99|"
+      "f7 7c 24 0c|c3|8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 e0|c3|"
+      "8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 f8|c3|8d 74 26 00|c3|"
+      "8d b4 26 00 00 00 00|53|8b 5c 24 0c|8b 4c 24 08|85 db|"
+      "0f 84 a9 00 00 00|01 cb|ba ff ff ff ff|8d b4 26 00 00 00 00|90|"
+      "0f b6 01|83 c1 01|31 d0|89 c2|83 e0 01|f7 d8|d1 ea|25 20 83 b8 ed|"
+      "31 c2|89 d0|83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|31 d0|89 c2|"
+      "83 e0 01|f7 d8|d1 ea|25 20 83 b8 ed|31 c2|89 d0|83 e2 01|f7 da|"
+      "d1 e8|81 e2 20 83 b8 ed|31 d0|89 c2|83 e0 01|f7 d8|d1 ea|"
+      "25 20 83 b8 ed|31 c2|89 d0|83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|"
+      "31 d0|89 c2|d1 ea|83 e0 01|f7 d8|25 20 83 b8 ed|31 c2|89 d0|"
+      "83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|31 c2|39 d9|"
+      "0f 85 6c ff ff ff|89 d0|5b|f7 d0|c3|31 c0|5b|c3|66 90|55|57|56|53|"
+      "e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 2c|8b 7c 24 44|8b 74 24 40|"
+      "8b 6c 24 48|8b 44 24 4c|89 f9|f3 0f 7e 4c 24 50|0f af c6|"
+      "66 0f 6f 83 00 00 00 00|0f af cd|66 0f d6 4c 24 18|66 0f 6f d8|"
+      "66 0f eb d9|01 c1|89 f0|0f 29 1c 24|f7 e5|ff 74 24 04|ff 74 24 04|"
+      "01 ca|52|50|e8 fc ff ff ff|89 e9|f3 0f 7e 4c 24 28|83 e1 3f|"
+      "66 0f 6e c0|31 c0|0f a5 f7|d3 e6|f6 c1 20|66 0f 3a 22 c2 01|"
+      "0f 45 fe|66 0f 73 d1 07|0f 45 f0|83 c4 3c|5b|66 0f 6e d6|5e|"
+      "66 0f 3a 22 d7 01|5f|5d|66 0f d4 c2|66 0f fb c1|66 0f 7e c0|"
+      "66 0f 3a 16 c2 01|c3|90|dd 44 24 0c|8b 44 24 08|8b 54 24 04|d9 ee|"
+      "83 e8 01|78 15|8d 74 26 00|90|d8 c9|dc 04 c2|83 e8 01|73 f6|dd d9|"
+      "c3|8d 76 00|dd d9|c3|8d 74 26 00|90|55|57|56|53|83 ec 1c|"
+      "8b 5c 24 38|8b 74 24 30|8b 7c 24 34|85 db|0f 8e b5 00 00 00|"
+      "8d 43 ff|83 f8 02|0f 86 b3 00 00 00|89 d9|d9 ee|89 f0|89 fa|"
+      "c1 e9 02|c1 e1 04|01 f1|8d b4 26 00 00 00 00|66 90|0f 10 00|"
+      "0f 10 0a|83 c0 10|83 c2 10|0f 59 c1|f3 0f 11 44 24 0c|d9 44 24 0c|"
+      "66 0f 3a 17 44 24 0c 01|de c1|d8 44 24 0c|66 0f 3a 17 44 24 0c 02|"
+      "d8 44 24 0c|66 0f 3a 17 44 24 0c 03|d8 44 24 0c|39 c8|75 bd|89 d8|"
+      "83 e0 fc|f6 c3 03|74 31|d9 04 86|d8 0c 87|8d 48 01|"
+      "8d 14 85 00 00 00 00|de c1|39 cb|7e 1b|d9 44 16 04|d8 4c 17 04|"
+      "83 c0 02|de c1|39 c3|7e 0a|d9 44 17 08|d8 4c 16 08|de c1|83 c4 1c|"
+      "5b|5e|5f|5d|c3|8d b4 26 00 00 00 00|8d 76 00|83 c4 1c|d9 ee|5b|5e|"
+      "5f|5d|c3|31 c0|d9 ee|eb ad|8b 4c 24 0c|85 c9|7e 28|8b 44 24 04|"
+      "c1 e1 04|8b 54 24 08|01 c1|8d 76 00|0f 28 00|0f 59 02|83 c0 10|"
+      "83 c2 10|0f 58 40 f0|0f 29 40 f0|39 c1|75 e8|c3|"
+      "8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|90|55|89 e5|83 e4 e0|"
+      "83 ec 40|8b 4d 10|85 c9|0f 8e d2 00 00 00|8b 45 08|c1 e1 05|"
+      "8b 55 0c|01 c1|90|66 0f 6e 02|66 0f 6e 08|83 c0 20|83 c2 20|"
+      "66 0f 38 3d c1|66 0f 7e 04 24|66 0f 6e 42 e4|66 0f 6e 48 e4|"
+      "66 0f 38 3d c1|66 0f 7e 44 24 04|66 0f 6e 4a e8|66 0f 6e 40 e8|"
+      "66 0f 38 3d c1|66 0f 7e 44 24 08|66 0f 6e 4a ec|66 0f 6e 40 ec|"
+      "66 0f 38 3d c1|66 0f 7e 44 24 0c|66 0f 6f 14 24|66 0f 6e 4a f0|"
+      "66 0f 6e 40 f0|66 0f 38 3d c1|66 0f 7e 44 24 10|66 0f 6e 4a f4|"
+      "66 0f 6e 40 f4|66 0f 38 3d c1|66 0f 7e 44 24 14|66 0f 6e 4a f8|"
+      "66 0f 6e 40 f8|66 0f 38 3d c1|66 0f 7e 44 24 18|66 0f 6e 4a fc|"
+      "66 0f 6e 40 fc|66 0f 38 3d c1|66 0f 7e 44 24 1c|0f 29 50 e0|"
+      "66 0f 6f 5c 24 10|0f 29 58 f0|39 c1|0f 85 3a ff ff ff|c9|c3|"
+      "8d b4 26 00 00 00 00|90|8b 44 24 04|8b 54 24 08|85 c0|75 0a|eb 15|"
+      "66 90|8b 00|85 c0|74 0a|39 50 04|75 f5|c3|8d 74 26 00|31 c0|c3|c3|"
+      "8d b4 26 00 00 00 00|8d 74 26 00|90|55|57|56|53|8b 4c 24 1c|"
+      "8b 44 24 14|8b 74 24 18|85 c9|74 2d|8d 79 ff|8d 56 01|83 ff 02|"
+      "76 09|89 c3|29 d3|83 fb 0e|77 28|01 c1|eb 07|8d 74 26 00|83 c2 01|"
+      "0f b6 5a ff|83 c0 01|88 58 ff|39 c8|75 ef|5b|5e|5f|5d|c3|"
+      "8d b4 26 00 00 00 00|8d 76 00|83 ff 0e|0f 86 a6 00 00 00|89 cd|"
+      "89 f2|89 c3|83 e5 f0|01 f5|8d 74 26 00|f3 0f 6f 0a|83 c2 10|"
+      "83 c3 10|0f 11 4b f0|39 ea|75 ee|89 ca|83 e2 f0|8d 1c 10|8d 2c 16|"
+      "29 d7|89 d8|89 ee|f6 c1 0f|74 b1|29 d1|8d 51 ff|83 fa 02|76 3c|"
+      "66 0f 6e 45 00|89 ca|c1 ea 02|66 0f 7e 03|83 fa 01|74 15|"
+      "66 0f 6e 45 04|66 0f 7e 43 04|83 fa 02|74 06|8b 55 08|89 53 08|"
+      "89 ca|83 e2 fc|01 d0|01 d6|29 d7|83 e1 03|0f 84 6b ff ff ff|"
+      "0f b6 16|88 10|85 ff|0f 84 5e ff ff ff|0f b6 56 01|88 50 01|"
+      "83 ff 01|0f 84 4e ff ff ff|0f b6 56 02|88 50 02|5b|5e|5f|5d|c3|"
+      "89 c3|89 f5|eb 95|8d b4 26 00 00 00 00|8d 74 26 00|0f b7 44 24 04|"
+      "66 c1 c0 08|c3|8d b6 00 00 00 00|8b 54 24 04|31 c0|31 c9|"
+      "f3 0f b8 c2|83 ca 01|f3 0f bc ca|0f bd d2|83 f2 1f|01 c8|01 d0|c3|"
+      "66 90|8b 4c 24 04|8b 54 24 0c|8b 44 24 08|39 d1|0f 4e d1|39 c1|"
+      "0f 4d c2|c3|8d b4 26 00 00 00 00|66 90|53|e8 fc ff ff ff|"
+      "81 c3 02 00 00 00|83 ec 18|8d 44 24 08|83 ec 0c|50|ff 74 24 3c|"
+      "ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|e8 fc ff ff ff|03 44 24 28|"
+      "13 54 24 2c|83 c4 38|5b|c3|8d b4 26 00 00 00 00|e8 fc ff ff ff|"
+      "81 c1 02 00 00 00|53|8b 5c 24 08|85 db|7e 21|31 c0|"
+      "8d b4 26 00 00 00 00|8d 76 00|8b 91 00 00 00 00|01 c2|83 c0 01|"
+      "89 91 00 00 00 00|39 c3|75 eb|5b|c3|8d b4 26 00 00 00 00|66 90|55|"
+      "57|56|be 01 00 00 00|53|83 ec 6c|8b 94 24 80 00 00 00|83 fa 01|"
+      "0f 8e 09 03 00 00|8d 5a ff|89 d7|31 ed|89 d8|83 e0 fe|29 c7|89 d8|"
+      "89 7c 24 48|8b 7c 24 48|39 fa|0f 84 e4 02 00 00|8d 72 fe|89 df|"
+      "31 db|89 6c 24 28|89 f2|89 dd|89 f3|83 e2 fe|29 d7|89 7c 24 4c|"
+      "8b 7c 24 4c|8d 48 ff|39 f8|0f 84 90 02 00 00|83 e8 02|89 cf|89 c2|"
+      "89 44 24 2c|83 e2 fe|29 d7|89 7c 24 50|31 ff|8b 54 24 50|8d 41 ff|"
+      "39 d1|0f 84 46 02 00 00|8d 51 fe|89 c6|89 6c 24 30|89 d1|"
+      "89 7c 24 34|83 e1 fe|89 54 24 38|89 5c 24 3c|29 ce|89 74 24 54|"
+      "31 f6|8b 4c 24 54|8d 78 ff|39 c8|0f 84 fd 01 00 00|8d 58 fe|89 f9|"
+      "31 d2|89 74 24 40|89 d8|89 5c 24 44|89 fd|89 d6|83 e0 fe|29 c1|"
+      "89 4c 24 10|8b 44 24 10|8d 7d ff|39 c5|0f 84 be 01 00 00|83 ed 02|"
+      "89 f9|89 e8|89 ea|83 e0 fe|29 c1|31 c0|89 4c 24 0c|89 f9|89 c3|"
+      "89 f7|89 ce|8b 44 24 0c|8d 4e ff|39 c6|0f 84 4d 01 00 00|8d 46 fd|"
+      "31 ed|89 44 24 04|8d 46 fe|89 c6|89 44 24 08|89 c8|83 e6 fe|29 f0|"
+      "89 ce|89 44 24 20|8b 44 24 20|39 c6|0f 84 32 01 00 00|8d 46 fd|"
+      "8d 4e fc|89 54 24 1c|83 e0 fe|89 5c 24 14|29 c1|8b 44 24 04|"
+      "89 6c 24 18|89 f5|89 4c 24 24|31 c9|89 c3|89 de|83 fb 01|"
+      "0f 84 22 01 00 00|31 d2|89 54 24 5c|8d 46 ff|83 ec 0c|83 ee 02|"
+      "89 4c 24 64|50|e8 fc ff ff ff|8b 54 24 6c|83 c4 10|8b 4c 24 58|"
+      "01 c2|83 fe 01|7f d7|8d 4c 11 01|83 eb 02|39 5c 24 24|75 bd|89 ee|"
+      "8b 5c 24 14|8b 6c 24 18|8b 54 24 1c|83 ee 02|83 6c 24 04 02|"
+      "8d 6c 0d 01|83 fe 01|0f 8f 69 ff ff ff|8b 74 24 08|8d 5c 2b 01|"
+      "83 fe 01|0f 8f 2a ff ff ff|89 fe|89 d8|89 d5|8d 74 06 01|83 fd 01|"
+      "0f 8f ec fe ff ff|89 f2|8b 5c 24 44|8b 74 24 40|89 d8|8d 74 16 01|"
+      "83 fb 01|0f 8f a6 fe ff ff|8b 6c 24 30|8b 7c 24 34|8b 54 24 38|"
+      "8b 5c 24 3c|89 d1|8d 7c 37 01|83 fa 01|0f 8f 56 fe ff ff|"
+      "8b 44 24 2c|89 fa|8d 6c 15 01|83 f8 01|0f 8f 1e fe ff ff|89 de|"
+      "89 eb|8b 6c 24 28|89 f2|8d 6c 1d 01|83 fe 01|0f 8f c0 00 00 00|"
+      "89 ee|83 c4 6c|83 c6 01|5b|89 f0|5e|5f|5d|c3|66 90|89 d8|89 fe|"
+      "89 d5|83 c0 01|e9 72 ff ff ff|66 90|8b 74 24 08|83 c5 01|"
+      "8d 5c 2b 01|83 fe 01|0f 8f 80 fe ff ff|e9 51 ff ff ff|"
+      "8d b4 26 00 00 00 00|89 ee|8b 5c 24 14|8b 6c 24 18|83 c1 01|"
+      "8b 54 24 1c|e9 0e ff ff ff|89 f2|8b 5c 24 44|8b 74 24 40|83 c2 01|"
+      "e9 3f ff ff ff|8b 6c 24 30|8b 7c 24 34|83 c6 01|8b 54 24 38|"
+      "8b 5c 24 3c|e9 46 ff ff ff|89 fa|8b 44 24 2c|83 c2 01|8d 6c 15 01|"
+      "83 f8 01|0f 8e 52 ff ff ff|8b 7c 24 4c|8d 48 ff|39 f8|"
+      "0f 85 70 fd ff ff|89 de|89 eb|8b 6c 24 28|83 c3 01|89 f2|"
+      "8d 6c 1d 01|83 fe 01|0f 8e 40 ff ff ff|8b 7c 24 48|8d 5e ff|89 d8|"
+      "39 fa|0f 85 1c fd ff ff|89 ee|83 c6 02|83 c4 6c|89 f0|5b|5e|5f|5d|"
+      "c3|90|e8 fc ff ff ff|81 c2 02 00 00 00|83 ec 10|8b 44 24 14|6a 03|"
+      "ff 74 24 1c|50|89 c1|83 e1 03|ff 94 8a 00 00 00 00|83 c4 1c|c3|"
+      "8d b4 26 00 00 00 00|db 44 24 04|d8 4c 24 08|df 6c 24 0c|de c1|c3|"
+      "90|dd 44 24 04|dd 44 24 0c|b8 ff ff ff ff|db f1|77 0f|d9 c9|31 c0|"
+      "df f1|dd d8|0f 97 c0|eb 06|66 90|dd d8|dd d8|c3|83 c8 ff|c3|"
+      "8b 04 24|c3|8b 14 24|c3|8b 0c 24|c3|8b 1c 24|c3" },
+    { "-O3 -mavx2 -mbmi2 -mfma",
+      "e8 fc ff ff ff|05 01 00 00 00|8b 54 24 04|83 fa 07|"
+      "0f 87 fc ff ff ff|03 84 90 00 00 00 00|ff e0|8b 44 24 08|"
+      "23 44 24 0c|c3|8d b4 26 00 00 00 00|8b 44 24 08|0b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|03 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|2b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|0f af 44 24 0c|c3|"
+      "8d b6 00 00 00 00|8b 54 24 0c|31 c0|85 d2|74 2e|8b 44 24 08|99|"
+      "f7 7c 24 0c|c3|8d 74 26 00|0f b6 44 24 0c|c4 e2 79 f7 44 24 08|c3|"
+      "8d 76 00|0f b6 44 24 0c|c4 e2 7a f7 44 24 08|c3|8d 76 00|c3|"
+      "8d b4 26 00 00 00 00|53|8b 5c 24 0c|8b 4c 24 08|85 db|"
+      "0f 84 a9 00 00 00|01 cb|ba ff ff ff ff|8d b4 26 00 00 00 00|90|"
+      "0f b6 01|83 c1 01|31 d0|89 c2|83 e0 01|f7 d8|d1 ea|25 20 83 b8 ed|"
+      "31 c2|89 d0|83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|31 d0|89 c2|"
+      "83 e0 01|f7 d8|d1 ea|25 20 83 b8 ed|31 c2|89 d0|83 e2 01|f7 da|"
+      "d1 e8|81 e2 20 83 b8 ed|31 d0|89 c2|83 e0 01|f7 d8|d1 ea|"
+      "25 20 83 b8 ed|31 c2|89 d0|83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|"
+      "31 d0|89 c2|d1 ea|83 e0 01|f7 d8|25 20 83 b8 ed|31 c2|89 d0|"
+      "83 e2 01|f7 da|d1 e8|81 e2 20 83 b8 ed|31 c2|39 d9|"
+      "0f 85 6c ff ff ff|89 d0|5b|f7 d0|c3|31 c0|5b|c3|66 90|55|57|56|53|"
+      "e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 2c|8b 7c 24 44|8b 74 24 40|"
+      "8b 6c 24 48|8b 44 24 4c|89 f9|89 f2|c5 fa 7e 4c 24 50|0f af c6|"
+      "c5 f9 6f 83 00 00 00 00|0f af cd|c5 f9 d6 4c 24 18|c5 f1 eb d8|"
+      "c5 f9 7f 1c 24|01 c1|c4 e2 7b f6 d5|ff 74 24 04|ff 74 24 04|01 ca|"
+      "52|50|e8 fc ff ff ff|89 e9|c5 fa 7e 4c 24 28|83 e1 3f|c5 f9 6e c0|"
+      "31 c0|0f a5 f7|f6 c1 20|c4 e2 71 f7 f6|c4 e3 79 22 c2 01|0f 45 fe|"
+      "c5 f1 73 d1 07|0f 45 f0|83 c4 3c|5b|c5 f9 6e d6|5e|"
+      "c4 e3 69 22 d7 01|5f|5d|c5 f9 d4 c2|c5 f9 fb c1|c5 f9 7e c0|"
+      "c4 e3 79 16 c2 01|c3|8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|"
+      "dd 44 24 0c|8b 44 24 08|8b 54 24 04|d9 ee|83 e8 01|78 15|"
+      "8d 74 26 00|90|d8 c9|dc 04 c2|83 e8 01|73 f6|dd d9|c3|8d 76 00|"
+      "dd d9|c3|8d 74 26 00|90|55|89 e5|57|56|53|83 e4 e0|83 ec 20|"
+      "8b 5d 10|8b 75 08|85 db|0f 8e 4e 01 00 00|8d 43 ff|83 f8 06|"
+      "0f 86 5d 01 00 00|89 d9|8b 55 0c|d9 ee|89 f0|c1 e9 03|c1 e1 05|"
+      "01 f1|8d b4 26 00 00 00 00|66 90|c5 fc 10 10|c5 ec 59 02|83 c0 20|"
+      "83 c2 20|c5 fa 11 44 24 1c|d9 44 24 1c|c4 e3 79 17 44 24 1c 01|"
+      "de c1|d8 44 24 1c|c4 e3 79 17 44 24 1c 02|d8 44 24 1c|"
+      "c4 e3 79 17 44 24 1c 03|c4 e3 7d 19 c0 01|d8 44 24 1c|"
+      "c5 fa 11 44 24 1c|d9 44 24 1c|c4 e3 79 17 44 24 1c 01|de c1|"
+      "d8 44 24 1c|c4 e3 79 17 44 24 1c 02|d8 44 24 1c|"
+      "c4 e3 79 17 44 24 1c 03|d9 44 24 1c|de c1|39 c1|75 86|89 d8|"
+      "83 e0 f8|89 c2|39 c3|0f 84 af 00 00 00|c5 f8 77|89 d9|29 d1|"
+      "8d 79 ff|83 ff 02|76 4b|8b 7d 0c|c5 f8 10 1c 96|c5 e0 59 04 97|"
+      "89 ca|83 e2 fc|01 d0|83 e1 03|c5 fa 11 44 24 1c|d9 44 24 1c|"
+      "c4 e3 79 17 44 24 1c 01|de c1|d8 44 24 1c|c4 e3 79 17 44 24 1c 02|"
+      "d8 44 24 1c|c4 e3 79 17 44 24 1c 03|d9 44 24 1c|de c1|74 37|"
+      "8b 4d 0c|d9 04 86|8d 14 85 00 00 00 00|d8 0c 81|8d 48 01|de c1|"
+      "39 cb|7e 1e|8b 4d 0c|d9 44 16 04|83 c0 02|d8 4c 11 04|de c1|39 c3|"
+      "7e 0a|d9 44 16 08|d8 4c 11 08|de c1|8d 65 f4|5b|5e|5f|5d|c3|"
+      "8d b6 00 00 00 00|8d 65 f4|d9 ee|5b|5e|5f|5d|c3|8d b6 00 00 00 00|"
+      "c5 f8 77|8d 65 f4|5b|5e|5f|5d|c3|31 d2|d9 ee|31 c0|e9 3e ff ff ff|"
+      "66 90|8b 4c 24 0c|85 c9|7e 28|8b 44 24 04|c1 e1 04|8b 54 24 08|"
+      "01 c1|8d 76 00|c5 f8 28 00|c4 e2 79 98 02|83 c0 10|83 c2 10|"
+      "c5 f8 29 40 f0|39 c1|75 e8|c3|8d b4 26 00 00 00 00|"
+      "8d b4 26 00 00 00 00|90|55|89 e5|8b 4d 10|85 c9|7e 34|8b 45 08|"
+      "c1 e1 05|8b 55 0c|01 c1|8d 76 00|c5 fd 6f 08|c5 fd 6f 12|83 c0 20|"
+      "83 c2 20|c5 f5 66 42 e0|c4 e3 6d 4c 40 e0 00|c5 fd 7f 40 e0|39 c1|"
+      "75 dd|c5 f8 77|5d|c3|8b 44 24 04|8b 54 24 08|85 c0|75 0a|eb 15|"
+      "66 90|8b 00|85 c0|74 0a|39 50 04|75 f5|c3|8d 74 26 00|31 c0|c3|c3|"
+      "8d b4 26 00 00 00 00|8d 74 26 00|90|55|89 e5|57|56|53|83 e4 e0|"
+      "83 ec 20|8b 55 10|8b 45 08|85 d2|74 33|8b 7d 0c|8d 5a ff|8d 4f 01|"
+      "83 fb 0e|76 09|89 c6|29 ce|83 fe 1e|77 2b|01 c2|eb 0a|"
+      "8d b4 26 00 00 00 00|83 c1 01|0f b6 59 ff|83 c0 01|88 58 ff|39 d0|"
+      "75 ef|8d 65 f4|5b|5e|5f|5d|c3|8d b4 26 00 00 00 00|83 fb 1e|"
+      "0f 86 5f 01 00 00|89 f9|89 d7|89 c6|83 e7 e0|01 cf|8d 74 26 00|"
+      "c5 fe 6f 01|83 c1 20|83 c6 20|c5 fe 7f 46 e0|39 cf|75 ed|89 d7|"
+      "83 e7 e0|8d 34 38|29 fb|89 74 24 1c|8b 75 0c|01 fe|f6 c2 1f|"
+      "0f 84 36 01 00 00|29 fa|8d 4a ff|83 f9 0e|0f 86 20 01 00 00|"
+      "c5 f8 77|8b 4d 0c|c5 fa 6f 0c 39|c5 fa 7f 0c 38|89 d0|83 e0 f0|"
+      "01 44 24 1c|01 c6|29 c3|83 e2 0f|0f 84 76 ff ff ff|0f b6 06|"
+      "8b 7c 24 1c|88 07|85 db|0f 84 65 ff ff ff|0f b6 46 01|88 47 01|"
+      "83 fb 01|0f 84 55 ff ff ff|0f b6 46 02|88 47 02|83 fb 02|"
+      "0f 84 45 ff ff ff|0f b6 46 03|88 47 03|83 fb 03|0f 84 35 ff ff ff|"
+      "0f b6 46 04|88 47 04|83 fb 04|0f 84 25 ff ff ff|0f b6 46 05|"
+      "88 47 05|83 fb 05|0f 84 15 ff ff ff|0f b6 46 06|88 47 06|83 fb 06|"
+      "0f 84 05 ff ff ff|0f b6 46 07|88 47 07|83 fb 07|0f 84 f5 fe ff ff|"
+      "0f b6 46 08|88 47 08|83 fb 08|0f 84 e5 fe ff ff|0f b6 46 09|"
+      "88 47 09|83 fb 09|0f 84 d5 fe ff ff|0f b6 46 0a|88 47 0a|83 fb 0a|"
+      "0f 84 c5 fe ff ff|0f b6 46 0b|88 47 0b|83 fb 0b|0f 84 b5 fe ff ff|"
+      "0f b6 46 0c|88 47 0c|83 fb 0c|0f 84 a5 fe ff ff|0f b6 46 0d|"
+      "88 47 0d|83 fb 0d|0f 84 95 fe ff ff|0f b6 46 0e|88 47 0e|"
+      "e9 89 fe ff ff|89 fe|89 44 24 1c|31 ff|e9 e3 fe ff ff|c5 f8 77|"
+      "e9 fe fe ff ff|c5 f8 77|e9 6c fe ff ff|8d 76 00|0f b7 44 24 04|"
+      "66 c1 c0 08|c3|8d b6 00 00 00 00|8b 54 24 04|31 c0|31 c9|"
+      "f3 0f b8 c2|83 ca 01|f3 0f bc ca|0f bd d2|83 f2 1f|01 c8|01 d0|c3|"
+      "66 90|8b 4c 24 04|8b 54 24 0c|8b 44 24 08|39 d1|0f 4e d1|39 c1|"
+      "0f 4d c2|c3|8d b4 26 00 00 00 00|66 90|53|e8 fc ff ff ff|"
+      "81 c3 02 00 00 00|83 ec 18|8d 44 24 08|83 ec 0c|50|ff 74 24 3c|"
+      "ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|e8 fc ff ff ff|03 44 24 28|"
+      "13 54 24 2c|83 c4 38|5b|c3|8d b4 26 00 00 00 00|e8 fc ff ff ff|"
+      "81 c1 02 00 00 00|53|8b 5c 24 08|85 db|7e 21|31 c0|"
+      "8d b4 26 00 00 00 00|8d 76 00|8b 91 00 00 00 00|01 c2|83 c0 01|"
+      "89 91 00 00 00 00|39 c3|75 eb|5b|c3|8d b4 26 00 00 00 00|66 90|55|"
+      "57|56|be 01 00 00 00|53|83 ec 6c|8b 94 24 80 00 00 00|83 fa 01|"
+      "0f 8e 09 03 00 00|8d 5a ff|89 d7|31 ed|89 d8|83 e0 fe|29 c7|89 d8|"
+      "89 7c 24 48|8b 7c 24 48|39 fa|0f 84 e4 02 00 00|8d 72 fe|89 df|"
+      "31 db|89 6c 24 28|89 f2|89 dd|89 f3|83 e2 fe|29 d7|89 7c 24 4c|"
+      "8b 7c 24 4c|8d 48 ff|39 f8|0f 84 90 02 00 00|83 e8 02|89 cf|89 c2|"
+      "89 44 24 2c|83 e2 fe|29 d7|89 7c 24 50|31 ff|8b 54 24 50|8d 41 ff|"
+      "39 d1|0f 84 46 02 00 00|8d 51 fe|89 c6|89 6c 24 30|89 d1|"
+      "89 7c 24 34|83 e1 fe|89 54 24 38|89 5c 24 3c|29 ce|89 74 24 54|"
+      "31 f6|8b 4c 24 54|8d 78 ff|39 c8|0f 84 fd 01 00 00|8d 58 fe|89 f9|"
+      "31 d2|89 74 24 40|89 d8|89 5c 24 44|89 fd|89 d6|83 e0 fe|29 c1|"
+      "89 4c 24 10|8b 44 24 10|8d 7d ff|39 c5|0f 84 be 01 00 00|83 ed 02|"
+      "89 f9|89 e8|89 ea|83 e0 fe|29 c1|31 c0|89 4c 24 0c|89 f9|89 c3|"
+      "89 f7|89 ce|8b 44 24 0c|8d 4e ff|39 c6|0f 84 4d 01 00 00|8d 46 fd|"
+      "31 ed|89 44 24 04|8d 46 fe|89 c6|89 44 24 08|89 c8|83 e6 fe|29 f0|"
+      "89 ce|89 44 24 20|8b 44 24 20|39 c6|0f 84 32 01 00 00|8d 46 fd|"
+      "8d 4e fc|89 54 24 1c|83 e0 fe|89 5c 24 14|29 c1|8b 44 24 04|"
+      "89 6c 24 18|89 f5|89 4c 24 24|31 c9|89 c3|89 de|83 fb 01|"
+      "0f 84 22 01 00 00|31 d2|89 54 24 5c|8d 46 ff|83 ec 0c|83 ee 02|"
+      "89 4c 24 64|50|e8 fc ff ff ff|8b 54 24 6c|83 c4 10|8b 4c 24 58|"
+      "01 c2|83 fe 01|7f d7|8d 4c 11 01|83 eb 02|39 5c 24 24|75 bd|89 ee|"
+      "8b 5c 24 14|8b 6c 24 18|8b 54 24 1c|83 ee 02|83 6c 24 04 02|"
+      "8d 6c 0d 01|83 fe 01|0f 8f 69 ff ff ff|8b 74 24 08|8d 5c 2b 01|"
+      "83 fe 01|0f 8f 2a ff ff ff|89 fe|89 d8|89 d5|8d 74 06 01|83 fd 01|"
+      "0f 8f ec fe ff ff|89 f2|8b 5c 24 44|8b 74 24 40|89 d8|8d 74 16 01|"
+      "83 fb 01|0f 8f a6 fe ff ff|8b 6c 24 30|8b 7c 24 34|8b 54 24 38|"
+      "8b 5c 24 3c|89 d1|8d 7c 37 01|83 fa 01|0f 8f 56 fe ff ff|"
+      "8b 44 24 2c|89 fa|8d 6c 15 01|83 f8 01|0f 8f 1e fe ff ff|89 de|"
+      "89 eb|8b 6c 24 28|89 f2|8d 6c 1d 01|83 fe 01|0f 8f c0 00 00 00|"
+      "89 ee|83 c4 6c|83 c6 01|5b|89 f0|5e|5f|5d|c3|66 90|89 d8|89 fe|"
+      "89 d5|83 c0 01|e9 72 ff ff ff|66 90|8b 74 24 08|83 c5 01|"
+      "8d 5c 2b 01|83 fe 01|0f 8f 80 fe ff ff|e9 51 ff ff ff|"
+      "8d b4 26 00 00 00 00|89 ee|8b 5c 24 14|8b 6c 24 18|83 c1 01|"
+      "8b 54 24 1c|e9 0e ff ff ff|89 f2|8b 5c 24 44|8b 74 24 40|83 c2 01|"
+      "e9 3f ff ff ff|8b 6c 24 30|8b 7c 24 34|83 c6 01|8b 54 24 38|"
+      "8b 5c 24 3c|e9 46 ff ff ff|89 fa|8b 44 24 2c|83 c2 01|8d 6c 15 01|"
+      "83 f8 01|0f 8e 52 ff ff ff|8b 7c 24 4c|8d 48 ff|39 f8|"
+      "0f 85 70 fd ff ff|89 de|89 eb|8b 6c 24 28|83 c3 01|89 f2|"
+      "8d 6c 1d 01|83 fe 01|0f 8e 40 ff ff ff|8b 7c 24 48|8d 5e ff|89 d8|"
+      "39 fa|0f 85 1c fd ff ff|89 ee|83 c6 02|83 c4 6c|89 f0|5b|5e|5f|5d|"
+      "c3|90|e8 fc ff ff ff|81 c2 02 00 00 00|83 ec 10|8b 44 24 14|6a 03|"
+      "ff 74 24 1c|50|89 c1|83 e1 03|ff 94 8a 00 00 00 00|83 c4 1c|c3|"
+      "8d b4 26 00 00 00 00|db 44 24 04|d8 4c 24 08|df 6c 24 0c|de c1|c3|"
+      "90|dd 44 24 04|dd 44 24 0c|b8 ff ff ff ff|db f1|77 0f|d9 c9|31 c0|"
+      "df f1|dd d8|0f 97 c0|eb 06|66 90|dd d8|dd d8|c3|83 c8 ff|c3|"
+      "8b 04 24|c3|8b 14 24|c3|8b 0c 24|c3|8b 1c 24|c3" },
+    { "-O2 -mfpmath=387 -mno-sse",
+      "e8 fc ff ff ff|05 01 00 00 00|8b 54 24 04|83 fa 07|"
+      "0f 87 fc ff ff ff|03 84 90 00 00 00 00|ff e0|8b 44 24 08|"
+      "23 44 24 0c|c3|8d b4 26 00 00 00 00|8b 44 24 08|0b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|03 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|2b 44 24 0c|c3|"
+      "8d b4 26 00 00 00 00|8b 44 24 08|0f af 44 24 0c|c3|"
+      "8d b6 00 00 00 00|8b 54 24 0c|31 c0|85 d2|74 2e|8b 44 24 08|99|"
+      "f7 7c 24 0c|c3|8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 e0|c3|"
+      "8d 74 26 00|8b 44 24 08|0f b6 4c 24 0c|d3 f8|c3|8d 74 26 00|c3|"
+      "8d b4 26 00 00 00 00|56|53|8b 74 24 10|8b 5c 24 0c|85 f6|74 38|"
+      "01 de|b8 ff ff ff ff|8d 76 00|0f b6 13|83 c3 01|31 d0|"
+      "ba 08 00 00 00|8d 76 00|89 c1|83 e0 01|f7 d8|d1 e9|25 20 83 b8 ed|"
+      "31 c8|83 ea 01|75 eb|39 f3|75 d7|f7 d0|5b|5e|c3|31 c0|5b|5e|c3|"
+      "8d 74 26 00|90|e8 fc ff ff ff|05 01 00 00 00|55|57|56|53|83 ec 1c|"
+      "8b 6c 24 34|8b 54 24 44|89 44 24 0c|8b 74 24 38|8b 7c 24 30|"
+      "89 54 24 04|89 ea|8b 44 24 40|0f af d6|8b 5c 24 04|89 04 24|89 f8|"
+      "89 d1|8b 54 24 3c|0f af d7|01 d1|f7 e6|83 e6 3f|01 ca|8b 0c 24|53|"
+      "83 c9 01|51|52|50|8b 5c 24 1c|e8 fc ff ff ff|89 f1|31 db|0f a5 fd|"
+      "d3 e7|f6 c1 20|8b 4c 24 10|0f 45 ef|0f 45 fb|8b 5c 24 14|01 f8|"
+      "11 ea|0f ac d9 07|c1 eb 07|29 c8|19 da|83 c4 2c|5b|5e|5f|5d|c3|"
+      "8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|90|dd 44 24 0c|"
+      "8b 44 24 08|8b 54 24 04|d9 ee|83 e8 01|78 15|8d 74 26 00|90|d8 c9|"
+      "dc 04 c2|83 e8 01|73 f6|dd d9|c3|8d 76 00|dd d9|c3|8d 74 26 00|90|"
+      "53|8b 4c 24 10|85 c9|7e 2f|8b 44 24 08|8b 54 24 0c|d9 ee|8d 0c 88|"
+      "8d b4 26 00 00 00 00|8d 76 00|d9 00|d8 0a|83 c0 04|83 c2 04|de c1|"
+      "39 c8|75 f0|5b|c3|8d b6 00 00 00 00|d9 ee|5b|c3|8d 74 26 00|53|"
+      "83 ec 28|8b 5c 24 38|85 db|7e 70|8b 44 24 30|c1 e3 04|8b 54 24 34|"
+      "01 c3|8d b4 26 00 00 00 00|d9 40 0c|d9 40 08|83 c0 10|83 c2 10|"
+      "d9 40 f4|d9 40 f0|d9 42 f0|d8 c9|de c1|d9 1c 24|d9 42 f4|8b 0c 24|"
+      "d8 c9|de c1|d9 5c 24 04|d9 42 f8|d8 c9|de c1|d9 5c 24 08|d9 42 fc|"
+      "d8 c9|de c1|d9 5c 24 0c|89 48 f0|8b 4c 24 04|89 48 f4|8b 4c 24 08|"
+      "89 48 f8|8b 4c 24 0c|89 48 fc|39 d8|75 a4|83 c4 28|5b|c3|"
+      "8d b4 26 00 00 00 00|8d b4 26 00 00 00 00|90|55|89 e5|57|56|53|"
+      "83 e4 e0|83 ec 40|8b 7d 10|85 ff|0f 8e be 00 00 00|8b 45 08|"
+      "c1 e7 05|8b 55 0c|01 c7|8d b6 00 00 00 00|8b 1a|8b 08|39 cb|"
+      "0f 4c d9|89 1c 24|8b 72 04|8b 48 04|39 f1|0f 4c ce|89 4c 24 04|"
+      "8b 72 08|39 70 08|0f 4d 70 08|89 74 24 08|8b 72 0c|39 70 0c|"
+      "0f 4d 70 0c|89 74 24 0c|8b 72 10|39 70 10|0f 4d 70 10|89 74 24 10|"
+      "8b 72 14|39 70 14|0f 4d 70 14|89 74 24 14|8b 72 18|39 70 18|"
+      "0f 4d 70 18|89 74 24 18|8b 72 1c|39 70 1c|0f 4d 70 1c|83 c0 20|"
+      "83 c2 20|89 74 24 1c|89 58 e0|89 48 e4|8b 4c 24 08|89 48 e8|"
+      "8b 4c 24 0c|89 48 ec|8b 4c 24 10|89 48 f0|8b 4c 24 14|89 48 f4|"
+      "8b 4c 24 18|89 48 f8|8b 4c 24 1c|89 48 fc|39 f8|0f 85 53 ff ff ff|"
+      "8d 65 f4|5b|5e|5f|5d|c3|8d 76 00|8b 44 24 04|8b 54 24 08|85 c0|"
+      "75 0a|eb 15|66 90|8b 00|85 c0|74 0a|39 50 04|75 f5|c3|8d 74 26 00|"
+      "31 c0|c3|c3|8d b4 26 00 00 00 00|8d 74 26 00|90|57|56|8b 44 24 14|"
+      "8b 7c 24 0c|8b 74 24 10|85 c0|74 0b|01 f8|8d 74 26 00|a4|39 c7|"
+      "75 fb|5e|5f|c3|0f b7 44 24 04|66 c1 c0 08|c3|8d b6 00 00 00 00|56|"
+      "53|e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 10|8b 74 24 1c|56|"
+      "83 ce 01|e8 fc ff ff ff|31 c9|f3 0f bc ce|0f bd d6|83 c4 14|"
+      "83 f2 1f|01 c8|5b|5e|01 d0|c3|8d b4 26 00 00 00 00|"
+      "8d b6 00 00 00 00|8b 4c 24 04|8b 54 24 0c|8b 44 24 08|39 d1|"
+      "0f 4e d1|39 c1|0f 4d c2|c3|8d b4 26 00 00 00 00|66 90|53|"
+      "e8 fc ff ff ff|81 c3 02 00 00 00|83 ec 18|8d 44 24 08|83 ec 0c|50|"
+      "ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|ff 74 24 3c|e8 fc ff ff ff|"
+      "03 44 24 28|13 54 24 2c|83 c4 38|5b|c3|8d b4 26 00 00 00 00|"
+      "e8 fc ff ff ff|81 c1 02 00 00 00|53|8b 5c 24 08|85 db|7e 21|31 c0|"
+      "8d b4 26 00 00 00 00|8d 76 00|8b 91 00 00 00 00|01 c2|83 c0 01|"
+      "89 91 00 00 00 00|39 c3|75 eb|5b|c3|8d b4 26 00 00 00 00|66 90|55|"
+      "57|56|be 01 00 00 00|53|83 ec 6c|8b 94 24 80 00 00 00|83 fa 01|"
+      "0f 8e 05 03 00 00|8d 5a ff|89 d7|31 ed|89 d8|83 e0 fe|29 c7|89 d8|"
+      "89 7c 24 48|39 54 24 48|0f 84 e2 02 00 00|8d 72 fe|89 df|31 db|"
+      "89 6c 24 28|89 f2|89 dd|89 f3|83 e2 fe|29 d7|89 7c 24 4c|8d 48 ff|"
+      "39 44 24 4c|0f 84 92 02 00 00|83 e8 02|89 cf|89 c2|89 44 24 2c|"
+      "83 e2 fe|29 d7|89 7c 24 50|31 ff|8d 41 ff|39 4c 24 50|"
+      "0f 84 4c 02 00 00|8d 51 fe|89 c6|89 6c 24 30|89 d1|89 7c 24 34|"
+      "83 e1 fe|89 5c 24 38|89 54 24 3c|29 ce|89 74 24 54|31 f6|"
+      "8b 4c 24 54|8d 78 ff|39 c8|0f 84 03 02 00 00|8d 58 fe|89 f9|31 d2|"
+      "89 74 24 40|89 d8|89 5c 24 44|89 fd|89 d6|83 e0 fe|29 c1|"
+      "89 4c 24 10|8b 44 24 10|8d 7d ff|39 c5|0f 84 c4 01 00 00|83 ed 02|"
+      "89 f9|89 e8|89 ea|83 e0 fe|29 c1|31 c0|89 4c 24 0c|89 f9|89 c3|"
+      "89 f7|89 ce|8b 44 24 0c|8d 4e ff|39 c6|0f 84 53 01 00 00|8d 46 fd|"
+      "31 ed|89 44 24 04|8d 46 fe|89 c6|89 44 24 08|89 c8|83 e6 fe|29 f0|"
+      "89 ce|89 44 24 20|8b 44 24 20|39 c6|0f 84 38 01 00 00|8d 46 fd|"
+      "8d 4e fc|89 54 24 1c|83 e0 fe|89 5c 24 14|29 c1|8b 44 24 04|"
+      "89 6c 24 18|89 f5|89 4c 24 24|31 c9|89 c3|89 de|83 fb 01|"
+      "0f 84 28 01 00 00|31 d2|89 54 24 5c|8d 46 ff|83 ec 0c|83 ee 02|"
+      "89 4c 24 64|50|e8 fc ff ff ff|8b 54 24 6c|83 c4 10|8b 4c 24 58|"
+      "01 c2|83 fe 01|7f d7|8d 4c 11 01|83 eb 02|39 5c 24 24|75 bd|89 ee|"
+      "8b 5c 24 14|8b 6c 24 18|8b 54 24 1c|83 ee 02|83 6c 24 04 02|"
+      "8d 6c 0d 01|83 fe 01|0f 8f 69 ff ff ff|8b 74 24 08|8d 5c 2b 01|"
+      "83 fe 01|0f 8f 2a ff ff ff|89 fe|89 d8|89 d5|8d 74 06 01|83 fd 01|"
+      "0f 8f ec fe ff ff|89 f2|8b 5c 24 44|8b 74 24 40|89 d8|8d 74 16 01|"
+      "83 fb 01|0f 8f a6 fe ff ff|8b 6c 24 30|8b 7c 24 34|8b 5c 24 38|"
+      "8b 54 24 3c|89 d1|8d 7c 37 01|83 fa 01|0f 8f 58 fe ff ff|"
+      "8b 44 24 2c|89 fa|8d 6c 15 01|83 f8 01|0f 8f 22 fe ff ff|89 de|"
+      "89 eb|8b 6c 24 28|89 f2|8d 6c 1d 01|83 fe 01|0f 8f c4 00 00 00|"
+      "89 ee|83 c4 6c|83 c6 01|5b|89 f0|5e|5f|5d|c3|8d b4 26 00 00 00 00|"
+      "90|89 d8|89 fe|89 d5|83 c0 01|e9 6c ff ff ff|66 90|8b 74 24 08|"
+      "83 c5 01|8d 5c 2b 01|83 fe 01|0f 8f 7a fe ff ff|e9 4b ff ff ff|"
+      "8d b4 26 00 00 00 00|89 ee|8b 5c 24 14|8b 6c 24 18|83 c1 01|"
+      "8b 54 24 1c|e9 08 ff ff ff|89 f2|8b 5c 24 44|8b 74 24 40|83 c2 01|"
+      "e9 39 ff ff ff|8b 6c 24 30|8b 7c 24 34|83 c6 01|8b 5c 24 38|"
+      "8b 54 24 3c|e9 40 ff ff ff|89 fa|8b 44 24 2c|83 c2 01|8d 6c 15 01|"
+      "83 f8 01|0f 8e 4c ff ff ff|8d 48 ff|39 44 24 4c|0f 85 6e fd ff ff|"
+      "89 de|89 eb|8b 6c 24 28|83 c3 01|89 f2|8d 6c 1d 01|83 fe 01|"
+      "0f 8e 3c ff ff ff|8d 5e ff|89 d8|39 54 24 48|0f 85 1e fd ff ff|"
+      "89 ee|83 c6 02|83 c4 6c|89 f0|5b|5e|5f|5d|c3|8d 74 26 00|90|"
+      "e8 fc ff ff ff|81 c2 02 00 00 00|83 ec 10|8b 44 24 14|6a 03|"
+      "ff 74 24 1c|50|89 c1|83 e1 03|ff 94 8a 00 00 00 00|83 c4 1c|c3|"
+      "8d b4 26 00 00 00 00|db 44 24 04|d8 4c 24 08|df 6c 24 0c|de c1|c3|"
+      "90|dd 44 24 04|dd 44 24 0c|b8 ff ff ff ff|db f1|77 0f|d9 c9|31 c0|"
+      "df f1|dd d8|0f 97 c0|eb 06|66 90|dd d8|dd d8|c3|83 c8 ff|c3|"
+      "8b 04 24|c3|8b 14 24|c3|8b 0c 24|c3|8b 1c 24|c3" },
+} };
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "instruction.h"
+#include "instruction_corpus.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+
+namespace {
+
+std::vector<std::byte> Bytes(const std::initializer_list<std::uint8_t> bytes) {
+    std::vector<std::byte> code{};
+    for (const auto byte : bytes) {
+        code.push_back(static_cast<std::byte>(byte));
+    }
+
+    return code;
+}
+
+Instruction Decode(const std::initializer_list<std::uint8_t> bytes,
+                   const std::uintptr_t address = 0) {
+    const auto instruction{ DecodeInstruction(Bytes(bytes), address) };
+    EXPECT_TRUE(instruction.has_value());
+    return instruction.value_or(Instruction{});
+}
+
+}  // namespace
+
+
+TEST(InstructionTest, ReferenceLengths) {
+    for (const auto& [code, text] : reference_instructions) {
+        const auto parsed{ ParseReferenceCode(code) };
+        EXPECT_EQ(InstructionLength(parsed.bytes), parsed.bytes.size()) << text;
+
+        // Bytes after an instruction must not change its length.
+        auto padded{ parsed.bytes };
+        padded.resize(padded.size() + max_instruction_length,
+                      std::byte{ 0x90 });
+        EXPECT_EQ(InstructionLength(padded), parsed.bytes.size()) << text;
+    }
+}
+
+TEST(InstructionTest, TruncatedReferenceInstructions) {
+    for (const auto& [code, text] : reference_instructions) {
+        const auto parsed{ ParseReferenceCode(code) };
+        for (std::size_t size{ 0 }; size != parsed.bytes.size(); ++size) {
+            EXPECT_FALSE(DecodeInstruction(std::span{ parsed.bytes }.first(size)))
+                << text << " truncated to " << size << " bytes";
+        }
+    }
+}
+
+TEST(InstructionTest, ReferenceCodeBoundaries) {
+    for (const auto& [options, code] : reference_code) {
+        const auto parsed{ ParseReferenceCode(code) };
+        const std::span<const std::byte> bytes{ parsed.bytes };
+        std::size_t offset{ 0 };
+        for (const auto expected : parsed.lengths) {
+            ASSERT_EQ(InstructionLength(bytes.subspan(offset)), expected)
+                << options << " at offset " << offset;
+            offset += expected;
+        }
+
+        EXPECT_EQ(offset, bytes.size());
+    }
+}
+
+TEST(InstructionTest, Prefixes) {
+    const auto locked{ Decode({ 0xF0, 0x0F, 0xB1, 0x0B }) };
+    EXPECT_TRUE(locked.HasPrefix(InstructionPrefix::Lock));
+    EXPECT_EQ(locked.prefix_count, 1);
+    EXPECT_EQ(locked.map, OpcodeMap::Secondary);
+    EXPECT_EQ(locked.opcode, 0xB1);
+
+    const auto segment{ Decode({ 0x64, 0xA1, 0x18, 0x00, 0x00, 0x00 }) };
+    EXPECT_TRUE(segment.HasPrefix(InstructionPrefix::Segment));
+    EXPECT_EQ(segment.segment, 0x64);
+    EXPECT_EQ(segment.immediate, 0x18);
+    EXPECT_TRUE(segment.memory_access);
+
+    const auto word{ Decode({ 0x66, 0xB8, 0x34, 0x12 }) };
+    EXPECT_TRUE(word.HasPrefix(InstructionPrefix::OperandSize));
+    EXPECT_EQ(word.immediate_size, 2);
+    EXPECT_EQ(word.immediate, 0x1234);
+
+    const auto repeated{ Decode({ 0xF3, 0xA5 }) };
+    EXPECT_TRUE(repeated.HasPrefix(InstructionPrefix::Rep));
+    EXPECT_TRUE(repeated.memory_access);
+
+    // More prefixes than the maximum length.
+    std::vector<std::byte> prefixes(max_instruction_length, std::byte{ 0x66 });
+    prefixes.push_back(std::byte{ 0x90 });
+    EXPECT_FALSE(DecodeInstruction(prefixes));
+}
+
+TEST(InstructionTest, OpcodeMaps) {
+    EXPECT_EQ(Decode({ 0x0F, 0x31 }).map, OpcodeMap::Secondary);
+
+    const auto shuffle{ Decode({ 0x66, 0x0F, 0x38, 0x00, 0xC1 }) };
+    EXPECT_EQ(shuffle.map, OpcodeMap::Tertiary38);
+    EXPECT_EQ(shuffle.length, 5);
+
+    const auto align{ Decode({ 0x66, 0x0F, 0x3A, 0x0F, 0xC1, 0x04 }) };
+    EXPECT_EQ(align.map, OpcodeMap::Tertiary3A);
+    EXPECT_EQ(align.immediate, 4);
+
+    const auto vector{ Decode({ 0xC5, 0xF4, 0x58, 0x10 }) };
+    EXPECT_TRUE(vector.HasPrefix(InstructionPrefix::Vex));
+    EXPECT_EQ(vector.map, OpcodeMap::Secondary);
+    EXPECT_TRUE(vector.memory);
+
+    // `LDS` in 32-bit mode, whose `ModRM.mod` is not `11`.
+    const auto far_load{ Decode({ 0xC5, 0x4B, 0x04 }) };
+    EXPECT_FALSE(far_load.HasPrefix(InstructionPrefix::Vex));
+    EXPECT_EQ(far_load.length, 3);
+
+    EXPECT_FALSE(DecodeInstruction(Bytes({ 0x0F, 0x04 })));
+}
+
+TEST(InstructionTest, MemoryOperands) {
+    // `MOV EDX, [EAX + ECX * 4 + 8]`
+    const auto scaled{ Decode({ 0x8B, 0x54, 0x88, 0x08 }) };
+    ASSERT_TRUE(scaled.memory);
+    EXPECT_TRUE(scaled.has_sib);
+    EXPECT_EQ(scaled.memory->base, RegisterIndex::EAX);
+    EXPECT_EQ(scaled.memory->index, RegisterIndex::ECX);
+    EXPECT_EQ(scaled.memory->scale, 4);
+    EXPECT_EQ(scaled.memory->displacement, 8);
+
+    // `MOV EDX, [ECX * 8 + 0x1000]` has no base register.
+    const auto indexed{ Decode({ 0x8B, 0x14, 0xCD, 0x00, 0x10, 0x00, 0x00 }) };
+    ASSERT_TRUE(indexed.memory);
+    EXPECT_FALSE(indexed.memory->base);
+    EXPECT_EQ(indexed.memory->index, RegisterIndex::ECX);
+    EXPECT_EQ(indexed.memory->scale, 8);
+    EXPECT_EQ(indexed.displacement_size, 4);
+
+    // `MOV EAX, [ESP]` has a `SIB` byte without an index.
+    const auto stack{ Decode({ 0x8B, 0x04, 0x24 }) };
+    ASSERT_TRUE(stack.memory);
+    EXPECT_EQ(stack.memory->base, RegisterIndex::ESP);
+    EXPECT_FALSE(stack.memory->index);
+
+    // `MOV EBX, [EAX - 0x80]`
+    const auto negative{ Decode({ 0x8B, 0x58, 0x80 }) };
+    EXPECT_EQ(negative.displacement, -0x80);
+
+    // `MOV EAX, [BP + DI + 2]` with a 16-bit address.
+    const auto address16{ Decode({ 0x67, 0x8B, 0x43, 0x02 }) };
+    ASSERT_TRUE(address16.memory);
+    EXPECT_EQ(address16.memory->base, RegisterIndex::EBP);
+    EXPECT_EQ(address16.memory->index, RegisterIndex::EDI);
+    EXPECT_EQ(address16.displacement_size, 1);
+
+    // `LEA` only calculates an address.
+    const auto lea{ Decode({ 0x8D, 0x64, 0x24, 0x04 }) };
+    EXPECT_TRUE(lea.memory);
+    EXPECT_FALSE(lea.memory_access);
+
+    // `MOV EAX, CR0` ignores `ModRM.mod`.
+    const auto control{ Decode({ 0x0F, 0x20, 0x00 }) };
+    EXPECT_FALSE(control.memory);
+    EXPECT_EQ(control.length, 3);
+}
+
+TEST(InstructionTest, EffectiveAddress) {
+    const auto instruction{ Decode({ 0x8B, 0x54, 0x88, 0x08 }) };
+    const auto read{ [](const RegisterIndex index) -> std::uintptr_t {
+        return index == RegisterIndex::EAX ? 0x1000 : 3;
+    } };
+    EXPECT_EQ(EffectiveAddress(instruction, read), 0x1000 + 3 * 4 + 8);
+
+    const auto address16{ Decode({ 0x67, 0x8B, 0x00 }) };
+    const auto high{ [](RegisterIndex) -> std::uintptr_t { return 0x18000; } };
+    EXPECT_EQ(EffectiveAddress(address16, high), 0);
+
+    EXPECT_FALSE(EffectiveAddress(Decode({ 0x90 }), read));
+}
+
+TEST(InstructionTest, ControlFlow) {
+    const auto call{ Decode({ 0xE8, 0xFB, 0x0F, 0x00, 0x00 }, 0x401000) };
+    EXPECT_EQ(call.flow, InstructionFlow::Call);
+    EXPECT_TRUE(call.IsCall());
+    EXPECT_TRUE(call.IsRelativeBranch());
+    EXPECT_EQ(call.target, 0x402000);
+
+    const auto backward{ Decode({ 0x74, 0xFE }, 0x401000) };
+    EXPECT_EQ(backward.flow, InstructionFlow::ConditionalJump);
+    EXPECT_EQ(backward.target, 0x401000);
+
+    const auto near{ Decode({ 0x0F, 0x85, 0x00, 0x01, 0x00, 0x00 }, 0x1000) };
+    EXPECT_EQ(near.flow, InstructionFlow::ConditionalJump);
+    EXPECT_EQ(near.target, 0x1106);
+
+    const auto loop{ Decode({ 0xE2, 0x00 }) };
+    EXPECT_EQ(loop.flow, InstructionFlow::ConditionalJump);
+
+    const auto indirect_call{ Decode({ 0xFF, 0x54, 0x8C, 0x04 }) };
+    EXPECT_EQ(indirect_call.flow, InstructionFlow::IndirectCall);
+    EXPECT_TRUE(indirect_call.IsCall());
+    EXPECT_FALSE(indirect_call.IsRelativeBranch());
+    EXPECT_TRUE(indirect_call.memory_access);
+
+    EXPECT_EQ(Decode({ 0xFF, 0xE0 }).flow, InstructionFlow::IndirectJump);
+    EXPECT_EQ(Decode({ 0xFF, 0x18 }).flow, InstructionFlow::IndirectCall);
+    EXPECT_EQ(Decode({ 0xFF, 0x30 }).flow, InstructionFlow::Sequential);
+
+    const auto far_call{ Decode(
+        { 0x9A, 0x78, 0x56, 0x34, 0x12, 0x23, 0x00 }) };
+    EXPECT_EQ(far_call.flow, InstructionFlow::Call);
+    EXPECT_FALSE(far_call.IsRelativeBranch());
+    EXPECT_EQ(far_call.immediate, 0x12345678);
+    EXPECT_EQ(far_call.immediate2, 0x23);
+
+    const auto ret{ Decode({ 0xC2, 0x08, 0x00 }) };
+    EXPECT_TRUE(ret.IsReturn());
+    EXPECT_EQ(ret.immediate, 8);
+
+    EXPECT_EQ(Decode({ 0xCC }).flow, InstructionFlow::Interrupt);
+    EXPECT_EQ(Decode({ 0xCD, 0x2E }).flow, InstructionFlow::Interrupt);
+    EXPECT_EQ(Decode({ 0x0F, 0x34 }).flow, InstructionFlow::Interrupt);
+}
+
+TEST(InstructionTest, Immediates) {
+    const auto enter{ Decode({ 0xC8, 0x10, 0x00, 0x01 }) };
+    EXPECT_EQ(enter.immediate, 0x10);
+    EXPECT_EQ(enter.immediate2, 1);
+    EXPECT_EQ(enter.length, 4);
+
+    // `TEST` has an immediate, but other `F6` instructions do not.
+    EXPECT_EQ(Decode({ 0xF6, 0x00, 0x01 }).length, 3);
+    EXPECT_EQ(Decode({ 0xF6, 0x10 }).length, 2);
+    EXPECT_EQ(Decode({ 0xF7, 0x45, 0x08, 0x00, 0x00, 0x00, 0x80 }).length, 7);
+    EXPECT_EQ(Decode({ 0x66, 0xF7, 0x00, 0x01, 0x00 }).length, 5);
+
+    // A 16-bit `moffs` address.
+    EXPECT_EQ(Decode({ 0x67, 0xA1, 0x34, 0x12 }).length, 4);
+
+    const auto imul{ Decode({ 0x6B, 0xC8, 0x03 }) };
+    EXPECT_EQ(imul.immediate_size, 1);
+    EXPECT_EQ(imul.immediate, 3);
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "module.h"
+#include "pe_corpus.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+//! Copy reference data, so it can be modified.
+template <std::size_t size>
+std::vector<std::byte> CopyBytes(const std::array<std::uint8_t, size>& data) {
+    const auto bytes{ ReferenceBytes(data) };
+    return { bytes.begin(), bytes.end() };
+}
+
+//! Overwrite a 32-bit value in data.
+void Patch(std::vector<std::byte>& data, const std::size_t offset,
+           const std::uint32_t value) {
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+}
+
+}  // namespace
+
+
+TEST(PeHeadersTest, Parse) {
+    const auto headers{ ParsePeHeaders(ReferenceBytes(sample_dll_headers)) };
+    ASSERT_TRUE(headers);
+    EXPECT_EQ(headers->image_size, 0x4000);
+    EXPECT_EQ(headers->required_size, sample_dll_headers.size());
+    EXPECT_EQ(headers->entry, 0x1030);
+    EXPECT_EQ(headers->export_offset, reference_export_offset);
+    EXPECT_EQ(headers->export_size, sample_dll_exports.size());
+
+    ASSERT_EQ(headers->sections.size(), 3);
+    EXPECT_EQ(headers->sections[0].name, ".text");
+    EXPECT_EQ(headers->sections[0].offset, 0x1000);
+    EXPECT_EQ(headers->sections[0].size, 0x50);
+    EXPECT_TRUE(headers->sections[0].Executable());
+    EXPECT_EQ(headers->sections[1].name, ".edata");
+    EXPECT_FALSE(headers->sections[1].Executable());
+    EXPECT_EQ(headers->sections[2].name, ".idata");
+}
+
+TEST(PeHeadersTest, SectionTableOutsideData) {
+    const auto data{ ReferenceBytes(sample_dll_headers) };
+    const auto headers{ ParsePeHeaders(data.first(data.size() - 1)) };
+
+    // The caller is told how much data to read.
+    ASSERT_TRUE(headers);
+    EXPECT_EQ(headers->required_size, data.size());
+    EXPECT_TRUE(headers->sections.empty());
+}
+
+TEST(PeHeadersTest, Invalid) {
+    EXPECT_FALSE(ParsePeHeaders({}));
+    EXPECT_FALSE(ParsePeHeaders(ReferenceBytes(sample_dll_headers).first(0x40)));
+
+    auto data{ CopyBytes(sample_dll_headers) };
+    data[0] = std::byte{ 'N' };
+    EXPECT_FALSE(ParsePeHeaders(data));
+
+    // A negative offset of the NT headers.
+    data = CopyBytes(sample_dll_headers);
+    Patch(data, offsetof(pe::DosHeader, nt_offset), 0x8000'0000);
+    EXPECT_FALSE(ParsePeHeaders(data));
+
+    // An export directory outside the image is ignored.
+    data = CopyBytes(sample_dll_headers);
+    std::int32_t nt_offset{ 0 };
+    std::memcpy(&nt_offset, data.data() + offsetof(pe::DosHeader, nt_offset),
+                sizeof(nt_offset));
+    Patch(data,
+          nt_offset + offsetof(pe::NtHeaders32, optional_header)
+              + offsetof(pe::OptionalHeader32, directories)
+              + offsetof(pe::DataDirectory, size),
+          0xFFFF'0000);
+    const auto headers{ ParsePeHeaders(data) };
+    ASSERT_TRUE(headers);
+    EXPECT_EQ(headers->export_size, 0);
+}
+
+TEST(ExportDirectoryTest, Parse) {
+    const auto exports{ ParseExportDirectory(
+        ReferenceBytes(sample_dll_exports), reference_export_offset) };
+    ASSERT_TRUE(exports);
+    EXPECT_EQ(exports->Size(), 5);
+
+    const auto add{ exports->Find("Add") };
+    ASSERT_TRUE(add);
+    EXPECT_EQ(add->get().ordinal, 1);
+    EXPECT_EQ(add->get().offset, 0x1000);
+
+    // An export with another name has the same address.
+    ASSERT_TRUE(exports->Find("Sub"));
+    ASSERT_TRUE(exports->Find("Minus"));
+    EXPECT_EQ(exports->Find("Minus")->get().ordinal, 3);
+    EXPECT_EQ(exports->Find("Minus")->get().offset,
+              exports->Find("Sub")->get().offset);
+
+    // Names are case-sensitive.
+    EXPECT_FALSE(exports->Find("add"));
+
+    const auto hidden{ exports->FindOrdinal(5) };
+    ASSERT_TRUE(hidden);
+    EXPECT_TRUE(hidden->get().name.empty());
+    EXPECT_EQ(hidden->get().offset, 0x1020);
+
+    // The unused ordinal has no export.
+    EXPECT_FALSE(exports->FindOrdinal(4));
+
+    const auto forwarded{ exports->Find("Forwarded") };
+    ASSERT_TRUE(forwarded);
+    EXPECT_EQ(forwarded->get().forwarder, "KERNEL32.HeapAlloc");
+}
+
+TEST(ExportDirectoryTest, FindNearest) {
+    const auto exports{ ParseExportDirectory(
+        ReferenceBytes(sample_dll_exports), reference_export_offset) };
+    ASSERT_TRUE(exports);
+
+    EXPECT_EQ(exports->FindNearest(0x1004)->get().offset, 0x1000);
+    EXPECT_EQ(exports->FindNearest(0x1010)->get().offset, 0x1010);
+    EXPECT_EQ(exports->FindNearest(0x1FFF)->get().offset, 0x1020);
+    EXPECT_FALSE(exports->FindNearest(0xFFF));
+}
+
+TEST(ExportDirectoryTest, OrdinalsOnly) {
+    auto data{ CopyBytes(ordinal_dll_exports) };
+    const auto exports{ ParseExportDirectory(data, reference_export_offset) };
+    ASSERT_TRUE(exports);
+    EXPECT_EQ(exports->Size(), 2);
+    EXPECT_EQ(exports->FindOrdinal(10)->get().offset, 0x1000);
+    EXPECT_EQ(exports->FindOrdinal(11)->get().offset, 0x1010);
+
+    // Some linkers leave the addresses of empty name arrays as zero.
+    Patch(data, offsetof(pe::ExportDirectory, names), 0);
+    Patch(data, offsetof(pe::ExportDirectory, name_ordinals), 0);
+    const auto patched{ ParseExportDirectory(data, reference_export_offset) };
+    ASSERT_TRUE(patched);
+    EXPECT_EQ(patched->Size(), 2);
+}
+
+TEST(ExportDirectoryTest, Invalid) {
+    const auto data{ ReferenceBytes(sample_dll_exports) };
+    EXPECT_FALSE(ParseExportDirectory({}, reference_export_offset));
+
+    // The name arrays extend past the data.
+    EXPECT_FALSE(ParseExportDirectory(data.first(0x50), reference_export_offset));
+
+    // Arrays before the directory.
+    EXPECT_FALSE(
+        ParseExportDirectory(data, reference_export_offset + 0x1000));
+}
+
+TEST(ExportDirectoryTest, Name) {
+    EXPECT_EQ(ParseExportName(ReferenceBytes(sample_dll_exports),
+                              reference_export_offset),
+              "sample.dll");
+    EXPECT_EQ(ParseExportName(ReferenceBytes(ordinal_dll_exports),
+                              reference_export_offset),
+              "ordinal.dll");
+
+    // The name is not terminated within the data.
+    const auto data{ ReferenceBytes(sample_dll_exports) };
+    EXPECT_FALSE(ParseExportName(data.first(0x5C), reference_export_offset));
+}
+
+TEST(ModuleTableTest, Find) {
+    ModuleTable modules{};
+    modules.Insert({ .base = 0x2000'0000,
+                     .size = 0x4000,
+                     .path = L"C:\\Windows\\System32\\KERNEL32.DLL",
+                     .sections = { { .name = ".text",
+                                     .offset = 0x1000,
+                                     .size = 0x100,
+                                     .characteristics =
+                                         pe::section_executable } } });
+    modules.Insert({ .base = 0x1000'0000, .size = 0x4000, .path = L"sample.dll" });
+
+    EXPECT_EQ(modules.Size(), 2);
+    EXPECT_EQ(modules.Modules().front().base, 0x1000'0000);
+
+    EXPECT_EQ(modules.Find(0x1000'3FFF)->get().base, 0x1000'0000);
+    EXPECT_FALSE(modules.Find(0x1000'4000));
+    EXPECT_EQ(modules.FindByName(L"kernel32.dll")->get().base, 0x2000'0000);
+    EXPECT_EQ(modules.FindByName(L"SAMPLE.DLL")->get().Name(), L"sample.dll");
+    EXPECT_FALSE(modules.FindByName(L"ntdll.dll"));
+
+    const auto located{ modules.Locate(0x2000'1234) };
+    ASSERT_TRUE(located);
+    EXPECT_EQ(located->module->Name(), L"KERNEL32.DLL");
+    EXPECT_EQ(located->offset, 0x1234);
+
+    const auto ranges{ modules.CodeRanges() };
+    ASSERT_EQ(ranges.size(), 1);
+    EXPECT_EQ(ranges.front(), (MemoryRange{ 0x2000'1000, 0x2000'1100 }));
+
+    EXPECT_TRUE(modules.Erase(0x2000'0000));
+    EXPECT_FALSE(modules.Erase(0x2000'0000));
+    EXPECT_FALSE(modules.FindByName(L"kernel32.dll"));
+}
\ No newline at end of file
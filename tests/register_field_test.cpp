@@ -0,0 +1,89 @@
+#include "register/register.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+
+TEST(RegisterFieldTest, Flags) {
+    // Bits of the `EFLAGS` register in the order of `Flag`.
+    constexpr std::size_t offsets[]{ 0, 2, 4, 6, 7, 8, 9, 10, 11, 16 };
+    for (std::size_t i{ 0 }; i != std::size(offsets); ++i) {
+        const auto field{ FlagField(static_cast<Flag>(i)) };
+        EXPECT_EQ(field.offset, offsets[i]);
+        EXPECT_EQ(field.width, 1);
+        EXPECT_EQ(field.Encode(0, 1), std::uintptr_t{ 1 } << offsets[i]);
+        EXPECT_EQ(field.Decode(std::uintptr_t{ 1 } << offsets[i]), 1);
+        EXPECT_EQ(field.Decode(~(std::uintptr_t{ 1 } << offsets[i])), 0);
+    }
+}
+
+TEST(RegisterFieldTest, EncodeKeepsOtherBits) {
+    constexpr std::uint32_t eflags{ 0x0000'0246 };
+    EXPECT_EQ(flag_fields::tf.Encode(eflags, 1), 0x0000'0346);
+    EXPECT_EQ(flag_fields::zf.Encode(eflags, 0), 0x0000'0206);
+
+    // Field values are truncated to the width.
+    EXPECT_EQ(flag_fields::cf.Encode(eflags, 0B10), 0x0000'0246);
+}
+
+TEST(RegisterFieldTest, DebugStatus) {
+    for (std::size_t slot{ 0 }; slot != debug_address_register_count; ++slot) {
+        const auto field{ debug_status_fields::B(slot) };
+        EXPECT_EQ(field.Decode(std::uintptr_t{ 1 } << slot), 1);
+        EXPECT_EQ(field.Decode(0B1111 & ~(std::uintptr_t{ 1 } << slot)), 0);
+    }
+
+    EXPECT_EQ(debug_status_fields::bs.Decode(0x4000), 1);
+    EXPECT_EQ(debug_status_fields::bd.Encode(0, 1), 0x2000);
+    EXPECT_EQ(debug_status_fields::bt.Encode(0, 1), 0x8000);
+}
+
+TEST(RegisterFieldTest, DebugControl) {
+    // A read-write breakpoint of 4 bytes in slot 2, enabled locally.
+    std::uintptr_t dr7{ 0 };
+    dr7 = debug_control_fields::L(2).Encode(dr7, 1);
+    dr7 = debug_control_fields::RW(2).Encode(dr7, 0B11);
+    dr7 = debug_control_fields::LEN(2).Encode(dr7, 0B11);
+    EXPECT_EQ(dr7, 0x0F00'0010);
+
+    for (std::size_t slot{ 0 }; slot != debug_address_register_count; ++slot) {
+        EXPECT_EQ(debug_control_fields::L(slot).Decode(dr7), slot == 2);
+        EXPECT_EQ(debug_control_fields::G(slot).Decode(dr7), 0);
+        EXPECT_EQ(debug_control_fields::RW(slot).Decode(dr7),
+                  slot == 2 ? 0B11 : 0);
+        EXPECT_EQ(debug_control_fields::LEN(slot).Decode(dr7),
+                  slot == 2 ? 0B11 : 0);
+    }
+
+    // Resetting a slot leaves others.
+    dr7 = debug_control_fields::L(0).Encode(dr7, 1);
+    dr7 = debug_control_fields::L(2).Encode(dr7, 0);
+    dr7 = debug_control_fields::RW(2).Encode(dr7, 0);
+    dr7 = debug_control_fields::LEN(2).Encode(dr7, 0);
+    EXPECT_EQ(dr7, 0x0000'0001);
+
+    EXPECT_EQ(debug_control_fields::le.Encode(0, 1), 0x100);
+    EXPECT_EQ(debug_control_fields::ge.Encode(0, 1), 0x200);
+    EXPECT_EQ(debug_control_fields::gd.Encode(0, 1), 0x2000);
+}
+
+TEST(RegisterIndexTest, Parse) {
+    EXPECT_EQ(ParseRegisterIndex("eax"), RegisterIndex::EAX);
+    EXPECT_EQ(ParseRegisterIndex("EFLAGS"), RegisterIndex::EFLAGS);
+    EXPECT_EQ(ParseRegisterIndex("Dr7"), RegisterIndex::DR7);
+    EXPECT_FALSE(ParseRegisterIndex(""));
+    EXPECT_FALSE(ParseRegisterIndex("dr4"));
+    EXPECT_FALSE(ParseRegisterIndex("eaxx"));
+}
+
+TEST(RegisterIndexTest, Kinds) {
+    EXPECT_TRUE(IsGeneralRegister(RegisterIndex::EIP));
+    EXPECT_TRUE(IsGeneralRegister(RegisterIndex::EFLAGS));
+    EXPECT_FALSE(IsGeneralRegister(RegisterIndex::DR0));
+    EXPECT_FALSE(IsGeneralRegister(RegisterIndex::DR7));
+
+    EXPECT_EQ(DebugAddressIndex(0), RegisterIndex::DR0);
+    EXPECT_EQ(DebugAddressIndex(3), RegisterIndex::DR3);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "slot_table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+//! A small chunk size, so that tables span several chunks.
+using Table = SlotTable<std::string, 2>;
+
+}  // namespace
+
+
+TEST(SlotTableTest, InsertAndFind) {
+    Table table{};
+    const auto [handle, inserted]{ table.Insert(10, "a") };
+    EXPECT_TRUE(inserted);
+    EXPECT_FALSE(table.Insert(10, "b").second);
+
+    ASSERT_NE(table.Find(10), nullptr);
+    EXPECT_EQ(*table.Find(10), "a");
+    EXPECT_EQ(table.Find(handle), table.Find(10));
+    EXPECT_EQ(table.Find(11), nullptr);
+    EXPECT_EQ(table.Size(), 1);
+}
+
+TEST(SlotTableTest, EraseInvalidatesHandles) {
+    Table table{};
+    const auto handle{ table.Insert(1, "a").first };
+    EXPECT_TRUE(table.Erase(1));
+    EXPECT_FALSE(table.Erase(1));
+    EXPECT_EQ(table.Find(handle), nullptr);
+
+    // The slot is reused by another ID.
+    const auto reused{ table.Insert(2, "b").first };
+    EXPECT_EQ(reused.index, handle.index);
+    EXPECT_EQ(table.Find(handle), nullptr);
+    EXPECT_EQ(*table.Find(reused), "b");
+}
+
+TEST(SlotTableTest, ClearInvalidatesHandles) {
+    Table table{};
+    std::vector<SlotHandle> handles{};
+    for (std::uint32_t key{ 0 }; key != 5; ++key) {
+        handles.push_back(table.Insert(key, std::to_string(key)).first);
+    }
+
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.begin(), table.end());
+
+    // Slots are reused from the first one, with new generations.
+    for (std::uint32_t key{ 0 }; key != 5; ++key) {
+        const auto handle{ table.Insert(key, "new").first };
+        EXPECT_EQ(handle.index, handles[key].index);
+        EXPECT_NE(handle.generation, handles[key].generation);
+    }
+
+    for (const auto& handle : handles) {
+        EXPECT_EQ(table.Find(handle), nullptr);
+    }
+}
+
+TEST(SlotTableTest, FindWithHint) {
+    Table table{};
+    table.Insert(1, "a");
+    table.Insert(2, "b");
+
+    SlotHandle hint{};
+    EXPECT_EQ(*table.Find(2, hint), "b");
+    EXPECT_EQ(table.Find(hint), table.Find(2));
+
+    // A hint to another ID falls back to the index.
+    EXPECT_EQ(*table.Find(1, hint), "a");
+    EXPECT_EQ(table.Find(3, hint), nullptr);
+
+    // A hint that has been cleared is not used.
+    table.Clear();
+    table.Insert(1, "c");
+    EXPECT_EQ(*table.Find(1, hint), "c");
+}
+
+TEST(SlotTableTest, IterateInOrder) {
+    Table table{};
+    for (std::uint32_t key{ 0 }; key != 5; ++key) {
+        table.Insert(key * 10, std::to_string(key));
+    }
+
+    table.Erase(10);
+    table.Erase(30);
+
+    std::vector<std::uint32_t> keys{};
+    for (const auto& [key, value] : table) {
+        keys.push_back(key);
+    }
+
+    EXPECT_EQ(keys, (std::vector<std::uint32_t>{ 0, 20, 40 }));
+}
+
+TEST(SlotTableTest, ObjectsDoNotMove) {
+    Table table{};
+    const auto first{ table.Insert(0, "a").first };
+    const auto address{ table.Find(first) };
+    for (std::uint32_t key{ 1 }; key != 100; ++key) {
+        table.Insert(key, std::to_string(key));
+    }
+
+    EXPECT_EQ(table.Find(first), address);
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "step_callback_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+
+TEST(StepCallbackQueueTest, ExecuteInOrder) {
+    // More callbacks than the in-place storage.
+    constexpr std::size_t count{ inline_step_callback_count * 2 + 1 };
+
+    StepCallbackQueue queue{};
+    std::vector<std::size_t> executed{};
+    for (std::size_t i{ 0 }; i != count; ++i) {
+        queue.Push([&executed, i]() { executed.push_back(i); });
+    }
+
+    EXPECT_EQ(queue.Size(), count);
+    queue.Execute();
+    EXPECT_TRUE(queue.Empty());
+
+    ASSERT_EQ(executed.size(), count);
+    for (std::size_t i{ 0 }; i != count; ++i) {
+        EXPECT_EQ(executed[i], i);
+    }
+}
+
+TEST(StepCallbackQueueTest, PushWhileExecuting) {
+    StepCallbackQueue queue{};
+    auto first{ 0 };
+    auto second{ 0 };
+    for (std::size_t i{ 0 }; i != inline_step_callback_count + 1; ++i) {
+        queue.Push([&]() {
+            ++first;
+            queue.Push([&second]() { ++second; });
+        });
+    }
+
+    // Callbacks pushed during an execution are kept for the next one.
+    queue.Execute();
+    EXPECT_EQ(first, inline_step_callback_count + 1);
+    EXPECT_EQ(second, 0);
+    EXPECT_EQ(queue.Size(), inline_step_callback_count + 1);
+
+    queue.Execute();
+    EXPECT_EQ(first, inline_step_callback_count + 1);
+    EXPECT_EQ(second, inline_step_callback_count + 1);
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST(StepCallbackQueueTest, Clear) {
+    StepCallbackQueue queue{};
+    auto executed{ 0 };
+    for (std::size_t i{ 0 }; i != inline_step_callback_count * 2; ++i) {
+        queue.Push([&executed]() { ++executed; });
+    }
+
+    queue.Clear();
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Size(), 0);
+
+    queue.Execute();
+    EXPECT_EQ(executed, 0);
+}
+
+TEST(StepCallbackQueueTest, Move) {
+    StepCallbackQueue queue{};
+    auto executed{ 0 };
+    for (std::size_t i{ 0 }; i != inline_step_callback_count + 2; ++i) {
+        queue.Push([&executed]() { ++executed; });
+    }
+
+    auto moved{ std::move(queue) };
+    EXPECT_EQ(moved.Size(), inline_step_callback_count + 2);
+    moved.Execute();
+    EXPECT_EQ(executed, inline_step_callback_count + 2);
+}
\ No newline at end of file